@@ -80,6 +80,7 @@ UnhandledEngine::findBreaks( UText *text,
                              int32_t endPos,
                              UVector32 &/*foundBreaks*/,
                              UBool /* isPhraseBreaking */,
+                             BreakEngineScratch * /* scratch */,
                              UErrorCode &status) const {
     if (U_FAILURE(status)) return 0;
     UChar32 c = utext_current32(text); 
@@ -100,9 +101,14 @@ UnhandledEngine::handleCharacter(UChar32 c) {
     }
     if (!fHandled->contains(c)) {
         UErrorCode status = U_ZERO_ERROR;
-        // Apply the entire script of the character.
+        // Add the entire script of the character.
+        // applyIntPropertyValue() replaces the set contents, so use a temporary set;
+        // otherwise text that alternates between unhandled scripts would look up
+        // a break engine from the factories again for each run of characters.
         int32_t script = u_getIntPropertyValue(c, UCHAR_SCRIPT);
-        fHandled->applyIntPropertyValue(UCHAR_SCRIPT, script, status);
+        UnicodeSet scriptSet;
+        scriptSet.applyIntPropertyValue(UCHAR_SCRIPT, script, status);
+        fHandled->addAll(scriptSet);
     }
 }
 
@@ -112,6 +118,7 @@ UnhandledEngine::handleCharacter(UChar32 c) {
 
 ICULanguageBreakFactory::ICULanguageBreakFactory(UErrorCode &/*status*/) {
     fEngines = 0;
+    fPublishedCount = 0;
 }
 
 ICULanguageBreakFactory::~ICULanguageBreakFactory() {
@@ -133,6 +140,15 @@ ICULanguageBreakFactory::getEngineFor(UChar32 c) {
     const LanguageBreakEngine *lbe = NULL;
     UErrorCode  status = U_ZERO_ERROR;
 
+    // Fast path: Look through the published engines without locking.
+    int32_t count = umtx_loadAcquire(fPublishedCount);
+    for (int32_t i = count; --i >= 0;) {
+        lbe = fPublishedEngines[i];
+        if (lbe->handles(c)) {
+            return lbe;
+        }
+    }
+
     static UMutex gBreakEngineMutex;
     Mutex m(&gBreakEngineMutex);
 
@@ -157,6 +173,14 @@ ICULanguageBreakFactory::getEngineFor(UChar32 c) {
     lbe = loadEngineFor(c);
     if (lbe != nullptr) {
         fEngines->push((void *)lbe, status);
+        if (U_SUCCESS(status)) {
+            // Only this function writes fPublishedCount, while holding the mutex.
+            count = umtx_loadAcquire(fPublishedCount);
+            if (count < kMaxPublishedEngines) {
+                fPublishedEngines[count] = lbe;
+                umtx_storeRelease(fPublishedCount, count + 1);
+            }
+        }
     }
     return U_SUCCESS(status) ? lbe : nullptr;
 }
@@ -284,6 +308,10 @@ ICULanguageBreakFactory::loadDictionaryMatcherFor(UScriptCode script) {
             const UChar *characters = (const UChar *)(data + offset);
             m = new UCharsDictionaryMatcher(characters, file);
         }
+        else if (trieType == DictionaryData::TRIE_TYPE_DOUBLE_ARRAY) {
+            const int32_t *units = (const int32_t *)(data + offset);
+            m = new DoubleArrayDictionaryMatcher(units, file);
+        }
         if (m == NULL) {
             // no matcher exists to take ownership - either we are an invalid 
             // type or memory allocation failed
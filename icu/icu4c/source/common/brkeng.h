@@ -14,9 +14,11 @@
 #include "unicode/uobject.h"
 #include "unicode/utext.h"
 #include "unicode/uscript.h"
+#include "umutex.h"
 
 U_NAMESPACE_BEGIN
 
+class BreakEngineScratch;
 class UnicodeSet;
 class UStack;
 class UVector32;
@@ -33,9 +35,12 @@ class DictionaryMatcher;
  * line, etc.</p>
  *
  * <p>LanguageBreakEngines should normally be implemented so as to
- * be shared between threads without locking.</p>
+ * be shared between threads without locking.
+ * Temporary buffers for finding breaks are therefore not kept in the engine;
+ * a break iterator passes its own BreakEngineScratch to findBreaks(),
+ * so that the buffers keep their capacity from one call to the next.</p>
  */
-class LanguageBreakEngine : public UMemory {
+class U_COMMON_API LanguageBreakEngine : public UMemory {
  public:
 
   /**
@@ -68,6 +73,7 @@ class LanguageBreakEngine : public UMemory {
   * @param startPos The start of the run within the supplied text.
   * @param endPos The end of the run within the supplied text.
   * @param foundBreaks A Vector of int32_t to receive the breaks.
+  * @param scratch Temporary buffers owned by the caller, or nullptr
   * @param status Information on any errors encountered.
   * @return The number of breaks found.
   */
@@ -76,6 +82,7 @@ class LanguageBreakEngine : public UMemory {
                               int32_t endPos,
                               UVector32 &foundBreaks,
                               UBool isPhraseBreaking,
+                              BreakEngineScratch *scratch,
                               UErrorCode &status) const = 0;
 
 };
@@ -188,6 +195,7 @@ class UnhandledEngine : public LanguageBreakEngine {
   * @param startPos The start of the run within the supplied text.
   * @param endPos The end of the run within the supplied text.
   * @param foundBreaks An allocated C array of the breaks found, if any
+  * @param scratch Temporary buffers owned by the caller, or nullptr
   * @param status Information on any errors encountered.
   * @return The number of breaks found.
   */
@@ -196,6 +204,7 @@ class UnhandledEngine : public LanguageBreakEngine {
                               int32_t endPos,
                               UVector32 &foundBreaks,
                               UBool isPhraseBreaking,
+                              BreakEngineScratch *scratch,
                               UErrorCode &status) const override;
 
  /**
@@ -226,6 +235,17 @@ class ICULanguageBreakFactory : public LanguageBreakFactory {
 
   UStack    *fEngines;
 
+    /**
+     * The first engines of fEngines, for lookup without locking.
+     * Engines are immutable once created and are never removed until cleanup,
+     * so they can be shared by all break iterators on all threads.
+     * fPublishedEngines[i] is written before fPublishedCount is incremented past i.
+     * @internal
+     */
+  static constexpr int32_t kMaxPublishedEngines = 16;
+  const LanguageBreakEngine *fPublishedEngines[kMaxPublishedEngines];
+  u_atomic_int32_t fPublishedCount;
+
  public:
 
   /**
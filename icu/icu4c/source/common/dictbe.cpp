@@ -31,6 +31,17 @@
 
 U_NAMESPACE_BEGIN
 
+/*
+ ******************************************************************
+ */
+
+BreakEngineScratch::BreakEngineScratch(UErrorCode &status) :
+        fInputMap(status), fNormalizedMap(status), fBoundaries(status) {
+}
+
+BreakEngineScratch::~BreakEngineScratch() {
+}
+
 /*
  ******************************************************************
  */
@@ -52,6 +63,7 @@ DictionaryBreakEngine::findBreaks( UText *text,
                                  int32_t endPos,
                                  UVector32 &foundBreaks,
                                  UBool isPhraseBreaking,
+                                 BreakEngineScratch *scratch,
                                  UErrorCode& status) const {
     if (U_FAILURE(status)) return 0;
     (void)startPos;            // TODO: remove this param?
@@ -72,7 +84,8 @@ DictionaryBreakEngine::findBreaks( UText *text,
     }
     rangeStart = start;
     rangeEnd = current;
-    result = divideUpDictionaryRange(text, rangeStart, rangeEnd, foundBreaks, isPhraseBreaking, status);
+    result = divideUpDictionaryRange(text, rangeStart, rangeEnd, foundBreaks, isPhraseBreaking,
+                                     scratch, status);
     utext_setNativeIndex(text, current);
     
     return result;
@@ -235,6 +248,7 @@ ThaiBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t rangeEnd,
                                                 UVector32 &foundBreaks,
                                                 UBool /* isPhraseBreaking */,
+                                                BreakEngineScratch * /* scratch */,
                                                 UErrorCode& status) const {
     if (U_FAILURE(status)) return 0;
     utext_setNativeIndex(text, rangeStart);
@@ -475,6 +489,7 @@ LaoBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t rangeEnd,
                                                 UVector32 &foundBreaks,
                                                 UBool /* isPhraseBreaking */,
+                                                BreakEngineScratch * /* scratch */,
                                                 UErrorCode& status) const {
     if (U_FAILURE(status)) return 0;
     if ((rangeEnd - rangeStart) < LAO_MIN_WORD_SPAN) {
@@ -668,6 +683,7 @@ BurmeseBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t rangeEnd,
                                                 UVector32 &foundBreaks,
                                                 UBool /* isPhraseBreaking */,
+                                                BreakEngineScratch * /* scratch */,
                                                 UErrorCode& status ) const {
     if (U_FAILURE(status)) return 0;
     if ((rangeEnd - rangeStart) < BURMESE_MIN_WORD_SPAN) {
@@ -874,6 +890,7 @@ KhmerBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t rangeEnd,
                                                 UVector32 &foundBreaks,
                                                 UBool /* isPhraseBreaking */,
+                                                BreakEngineScratch * /* scratch */,
                                                 UErrorCode& status ) const {
     if (U_FAILURE(status)) return 0;
     if ((rangeEnd - rangeStart) < KHMER_MIN_WORD_SPAN) {
@@ -1125,18 +1142,31 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         int32_t rangeEnd,
         UVector32 &foundBreaks,
         UBool isPhraseBreaking,
+        BreakEngineScratch *scratch,
         UErrorCode& status) const {
     if (U_FAILURE(status)) return 0;
     if (rangeStart >= rangeEnd) {
         return 0;
     }
 
+    // Without a caller's scratch buffers, use temporary ones.
+    LocalPointer<BreakEngineScratch> localScratch;
+    if (scratch == nullptr) {
+        localScratch.adoptInsteadAndCheckErrorCode(new BreakEngineScratch(status), status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        scratch = localScratch.getAlias();
+    }
+
     // UnicodeString version of input UText, NFKC normalized if necessary.
-    UnicodeString inString;
+    // Points to aliasedInput or to one of the scratch strings.
+    UnicodeString aliasedInput;
+    const UnicodeString *input;
 
     // inputMap[inStringIndex] = corresponding native index from UText inText.
     // If NULL then mapping is 1:1
-    LocalPointer<UVector32>     inputMap;
+    UVector32 *inputMap = nullptr;
 
     // if UText has the input string as one contiguous UTF-16 chunk
     if ((inText->providerProperties & utext_i32_flag(UTEXT_PROVIDER_STABLE_CHUNKS)) &&
@@ -1146,11 +1176,13 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
         // Input UText is in one contiguous UTF-16 chunk.
         // Use Read-only aliasing UnicodeString.
-        inString.setTo(false,
-                       inText->chunkContents + rangeStart - inText->chunkNativeStart,
-                       rangeEnd - rangeStart);
+        aliasedInput.setTo(false,
+                           inText->chunkContents + rangeStart - inText->chunkNativeStart,
+                           rangeEnd - rangeStart);
+        input = &aliasedInput;
     } else {
-        // Copy the text from the original inText (UText) to inString (UnicodeString).
+        // Copy the text from the original inText (UText), for example UTF-8,
+        // into the scratch string, keeping its capacity from earlier calls.
         // Create a map from UnicodeString indices -> UText offsets.
         utext_setNativeIndex(inText, rangeStart);
         int32_t limit = rangeEnd;
@@ -1158,31 +1190,38 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         if (limit > utext_nativeLength(inText)) {
             limit = (int32_t)utext_nativeLength(inText);
         }
-        inputMap.adoptInsteadAndCheckErrorCode(new UVector32(status), status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
+        UnicodeString &copy = scratch->fText;
+        copy.remove();
+        inputMap = &scratch->fInputMap;
+        inputMap->removeAllElements();
         while (utext_getNativeIndex(inText) < limit) {
             int32_t nativePosition = (int32_t)utext_getNativeIndex(inText);
             UChar32 c = utext_next32(inText);
             U_ASSERT(c != U_SENTINEL);
-            inString.append(c);
-            while (inputMap->size() < inString.length()) {
+            copy.append(c);
+            while (inputMap->size() < copy.length()) {
                 inputMap->addElement(nativePosition, status);
             }
         }
         inputMap->addElement(limit, status);
+        if (copy.isBogus()) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        input = &copy;
     }
 
 
-    if (!nfkcNorm2->isNormalized(inString, status)) {
-        UnicodeString normalizedInput;
+    if (!nfkcNorm2->isNormalized(*input, status)) {
+        const UnicodeString &inString = *input;
+        UnicodeString &normalizedInput = scratch->fNormalizedText;
+        normalizedInput.remove();
         //  normalizedMap[normalizedInput position] ==  original UText position.
-        LocalPointer<UVector32> normalizedMap(new UVector32(status), status);
-        if (U_FAILURE(status)) {
-            return 0;
-        }
-        
+        UVector32 *normalizedMap = &scratch->fNormalizedMap;
+        normalizedMap->removeAllElements();
+
         UnicodeString fragment;
         UnicodeString normalizedFragment;
         for (int32_t srcI = 0; srcI < inString.length();) {  // Once per normalization chunk
@@ -1205,7 +1244,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
 
             // Map every position in the normalized chunk to the start of the chunk
             //   in the original input.
-            int32_t fragmentOriginalStart = inputMap.isValid() ?
+            int32_t fragmentOriginalStart = inputMap != nullptr ?
                     inputMap->elementAti(fragmentStartI) : fragmentStartI+rangeStart;
             while (normalizedMap->size() < normalizedInput.length()) {
                 normalizedMap->addElement(fragmentOriginalStart, status);
@@ -1214,14 +1253,21 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                 }
             }
         }
-        U_ASSERT(normalizedMap->size() == normalizedInput.length());
-        int32_t nativeEnd = inputMap.isValid() ?
+        U_ASSERT(U_FAILURE(status) || normalizedMap->size() == normalizedInput.length());
+        int32_t nativeEnd = inputMap != nullptr ?
                 inputMap->elementAti(inString.length()) : inString.length()+rangeStart;
         normalizedMap->addElement(nativeEnd, status);
+        if (normalizedInput.isBogus()) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+        }
+        if (U_FAILURE(status)) {
+            return 0;
+        }
 
-        inputMap = std::move(normalizedMap);
-        inString = std::move(normalizedInput);
+        inputMap = normalizedMap;
+        input = &normalizedInput;
     }
+    const UnicodeString &inString = *input;
 
     int32_t numCodePts = inString.countChar32();
     if (numCodePts != inString.length()) {
@@ -1230,12 +1276,11 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         //   not in terms of code unit string indexes.
         // Use the inputMap mechanism to take care of this in addition to indexing differences
         //    from normalization and/or UTF-8 input.
-        UBool hadExistingMap = inputMap.isValid();
+        UBool hadExistingMap = inputMap != nullptr;
         if (!hadExistingMap) {
-            inputMap.adoptInsteadAndCheckErrorCode(new UVector32(status), status);
-            if (U_FAILURE(status)) {
-                return 0;
-            }
+            // The input is aliased, so the scratch input map is not in use.
+            inputMap = &scratch->fInputMap;
+            inputMap->removeAllElements();
         }
         int32_t cpIdx = 0;
         for (int32_t cuIdx = 0; ; cuIdx = inString.moveIndex32(cuIdx, 1)) {
@@ -1254,28 +1299,33 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                 
     // bestSnlp[i] is the snlp of the best segmentation of the first i
     // code points in the range to be matched.
-    UVector32 bestSnlp(numCodePts + 1, status);
-    bestSnlp.addElement(0, status);
-    for(int32_t i = 1; i <= numCodePts; i++) {
-        bestSnlp.addElement(kuint32max, status);
-    }
-
-
+    // Typical ranges fit into the inline buffers, and longer ones into
+    // the buffers that earlier calls have grown.
+    MaybeStackArray<uint32_t, 64> &bestSnlp = scratch->fBestSnlp;
     // prev[i] is the index of the last CJK code point in the previous word in 
     // the best segmentation of the first i characters.
-    UVector32 prev(numCodePts + 1, status);
+    MaybeStackArray<int32_t, 64> &prev = scratch->fPrev;
+    if ((numCodePts + 1 > bestSnlp.getCapacity() && bestSnlp.resize(numCodePts + 1) == nullptr) ||
+            (numCodePts + 1 > prev.getCapacity() && prev.resize(numCodePts + 1) == nullptr)) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    bestSnlp[0] = 0;
+    for(int32_t i = 1; i <= numCodePts; i++) {
+        bestSnlp[i] = kuint32max;
+    }
     for(int32_t i = 0; i <= numCodePts; i++){
-        prev.addElement(-1, status);
+        prev[i] = -1;
     }
 
+    // A word has at most maxWordSize code points, so there are at most that many matches,
+    // plus the 1-character word that may be added below.
     const int32_t maxWordSize = 20;
-    UVector32 values(numCodePts, status);
-    values.setSize(numCodePts);
-    UVector32 lengths(numCodePts, status);
-    lengths.setSize(numCodePts);
+    int32_t values[maxWordSize + 1];
+    int32_t lengths[maxWordSize + 1];
 
     UText fu = UTEXT_INITIALIZER;
-    utext_openUnicodeString(&fu, &inString, &status);
+    utext_openConstUnicodeString(&fu, &inString, &status);
 
     // Dynamic programming to find the best segmentation.
 
@@ -1285,14 +1335,14 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     int32_t ix = 0;
     bool is_prev_katakana = false;
     for (int32_t i = 0;  i < numCodePts;  ++i, ix = inString.moveIndex32(ix, 1)) {
-        if ((uint32_t)bestSnlp.elementAti(i) == kuint32max) {
+        if (bestSnlp[i] == kuint32max) {
             continue;
         }
 
         int32_t count;
         utext_setNativeIndex(&fu, ix);
-        count = fDictionary->matches(&fu, maxWordSize, numCodePts,
-                             NULL, lengths.getBuffer(), values.getBuffer(), NULL);
+        count = fDictionary->matches(&fu, maxWordSize, maxWordSize,
+                             NULL, lengths, values, NULL);
                              // Note: lengths is filled with code point lengths
                              //       The NULL parameter is the ignored code unit lengths.
 
@@ -1301,18 +1351,18 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         // with the highest value possible, i.e. the least likely to occur.
         // Exclude Korean characters from this treatment, as they should be left
         // together by default.
-        if ((count == 0 || lengths.elementAti(0) != 1) &&
+        if ((count == 0 || lengths[0] != 1) &&
                 !fHangulWordSet.contains(inString.char32At(ix))) {
-            values.setElementAt(maxSnlp, count);   // 255
-            lengths.setElementAt(1, count++);
+            values[count] = maxSnlp;   // 255
+            lengths[count++] = 1;
         }
 
         for (int32_t j = 0; j < count; j++) {
-            uint32_t newSnlp = (uint32_t)bestSnlp.elementAti(i) + (uint32_t)values.elementAti(j);
-            int32_t ln_j_i = lengths.elementAti(j) + i;
-            if (newSnlp < (uint32_t)bestSnlp.elementAti(ln_j_i)) {
-                bestSnlp.setElementAt(newSnlp, ln_j_i);
-                prev.setElementAt(i, ln_j_i);
+            uint32_t newSnlp = bestSnlp[i] + (uint32_t)values[j];
+            int32_t ln_j_i = lengths[j] + i;
+            if (newSnlp < bestSnlp[ln_j_i]) {
+                bestSnlp[ln_j_i] = newSnlp;
+                prev[ln_j_i] = i;
             }
         }
 
@@ -1333,10 +1383,10 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
                 katakanaRunLength++;
             }
             if (katakanaRunLength < kMaxKatakanaGroupLength) {
-                uint32_t newSnlp = bestSnlp.elementAti(i) + getKatakanaCost(katakanaRunLength);
-                if (newSnlp < (uint32_t)bestSnlp.elementAti(i+katakanaRunLength)) {
-                    bestSnlp.setElementAt(newSnlp, i+katakanaRunLength);
-                    prev.setElementAt(i, i+katakanaRunLength);  // prev[j] = i;
+                uint32_t newSnlp = bestSnlp[i] + getKatakanaCost(katakanaRunLength);
+                if (newSnlp < bestSnlp[i+katakanaRunLength]) {
+                    bestSnlp[i+katakanaRunLength] = newSnlp;
+                    prev[i+katakanaRunLength] = i;  // prev[j] = i;
                 }
             }
         }
@@ -1348,11 +1398,13 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     // prev[numCodePts] is guaranteed to be meaningful.
     // We'll first push in the reverse order, i.e.,
     // t_boundary[0] = numCodePts, and afterwards do a swap.
-    UVector32 t_boundary(numCodePts+1, status);
+    UVector32 &t_boundary = scratch->fBoundaries;
+    t_boundary.removeAllElements();
+    t_boundary.ensureCapacity(numCodePts+1, status);
 
     int32_t numBreaks = 0;
     // No segmentation found, set boundary to end of range
-    if ((uint32_t)bestSnlp.elementAti(numCodePts) == kuint32max) {
+    if (bestSnlp[numCodePts] == kuint32max) {
         t_boundary.addElement(numCodePts, status);
         numBreaks++;
     } else if (isPhraseBreaking) {
@@ -1364,7 +1416,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
             int32_t codeUnitIdx = -1;
             int32_t prevCodeUnitIdx = -1;
             int32_t length = -1;
-            for (int32_t i = prev.elementAti(numCodePts); i > 0; i = prev.elementAti(i)) {
+            for (int32_t i = prev[numCodePts]; i > 0; i = prev[i]) {
                 codeUnitIdx = inString.moveIndex32(0, i);
                 prevCodeUnitIdx = inString.moveIndex32(0, prevIdx);
                 // Calculate the length by using the code unit.
@@ -1381,11 +1433,11 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
             }
         }
     } else {
-        for (int32_t i = numCodePts; i > 0; i = prev.elementAti(i)) {
+        for (int32_t i = numCodePts; i > 0; i = prev[i]) {
             t_boundary.addElement(i, status);
             numBreaks++;
         }
-        U_ASSERT(prev.elementAti(t_boundary.elementAti(numBreaks - 1)) == 0);
+        U_ASSERT(prev[t_boundary.elementAti(numBreaks - 1)] == 0);
     }
 
     // Add a break for the start of the dictionary range if there is not one
@@ -1404,7 +1456,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
     for (int32_t i = numBreaks - 1; i >= 0; i--) {
         int32_t cpPos = t_boundary.elementAti(i);
         U_ASSERT(cpPos > prevCPPos);
-        int32_t utextPos =  inputMap.isValid() ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
+        int32_t utextPos =  inputMap != nullptr ? inputMap->elementAti(cpPos) : cpPos + rangeStart;
         U_ASSERT(utextPos >= prevUTextPos);
         if (utextPos > prevUTextPos) {
             // Boundaries are added to foundBreaks output in ascending order.
@@ -1447,8 +1499,7 @@ CjkBreakEngine::divideUpDictionaryRange( UText *inText,
         }
     }
 
-    // inString goes out of scope
-    // inputMap goes out of scope
+    // The scratch buffers keep their capacity for the next call.
     return correctedNumBreaks;
 }
 
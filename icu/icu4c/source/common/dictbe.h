@@ -12,9 +12,11 @@
 
 #include "unicode/utypes.h"
 #include "unicode/uniset.h"
+#include "unicode/unistr.h"
 #include "unicode/utext.h"
 
 #include "brkeng.h"
+#include "cmemory.h"
 #include "hash.h"
 #include "uvectr32.h"
 
@@ -23,6 +25,47 @@ U_NAMESPACE_BEGIN
 class DictionaryMatcher;
 class Normalizer2;
 
+// Windows needs us to DLL-export the MaybeStackArray template specializations,
+// but MacOS X cannot handle it. Same as in charstr.h.
+#if !U_PLATFORM_IS_DARWIN_BASED
+template class U_COMMON_API MaybeStackArray<uint32_t, 64>;
+template class U_COMMON_API MaybeStackArray<int32_t, 64>;
+#endif
+
+/*******************************************************************
+ * BreakEngineScratch
+ */
+
+/**
+ * <p>BreakEngineScratch holds the temporary buffers that the dictionary
+ * break engines use while dividing up a range of text.</p>
+ *
+ * <p>A RuleBasedBreakIterator keeps one for its lifetime and passes it to
+ * every findBreaks() call. Once the buffers have grown to fit the text,
+ * breaking more text of similar length does not allocate memory,
+ * including after setText().</p>
+ */
+class U_COMMON_API BreakEngineScratch : public UMemory {
+ public:
+  BreakEngineScratch(UErrorCode &status);
+  ~BreakEngineScratch();
+
+  // Used by CjkBreakEngine.
+  /** Copy of the range of text if it is not a contiguous UTF-16 chunk. */
+  UnicodeString fText;
+  /** NFKC form of the range of text if it is not normalized. */
+  UnicodeString fNormalizedText;
+  /** Maps indexes in fText (or code point indexes) to native text indexes. */
+  UVector32 fInputMap;
+  /** Maps indexes in fNormalizedText to native text indexes. */
+  UVector32 fNormalizedMap;
+  /** Boundaries of the best segmentation, last one first. */
+  UVector32 fBoundaries;
+  /** Costs and predecessors of the best segmentations of each prefix. */
+  MaybeStackArray<uint32_t, 64> fBestSnlp;
+  MaybeStackArray<int32_t, 64> fPrev;
+};
+
 /*******************************************************************
  * DictionaryBreakEngine
  */
@@ -34,7 +77,7 @@ class Normalizer2;
  * <p>After it is constructed a DictionaryBreakEngine may be shared between
  * threads without synchronization.</p>
  */
-class DictionaryBreakEngine : public LanguageBreakEngine {
+class U_COMMON_API DictionaryBreakEngine : public LanguageBreakEngine {
  private:
     /**
      * The set of characters handled by this engine
@@ -74,6 +117,7 @@ class DictionaryBreakEngine : public LanguageBreakEngine {
    * @param startPos The start of the run within the supplied text.
    * @param endPos The end of the run within the supplied text.
    * @param foundBreaks vector of int32_t to receive the break positions
+   * @param scratch Temporary buffers owned by the caller, or nullptr
    * @param status Information on any errors encountered.
    * @return The number of breaks found.
    */
@@ -82,6 +126,7 @@ class DictionaryBreakEngine : public LanguageBreakEngine {
                               int32_t endPos,
                               UVector32 &foundBreaks,
                               UBool isPhraseBreaking,
+                              BreakEngineScratch *scratch,
                               UErrorCode& status ) const override;
 
  protected:
@@ -100,6 +145,7 @@ class DictionaryBreakEngine : public LanguageBreakEngine {
   * @param rangeStart The start of the range of dictionary characters
   * @param rangeEnd The end of the range of dictionary characters
   * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @param scratch Temporary buffers owned by the caller, or nullptr
   * @param status Information on any errors encountered.
   * @return The number of breaks found
   */
@@ -108,6 +154,7 @@ class DictionaryBreakEngine : public LanguageBreakEngine {
                                            int32_t rangeEnd,
                                            UVector32 &foundBreaks,
                                            UBool isPhraseBreaking,
+                                           BreakEngineScratch *scratch,
                                            UErrorCode& status) const = 0;
 
 };
@@ -159,6 +206,7 @@ class ThaiBreakEngine : public DictionaryBreakEngine {
   * @param rangeStart The start of the range of dictionary characters
   * @param rangeEnd The end of the range of dictionary characters
   * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @param scratch Temporary buffers owned by the caller, or nullptr
   * @param status Information on any errors encountered.
   * @return The number of breaks found
   */
@@ -167,6 +215,7 @@ class ThaiBreakEngine : public DictionaryBreakEngine {
                                            int32_t rangeEnd,
                                            UVector32 &foundBreaks,
                                            UBool isPhraseBreaking,
+                                           BreakEngineScratch *scratch,
                                            UErrorCode& status) const override;
 
 };
@@ -217,6 +266,7 @@ class LaoBreakEngine : public DictionaryBreakEngine {
   * @param rangeStart The start of the range of dictionary characters
   * @param rangeEnd The end of the range of dictionary characters
   * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @param scratch Temporary buffers owned by the caller, or nullptr
   * @param status Information on any errors encountered.
   * @return The number of breaks found
   */
@@ -225,6 +275,7 @@ class LaoBreakEngine : public DictionaryBreakEngine {
                                            int32_t rangeEnd,
                                            UVector32 &foundBreaks,
                                            UBool isPhraseBreaking,
+                                           BreakEngineScratch *scratch,
                                            UErrorCode& status) const override;
 
 };
@@ -275,6 +326,7 @@ class BurmeseBreakEngine : public DictionaryBreakEngine {
   * @param rangeStart The start of the range of dictionary characters
   * @param rangeEnd The end of the range of dictionary characters
   * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @param scratch Temporary buffers owned by the caller, or nullptr
   * @param status Information on any errors encountered.
   * @return The number of breaks found
   */
@@ -283,6 +335,7 @@ class BurmeseBreakEngine : public DictionaryBreakEngine {
                                            int32_t rangeEnd,
                                            UVector32 &foundBreaks,
                                            UBool isPhraseBreaking,
+                                           BreakEngineScratch *scratch,
                                            UErrorCode& status) const override;
 
 };
@@ -333,6 +386,7 @@ class KhmerBreakEngine : public DictionaryBreakEngine {
   * @param rangeStart The start of the range of dictionary characters
   * @param rangeEnd The end of the range of dictionary characters
   * @param foundBreaks Output of C array of int32_t break positions, or 0
+  * @param scratch Temporary buffers owned by the caller, or nullptr
   * @param status Information on any errors encountered.
   * @return The number of breaks found
   */
@@ -341,6 +395,7 @@ class KhmerBreakEngine : public DictionaryBreakEngine {
                                            int32_t rangeEnd,
                                            UVector32 &foundBreaks,
                                            UBool isPhraseBreaking,
+                                           BreakEngineScratch *scratch,
                                            UErrorCode& status) const override;
 
 };
@@ -362,7 +417,7 @@ enum LanguageType {
  * dictionary with costs associated with each word and
  * Viterbi decoding to determine CJK-specific breaks.</p>
  */
-class CjkBreakEngine : public DictionaryBreakEngine {
+class U_COMMON_API CjkBreakEngine : public DictionaryBreakEngine {
  protected:
     /**
      * The set of characters handled by this engine
@@ -409,6 +464,7 @@ class CjkBreakEngine : public DictionaryBreakEngine {
      * @param rangeStart The start of the range of dictionary characters
      * @param rangeEnd The end of the range of dictionary characters
      * @param foundBreaks Output of C array of int32_t break positions, or 0
+     * @param scratch Temporary buffers owned by the caller, or nullptr
      * @param status Information on any errors encountered.
      * @return The number of breaks found
      */
@@ -417,6 +473,7 @@ class CjkBreakEngine : public DictionaryBreakEngine {
           int32_t rangeEnd,
           UVector32 &foundBreaks,
           UBool isPhraseBreaking,
+          BreakEngineScratch *scratch,
           UErrorCode& status) const override;
 
 };
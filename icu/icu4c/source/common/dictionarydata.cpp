@@ -15,6 +15,7 @@
 #include "unicode/ucharstrie.h"
 #include "unicode/bytestrie.h"
 #include "unicode/udata.h"
+#include "unicode/utf8.h"
 #include "cmemory.h"
 
 #if !UCONFIG_NO_BREAK_ITERATION
@@ -23,6 +24,7 @@ U_NAMESPACE_BEGIN
 
 const int32_t  DictionaryData::TRIE_TYPE_BYTES = 0;
 const int32_t  DictionaryData::TRIE_TYPE_UCHARS = 1;
+const int32_t  DictionaryData::TRIE_TYPE_DOUBLE_ARRAY = 2;
 const int32_t  DictionaryData::TRIE_TYPE_MASK = 7;
 const int32_t  DictionaryData::TRIE_HAS_VALUES = 8;
 
@@ -153,6 +155,75 @@ int32_t BytesDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t
     return wordCount;
 }
 
+DoubleArrayDictionaryMatcher::~DoubleArrayDictionaryMatcher() {
+    udata_close(file);
+}
+
+int32_t DoubleArrayDictionaryMatcher::getType() const {
+    return DictionaryData::TRIE_TYPE_DOUBLE_ARRAY;
+}
+
+int32_t DoubleArrayDictionaryMatcher::matches(UText *text, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const {
+    int32_t startingTextIndex = (int32_t)utext_getNativeIndex(text);
+    int32_t wordCount = 0;
+    int32_t codePointsMatched = 0;
+    int32_t node = 0;
+
+    for (UChar32 c = UTEXT_NEXT32(text); c >= 0; c = UTEXT_NEXT32(text)) {
+        int32_t lengthMatched = (int32_t)UTEXT_GETNATIVEINDEX(text) - startingTextIndex;
+        codePointsMatched += 1;
+        uint8_t bytes[U8_MAX_LENGTH];
+        int32_t byteLength = 0;
+        U8_APPEND_UNSAFE(bytes, byteLength, c);
+        int32_t i = 0;
+        do {
+            int32_t base = units[2 * node];
+            if (base < 0) {
+                // The node has no children other than the end of a word.
+                node = -1;
+                break;
+            }
+            int32_t child = base + 1 + bytes[i];
+            if (units[2 * child + 1] != node) {
+                node = -1;
+                break;
+            }
+            node = child;
+        } while (++i < byteLength);
+        if (node < 0) {
+            break;
+        }
+        int32_t base = units[2 * node];
+        int32_t end = base >= 0 ? base : ~base;
+        if (units[2 * end + 1] == node) {
+            if (wordCount < limit) {
+                if (values != NULL) {
+                    values[wordCount] = units[2 * end];
+                }
+                if (lengths != NULL) {
+                    lengths[wordCount] = lengthMatched;
+                }
+                if (cpLengths != NULL) {
+                    cpLengths[wordCount] = codePointsMatched;
+                }
+                ++wordCount;
+            }
+            if (base < 0) {
+                break;
+            }
+        }
+        if (lengthMatched >= maxLength) {
+            break;
+        }
+    }
+
+    if (prefix != NULL) {
+        *prefix = codePointsMatched;
+    }
+    return wordCount;
+}
 
 U_NAMESPACE_END
 
@@ -221,6 +292,8 @@ udict_swap(const UDataSwapper *ds, const void *inData, int32_t length,
 
         if (trieType == DictionaryData::TRIE_TYPE_UCHARS) {
             ds->swapArray16(ds, inBytes + offset, nextOffset - offset, outBytes + offset, pErrorCode);
+        } else if (trieType == DictionaryData::TRIE_TYPE_DOUBLE_ARRAY) {
+            ds->swapArray32(ds, inBytes + offset, nextOffset - offset, outBytes + offset, pErrorCode);
         } else if (trieType == DictionaryData::TRIE_TYPE_BYTES) {
             // nothing to do
         } else {
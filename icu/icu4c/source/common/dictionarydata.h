@@ -33,6 +33,7 @@ class U_COMMON_API DictionaryData : public UMemory {
 public:
     static const int32_t TRIE_TYPE_BYTES; // = 0;
     static const int32_t TRIE_TYPE_UCHARS; // = 1;
+    static const int32_t TRIE_TYPE_DOUBLE_ARRAY; // = 2;
     static const int32_t TRIE_TYPE_MASK; // = 7;
     static const int32_t TRIE_HAS_VALUES; // = 8;
 
@@ -135,6 +136,23 @@ class U_COMMON_API BytesDictionaryMatcher : public DictionaryMatcher {
     UDataMemory *file;
 };
 
+// Implementation of the DictionaryMatcher interface for a double-array trie dictionary
+class U_COMMON_API DoubleArrayDictionaryMatcher : public DictionaryMatcher {
+public:
+    // constructs a new DoubleArrayDictionaryMatcher
+    // units points to the (base, check) pairs of the serialized double array
+    // the UDataMemory * fed in here will be closed on this object's destruction; may be NULL
+    DoubleArrayDictionaryMatcher(const int32_t *u, UDataMemory *f) : units(u), file(f) { }
+    virtual ~DoubleArrayDictionaryMatcher();
+    virtual int32_t matches(UText *text, int32_t maxLength, int32_t limit,
+                            int32_t *lengths, int32_t *cpLengths, int32_t *values,
+                            int32_t *prefix) const override;
+    virtual int32_t getType() const override;
+private:
+    const int32_t *units;
+    UDataMemory *file;
+};
+
 U_NAMESPACE_END
 
 U_CAPI int32_t U_EXPORT2
@@ -144,8 +162,8 @@ udict_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *out
  * Format of dictionary .dict data files.
  * Format version 1.0.
  *
- * A dictionary .dict data file contains a byte-serialized BytesTrie or
- * a UChars-serialized UCharsTrie.
+ * A dictionary .dict data file contains a byte-serialized BytesTrie,
+ * a UChars-serialized UCharsTrie, or a double-array trie.
  * Such files are used in dictionary-based break iteration (DBBI).
  *
  * For a BytesTrie, a transformation type is specified for
@@ -181,10 +199,24 @@ udict_swap(const UDataSwapper *ds, const void *inData, int32_t length, void *out
  *          Code points outside the range offset..(offset+0xff) cannot be mapped
  *          and do not occur in the dictionary.
  *
- * stringTrie; -- a serialized BytesTrie or UCharsTrie
+ * stringTrie; -- a serialized BytesTrie or UCharsTrie, or a double array
  *
  *      The dictionary maps strings to specific values (TRIE_HAS_VALUES bit set in trieType),
  *      or it maps all strings to 0 (TRIE_HAS_VALUES bit not set).
+ *
+ * For TRIE_TYPE_DOUBLE_ARRAY, the trie is an array of units with two int32_t each,
+ * base and check, which is read in place without any decoding.
+ * It maps the UTF-8 form of each word. Unit 0 is the root node.
+ * Node n has a child for byte b at unit t=base[n]+1+b if check[t]==n.
+ * If a word ends at node n, then the unit t=base[n] with check[t]==n
+ * is a terminal unit whose base contains the word's value, for example its cost.
+ * If a word ends at node n and n has no other children, then base[n] is stored as ~base,
+ * so that a match can stop without looking at the next character.
+ * check is -1 for unused units.
+ * The array is padded so that base[n]+257 is always inside it.
+ *
+ * This is larger than a string trie but needs no branch searches or
+ * node decoding while matching, and the word values need no separate lookup.
  */
 
 #endif  /* !UCONFIG_NO_BREAK_ITERATION */
@@ -0,0 +1,464 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// graphemeiter.cpp
+// created: 2026oct17
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/graphemeiter.h"
+#include "unicode/uchar.h"
+#include "unicode/ucpmap.h"
+#include "unicode/ucptrie.h"
+#include "unicode/ugrapheme.h"
+#include "unicode/umutablecptrie.h"
+#include "unicode/uniset.h"
+#include "unicode/uset.h"
+#include "unicode/ustring.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "cstring.h"
+#include "ucln_cmn.h"
+#include "umutex.h"
+
+namespace {
+
+/**
+ * Grapheme cluster break categories of code points, as distinguished by the rules in
+ * data/brkitr/rules/char.txt. Each code point is in exactly one category.
+ */
+enum {
+    GC_OTHER,
+    GC_CR,
+    GC_LF,
+    GC_CONTROL,
+    GC_EXTEND,  // gcb=Extend & ccc=0
+    GC_EXTEND_CCC,  // gcb=Extend & ccc!=0, except GC_VIRAMA
+    GC_VIRAMA,  // conjunct-forming virama, gcb=Extend & ccc!=0
+    GC_ZWJ,
+    GC_REGIONAL_INDICATOR,
+    GC_PREPEND,
+    GC_SPACING_MARK,
+    GC_L,
+    GC_V,
+    GC_T,
+    GC_LV,
+    GC_LVT,
+    GC_EXTENDED_PICT,  // gcb=Other & Extended_Pictographic
+    GC_LINKING_CONSONANT  // gcb=Other
+};
+
+UCPTrie *gTrie = nullptr;
+icu::UInitOnce gTrieInitOnce {};
+
+UBool U_CALLCONV grapheme_cleanup() {
+    ucptrie_close(gTrie);
+    gTrie = nullptr;
+    gTrieInitOnce.reset();
+    return true;
+}
+
+uint8_t getCategory(uint32_t gcb) {
+    switch (gcb) {
+    case U_GCB_CR: return GC_CR;
+    case U_GCB_LF: return GC_LF;
+    case U_GCB_CONTROL: return GC_CONTROL;
+    case U_GCB_EXTEND: return GC_EXTEND;
+    case U_GCB_ZWJ: return GC_ZWJ;
+    case U_GCB_REGIONAL_INDICATOR: return GC_REGIONAL_INDICATOR;
+    case U_GCB_PREPEND: return GC_PREPEND;
+    case U_GCB_SPACING_MARK: return GC_SPACING_MARK;
+    case U_GCB_L: return GC_L;
+    case U_GCB_V: return GC_V;
+    case U_GCB_T: return GC_T;
+    case U_GCB_LV: return GC_LV;
+    case U_GCB_LVT: return GC_LVT;
+    default: return GC_OTHER;
+    }
+}
+
+/** Sets the category for the code points in the set that currently have the base category. */
+void setCategory(UMutableCPTrie *mutableTrie, const icu::UnicodeSet &set,
+                 uint8_t base, uint8_t category, UErrorCode &errorCode) {
+    for (int32_t i = 0; i < set.getRangeCount(); ++i) {
+        UChar32 end = set.getRangeEnd(i);
+        for (UChar32 c = set.getRangeStart(i); c <= end; ++c) {
+            if (umutablecptrie_get(mutableTrie, c) == base) {
+                umutablecptrie_set(mutableTrie, c, category, &errorCode);
+            }
+        }
+    }
+}
+
+void U_CALLCONV initTrie(UErrorCode &errorCode) {
+    ucln_common_registerCleanup(UCLN_COMMON_GRAPHEME, grapheme_cleanup);
+    icu::LocalUMutableCPTriePointer mutableTrie(umutablecptrie_open(GC_OTHER, GC_OTHER, &errorCode));
+    const UCPMap *gcbMap = u_getIntPropertyMap(UCHAR_GRAPHEME_CLUSTER_BREAK, &errorCode);
+    const icu::UnicodeSet *extPict = icu::UnicodeSet::fromUSet(
+        u_getBinaryPropertySet(UCHAR_EXTENDED_PICTOGRAPHIC, &errorCode));
+    // Same sets as $Virama and $LinkingConsonant in char.txt.
+    icu::UnicodeSet virama(icu::UnicodeString(
+        u"[\\p{Gujr}\\p{sc=Telu}\\p{sc=Mlym}\\p{sc=Orya}\\p{sc=Beng}\\p{sc=Deva}"
+        u"&\\p{Indic_Syllabic_Category=Virama}]"), errorCode);
+    icu::UnicodeSet linkingConsonant(icu::UnicodeString(
+        u"[\\p{Gujr}\\p{sc=Telu}\\p{sc=Mlym}\\p{sc=Orya}\\p{sc=Beng}\\p{sc=Deva}"
+        u"&\\p{Indic_Syllabic_Category=Consonant}]"), errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+
+    UChar32 start = 0, end;
+    uint32_t value;
+    while ((end = ucpmap_getRange(gcbMap, start, UCPMAP_RANGE_NORMAL, 0,
+                                  nullptr, nullptr, &value)) >= 0) {
+        uint8_t category = getCategory(value);
+        if (category != GC_OTHER) {
+            umutablecptrie_setRange(mutableTrie.getAlias(), start, end, category, &errorCode);
+        }
+        if (category == GC_EXTEND) {
+            for (UChar32 c = start; c <= end; ++c) {
+                if (u_getIntPropertyValue(c, UCHAR_CANONICAL_COMBINING_CLASS) != 0) {
+                    umutablecptrie_set(mutableTrie.getAlias(), c, GC_EXTEND_CCC, &errorCode);
+                }
+            }
+        }
+        start = end + 1;
+    }
+    setCategory(mutableTrie.getAlias(), *extPict, GC_OTHER, GC_EXTENDED_PICT, errorCode);
+    setCategory(mutableTrie.getAlias(), virama, GC_EXTEND_CCC, GC_VIRAMA, errorCode);
+    setCategory(mutableTrie.getAlias(), linkingConsonant, GC_OTHER, GC_LINKING_CONSONANT, errorCode);
+    gTrie = umutablecptrie_buildImmutable(mutableTrie.getAlias(), UCPTRIE_TYPE_FAST,
+                                          UCPTRIE_VALUE_BITS_8, &errorCode);
+}
+
+const UCPTrie *getTrie(UErrorCode &errorCode) {
+    umtx_initOnce(gTrieInitOnce, &initTrie, errorCode);
+    return gTrie;
+}
+
+/**
+ * Context within one grapheme cluster, for deciding whether
+ * the next code point continues it.
+ */
+class GraphemeState {
+public:
+    explicit GraphemeState(uint8_t category) : prev(GC_OTHER), riCount(0),
+            emoji(EMOJI_NONE), conjunct(CONJUNCT_NONE) {
+        add(category);
+    }
+
+    /**
+     * Returns true if there is a boundary before a code point with the category.
+     * Otherwise adds it to the cluster.
+     */
+    bool isBoundaryBefore(uint8_t category) {
+        if (!continuesCluster(category)) {
+            return true;
+        }
+        add(category);
+        return false;
+    }
+
+private:
+    enum { EMOJI_NONE, EMOJI_PICT, EMOJI_ZWJ };  // after ExtPict Extend*, after ExtPict Extend* ZWJ
+    enum { CONJUNCT_NONE, CONJUNCT_CONSONANT, CONJUNCT_VIRAMA };  // after LinkingConsonant ExtCccZwj*, with a Virama
+
+    bool continuesCluster(uint8_t c) const {
+        switch (prev) {
+        case GC_CR: return c == GC_LF;  // GB3, GB4
+        case GC_LF:
+        case GC_CONTROL: return false;  // GB4
+        default: break;
+        }
+        switch (c) {
+        case GC_CR:
+        case GC_LF:
+        case GC_CONTROL: return false;  // GB5
+        case GC_EXTEND:
+        case GC_EXTEND_CCC:
+        case GC_VIRAMA:
+        case GC_ZWJ:
+        case GC_SPACING_MARK: return true;  // GB9, GB9a
+        default: break;
+        }
+        if (prev == GC_PREPEND) { return true; }  // GB9b
+        switch (c) {
+        case GC_L:
+        case GC_LV:
+        case GC_LVT: return prev == GC_L;  // GB6
+        case GC_V: return prev == GC_L || prev == GC_LV || prev == GC_V;  // GB6, GB7
+        case GC_T: return prev == GC_LV || prev == GC_V || prev == GC_LVT || prev == GC_T;  // GB7, GB8
+        case GC_EXTENDED_PICT: return emoji == EMOJI_ZWJ;  // GB11
+        case GC_REGIONAL_INDICATOR: return (riCount & 1) != 0;  // GB12, GB13
+        case GC_LINKING_CONSONANT: return conjunct == CONJUNCT_VIRAMA;  // ICU tailoring
+        default: return false;
+        }
+    }
+
+    void add(uint8_t c) {
+        riCount = c == GC_REGIONAL_INDICATOR ? riCount + 1 : 0;
+        switch (c) {
+        case GC_EXTEND:
+            if (emoji == EMOJI_ZWJ) { emoji = EMOJI_NONE; }
+            conjunct = CONJUNCT_NONE;
+            break;
+        case GC_EXTEND_CCC:
+            if (emoji == EMOJI_ZWJ) { emoji = EMOJI_NONE; }
+            break;
+        case GC_VIRAMA:
+            if (emoji == EMOJI_ZWJ) { emoji = EMOJI_NONE; }
+            if (conjunct != CONJUNCT_NONE) { conjunct = CONJUNCT_VIRAMA; }
+            break;
+        case GC_ZWJ:
+            emoji = emoji == EMOJI_PICT ? EMOJI_ZWJ : EMOJI_NONE;
+            break;
+        case GC_EXTENDED_PICT:
+            emoji = EMOJI_PICT;
+            conjunct = CONJUNCT_NONE;
+            break;
+        case GC_LINKING_CONSONANT:
+            emoji = EMOJI_NONE;
+            conjunct = CONJUNCT_CONSONANT;
+            break;
+        default:
+            emoji = EMOJI_NONE;
+            conjunct = CONJUNCT_NONE;
+            break;
+        }
+        prev = c;
+    }
+
+    uint8_t prev;
+    int32_t riCount;  // number of consecutive Regional_Indicator code points up to prev
+    uint8_t emoji;
+    uint8_t conjunct;
+};
+
+// Code points below U+0300 are only in the categories Other, CR, LF, Control and ExtPict.
+// There is a boundary between any two of them except for CR LF.
+constexpr UChar32 MIN_COMBINING_CP = 0x300;
+constexpr uint8_t MIN_COMBINING_LEAD_BYTE = 0xcc;  // U8_LEAD(MIN_COMBINING_CP)
+
+int32_t nextBoundary(const UCPTrie *trie, const char16_t *s, int32_t start, int32_t length) {
+    const char16_t *p = s + start;
+    const char16_t *limit = s + length;
+    if (p == limit) { return length; }
+    UChar32 c;
+    uint8_t category;
+    UCPTRIE_FAST_U16_NEXT(trie, UCPTRIE_8, p, limit, c, category);
+    GraphemeState state(category);
+    while (p != limit) {
+        if (c < MIN_COMBINING_CP && *p < MIN_COMBINING_CP && !(c == 0xd && *p == 0xa)) {
+            break;
+        }
+        const char16_t *cpStart = p;
+        UCPTRIE_FAST_U16_NEXT(trie, UCPTRIE_8, p, limit, c, category);
+        if (state.isBoundaryBefore(category)) {
+            p = cpStart;
+            break;
+        }
+    }
+    return (int32_t)(p - s);
+}
+
+int32_t nextBoundary(const UCPTrie *trie, const uint8_t *s, int32_t start, int32_t length) {
+    const uint8_t *p = s + start;
+    const uint8_t *limit = s + length;
+    if (p == limit) { return length; }
+    uint8_t lead = *p;
+    uint8_t category;
+    UCPTRIE_FAST_U8_NEXT(trie, UCPTRIE_8, p, limit, category);
+    GraphemeState state(category);
+    while (p != limit) {
+        // Other bytes below the lead byte limit (trail bytes, C0, C1) are ill-formed,
+        // and each such byte is in category Other.
+        uint8_t b = *p;
+        if (lead < MIN_COMBINING_LEAD_BYTE && b < MIN_COMBINING_LEAD_BYTE && !(lead == 0xd && b == 0xa)) {
+            break;
+        }
+        const uint8_t *cpStart = p;
+        lead = b;
+        UCPTRIE_FAST_U8_NEXT(trie, UCPTRIE_8, p, limit, category);
+        if (state.isBoundaryBefore(category)) {
+            p = cpStart;
+            break;
+        }
+    }
+    return (int32_t)(p - s);
+}
+
+template<typename Unit>
+int32_t countClusters(const UCPTrie *trie, const Unit *s, int32_t length) {
+    int32_t count = 0;
+    for (int32_t i = 0; i < length; i = nextBoundary(trie, s, i, length)) {
+        ++count;
+    }
+    return count;
+}
+
+template<typename Unit>
+int32_t truncateClusters(const UCPTrie *trie, const Unit *s, int32_t length, int32_t maxCount) {
+    int32_t i = 0;
+    for (; maxCount > 0 && i < length; --maxCount) {
+        i = nextBoundary(trie, s, i, length);
+    }
+    return i;
+}
+
+/**
+ * Checks the arguments, resolves length<0 for a NUL-terminated string,
+ * and returns the trie, or nullptr if there is an error.
+ */
+const UCPTrie *getTrie(const char16_t *s, int32_t &length, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    if (s == nullptr ? length != 0 : length < -1) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    if (length < 0) {
+        length = u_strlen(s);
+    }
+    return getTrie(errorCode);
+}
+
+const UCPTrie *getTrie(const char *s, int32_t &length, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    if (s == nullptr ? length != 0 : length < -1) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return nullptr;
+    }
+    if (length < 0) {
+        length = static_cast<int32_t>(uprv_strlen(s));
+    }
+    return getTrie(errorCode);
+}
+
+}  // namespace
+
+U_NAMESPACE_BEGIN
+
+GraphemeClusterIterator::GraphemeClusterIterator(ConstChar16Ptr s, int32_t length,
+                                                 UErrorCode &errorCode)
+        : trie(nullptr), s16(s), s8(nullptr), length(length), index(0) {
+    trie = getTrie(s16, this->length, errorCode);
+    if (U_FAILURE(errorCode)) {
+        this->length = 0;
+    }
+}
+
+GraphemeClusterIterator::GraphemeClusterIterator(StringPiece s, UErrorCode &errorCode)
+        : trie(nullptr), s16(nullptr), s8(s.data()), length(s.length()), index(0) {
+    trie = getTrie(errorCode);
+    if (U_FAILURE(errorCode)) {
+        length = 0;
+    }
+}
+
+int32_t GraphemeClusterIterator::next() {
+    if (index >= length) {
+        return DONE;
+    }
+    if (s16 != nullptr) {
+        index = nextBoundary(trie, s16, index, length);
+    } else {
+        index = nextBoundary(trie, reinterpret_cast<const uint8_t *>(s8), index, length);
+    }
+    return index;
+}
+
+int32_t GraphemeClusterIterator::count(ConstChar16Ptr s, int32_t length, UErrorCode &errorCode) {
+    const char16_t *p = s;
+    const UCPTrie *trie = getTrie(p, length, errorCode);
+    if (U_FAILURE(errorCode)) { return 0; }
+    return countClusters(trie, p, length);
+}
+
+int32_t GraphemeClusterIterator::count(StringPiece s, UErrorCode &errorCode) {
+    const UCPTrie *trie = getTrie(errorCode);
+    if (U_FAILURE(errorCode)) { return 0; }
+    return countClusters(trie, reinterpret_cast<const uint8_t *>(s.data()), s.length());
+}
+
+int32_t GraphemeClusterIterator::truncate(ConstChar16Ptr s, int32_t length, int32_t maxCount,
+                                          UErrorCode &errorCode) {
+    const char16_t *p = s;
+    const UCPTrie *trie = getTrie(p, length, errorCode);
+    if (U_FAILURE(errorCode)) { return 0; }
+    if (maxCount < 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return truncateClusters(trie, p, length, maxCount);
+}
+
+int32_t GraphemeClusterIterator::truncate(StringPiece s, int32_t maxCount, UErrorCode &errorCode) {
+    const UCPTrie *trie = getTrie(errorCode);
+    if (U_FAILURE(errorCode)) { return 0; }
+    if (maxCount < 0) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return truncateClusters(trie, reinterpret_cast<const uint8_t *>(s.data()), s.length(), maxCount);
+}
+
+U_NAMESPACE_END
+
+U_CAPI int32_t U_EXPORT2
+ugrapheme_next(const UChar *s, int32_t start, int32_t length, UErrorCode *pErrorCode) {
+    const UCPTrie *trie = getTrie(s, length, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    if (start < 0 || start > length) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return nextBoundary(trie, s, start, length);
+}
+
+U_CAPI int32_t U_EXPORT2
+ugrapheme_nextUTF8(const char *s, int32_t start, int32_t length, UErrorCode *pErrorCode) {
+    const UCPTrie *trie = getTrie(s, length, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    if (start < 0 || start > length) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return nextBoundary(trie, reinterpret_cast<const uint8_t *>(s), start, length);
+}
+
+U_CAPI int32_t U_EXPORT2
+ugrapheme_count(const UChar *s, int32_t length, UErrorCode *pErrorCode) {
+    const UCPTrie *trie = getTrie(s, length, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    return countClusters(trie, s, length);
+}
+
+U_CAPI int32_t U_EXPORT2
+ugrapheme_countUTF8(const char *s, int32_t length, UErrorCode *pErrorCode) {
+    const UCPTrie *trie = getTrie(s, length, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    return countClusters(trie, reinterpret_cast<const uint8_t *>(s), length);
+}
+
+U_CAPI int32_t U_EXPORT2
+ugrapheme_truncate(const UChar *s, int32_t length, int32_t maxCount, UErrorCode *pErrorCode) {
+    const UCPTrie *trie = getTrie(s, length, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    if (maxCount < 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return truncateClusters(trie, s, length, maxCount);
+}
+
+U_CAPI int32_t U_EXPORT2
+ugrapheme_truncateUTF8(const char *s, int32_t length, int32_t maxCount, UErrorCode *pErrorCode) {
+    const UCPTrie *trie = getTrie(s, length, *pErrorCode);
+    if (U_FAILURE(*pErrorCode)) { return 0; }
+    if (maxCount < 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    return truncateClusters(trie, reinterpret_cast<const uint8_t *>(s), length, maxCount);
+}
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
@@ -16,6 +16,7 @@
 #include "uassert.h"
 #include "ubrkimpl.h"
 #include "uresimp.h"
+#include "usimd.h"
 #include "uvectr32.h"
 #include "uvector.h"
 
@@ -99,6 +100,8 @@ class ConstArray1D : public ReadArray1D {
         return data_[i];
     }
 
+    inline const float* data() const { return data_; }
+
 private:
     const float* data_;
     int32_t d1_;
@@ -145,6 +148,11 @@ class ConstArray2D : public ReadArray2D {
         return ConstArray1D(data_ + i * d2_, d2_);
     }
 
+    inline const float* rowData(int32_t i) const {
+        U_ASSERT(i < d1_);
+        return data_ + i * d2_;
+    }
+
 private:
     const float* data_;
     int32_t d1_;
@@ -155,6 +163,36 @@ ConstArray2D::~ConstArray2D()
 {
 }
 
+/**
+ * Adds scale * src[i] to dest[i] for i in [0, length[.
+ * The vector code multiplies and adds separately like the scalar code,
+ * so that the results do not depend on the instruction set.
+ */
+static inline void addScaled(float* dest, const float* src, float scale, int32_t length) {
+    int32_t i = 0;
+#if U_SIMD_SSE2
+    const __m128 s = _mm_set1_ps(scale);
+    for (; (length - i) >= 8; i += 8) {
+        __m128 d0 = _mm_add_ps(_mm_loadu_ps(dest + i), _mm_mul_ps(s, _mm_loadu_ps(src + i)));
+        __m128 d1 = _mm_add_ps(_mm_loadu_ps(dest + i + 4), _mm_mul_ps(s, _mm_loadu_ps(src + i + 4)));
+        _mm_storeu_ps(dest + i, d0);
+        _mm_storeu_ps(dest + i + 4, d1);
+    }
+    if ((length - i) >= 4) {
+        _mm_storeu_ps(dest + i, _mm_add_ps(_mm_loadu_ps(dest + i), _mm_mul_ps(s, _mm_loadu_ps(src + i))));
+        i += 4;
+    }
+#elif U_SIMD_NEON
+    const float32x4_t s = vdupq_n_f32(scale);
+    for (; (length - i) >= 4; i += 4) {
+        vst1q_f32(dest + i, vaddq_f32(vld1q_f32(dest + i), vmulq_f32(s, vld1q_f32(src + i))));
+    }
+#endif
+    for (; i < length; i++) {
+        dest[i] += scale * src[i];
+    }
+}
+
 /**
  * A class to allocate data as a writable 1D array.
  * This is the main class implement matrix operation.
@@ -210,13 +248,13 @@ class Array1D : public ReadArray1D {
     }
 
     // Add dot product of a 1D array and a 2D array into this one.
-    inline Array1D& addDotProduct(const ReadArray1D& a, const ReadArray2D& b) {
+    // Goes through b row by row, so that the inner loop reads contiguous memory.
+    // Each data_[i] still sums up the products in the order of j.
+    inline Array1D& addDotProduct(const ReadArray1D& a, const ConstArray2D& b) {
         U_ASSERT(a.d1() == b.d1());
         U_ASSERT(b.d2() == d1());
-        for (int32_t i = 0; i < d1(); i++) {
-            for (int32_t j = 0; j < a.d1(); j++) {
-                data_[i] += a.get(j) * b.get(j, i);
-            }
+        for (int32_t j = 0; j < a.d1(); j++) {
+            addScaled(data_, b.rowData(j), a.get(j), d1_);
         }
         return *this;
     }
@@ -371,14 +409,20 @@ struct LSTMData : public UMemory {
     ConstArray1D fBackwardB;
     ConstArray2D fOutputW;
     ConstArray1D fOutputB;
+    // The input part of the LSTM gates, b + x * W, for each row x of fEmbedding.
+    // Computed as a batch when loading, so that each character
+    // only needs the product with the hidden state.
+    ConstArray2D fForwardXWB;
+    ConstArray2D fBackwardXWB;
 
 private:
     UResourceBundle* fBundle;
+    float* fXWBMemory;
 };
 
 LSTMData::LSTMData(UResourceBundle* rb, UErrorCode &status)
     : fDict(nullptr), fType(UNKNOWN), fName(nullptr),
-      fBundle(rb)
+      fBundle(rb), fXWBMemory(nullptr)
 {
     if (U_FAILURE(status)) {
         return;
@@ -462,11 +506,29 @@ LSTMData::LSTMData(UResourceBundle* rb, UErrorCode &status)
     fOutputW.init(data, 2 * hunits, 4);
     data += mat8_size;
     fOutputB.init(data, 4);
+
+    int32_t xwbSize = (num_index + 1) * 4 * hunits;
+    fXWBMemory = static_cast<float*>(uprv_malloc(2 * xwbSize * sizeof(float)));
+    if (fXWBMemory == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    fForwardXWB = ConstArray2D(fXWBMemory, num_index + 1, 4 * hunits);
+    fBackwardXWB = ConstArray2D(fXWBMemory + xwbSize, num_index + 1, 4 * hunits);
+    for (int32_t i = 0; i <= num_index; i++) {
+        Array1D(fXWBMemory + i * 4 * hunits, 4 * hunits)
+            .assign(fForwardB)
+            .addDotProduct(fEmbedding.row(i), fForwardW);
+        Array1D(fXWBMemory + xwbSize + i * 4 * hunits, 4 * hunits)
+            .assign(fBackwardB)
+            .addDotProduct(fEmbedding.row(i), fBackwardW);
+    }
 }
 
 LSTMData::~LSTMData() {
     uhash_close(fDict);
     ures_close(fBundle);
+    uprv_free(fXWBMemory);
 }
 
 class Vectorizer : public UMemory {
@@ -602,18 +664,18 @@ void GraphemeClusterVectorizer::vectorize(
 
 // Computing LSTM as stated in
 // https://en.wikipedia.org/wiki/Long_short-term_memory#LSTM_with_a_forget_gate
+// xwb is the precomputed x * W + b for the input x.
 // ifco is temp array allocate outside which does not need to be
 // input/output value but could avoid unnecessary memory alloc/free if passing
 // in.
 void compute(
     int32_t hunits,
-    const ReadArray2D& W, const ReadArray2D& U, const ReadArray1D& b,
-    const ReadArray1D& x, Array1D& h, Array1D& c,
+    const ReadArray1D& xwb, const ConstArray2D& U,
+    Array1D& h, Array1D& c,
     Array1D& ifco)
 {
     // ifco = x * W + h * U + b
-    ifco.assign(b)
-        .addDotProduct(x, W)
+    ifco.assign(xwb)
         .addDotProduct(h, U);
 
     ifco.slice(0*hunits, hunits).sigmoid();  // i: sigmod
@@ -640,6 +702,7 @@ LSTMBreakEngine::divideUpDictionaryRange( UText *text,
                                                 int32_t endPos,
                                                 UVector32 &foundBreaks,
                                                 UBool /* isPhraseBreaking */,
+                                                BreakEngineScratch * /* scratch */,
                                                 UErrorCode& status) const {
     if (U_FAILURE(status)) return 0;
     int32_t beginFoundBreakSize = foundBreaks.size();
@@ -696,8 +759,7 @@ LSTMBreakEngine::divideUpDictionaryRange( UText *text,
         fData->fEmbedding.row(indicesBuf[i]).print();
 #endif  // LSTM_DEBUG
         compute(hunits,
-                fData->fBackwardW, fData->fBackwardU, fData->fBackwardB,
-                fData->fEmbedding.row(indicesBuf[i]),
+                fData->fBackwardXWB.row(indicesBuf[i]), fData->fBackwardU,
                 hRow, c, ifco);
     }
 
@@ -717,8 +779,7 @@ LSTMBreakEngine::divideUpDictionaryRange( UText *text,
         // Calculate the result into forwardRow, which point to the data in the first half
         // of fbRow.
         compute(hunits,
-                fData->fForwardW, fData->fForwardU, fData->fForwardB,
-                fData->fEmbedding.row(indicesBuf[i]),
+                fData->fForwardXWB.row(indicesBuf[i]), fData->fForwardU,
                 forwardRow, c, ifco);
 
         // assign the data from hBackward.row(i) to second half of fbRowa.
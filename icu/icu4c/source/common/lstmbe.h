@@ -55,6 +55,7 @@ class LSTMBreakEngine : public DictionaryBreakEngine {
      * @param rangeStart The start of the range of dictionary characters
      * @param rangeEnd The end of the range of dictionary characters
      * @param foundBreaks Output of C array of int32_t break positions, or 0
+     * @param scratch Temporary buffers owned by the caller, or nullptr
      * @param status Information on any errors encountered.
      * @return The number of breaks found
      */
@@ -63,6 +64,7 @@ class LSTMBreakEngine : public DictionaryBreakEngine {
                                              int32_t rangeEnd,
                                              UVector32 &foundBreaks,
                                              UBool isPhraseBreaking,
+                                             BreakEngineScratch *scratch,
                                              UErrorCode& status) const override;
 private:
     const LSTMData* fData;
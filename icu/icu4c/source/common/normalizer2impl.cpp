@@ -38,6 +38,7 @@
 #include "normalizer2impl.h"
 #include "putilimp.h"
 #include "uassert.h"
+#include "usimd.h"
 #include "ucptrie_impl.h"
 #include "uset_imp.h"
 #include "uvector.h"
@@ -605,7 +606,9 @@ Normalizer2Impl::decompose(const UChar *src, const UChar *limit,
 
     for(;;) {
         // count code units below the minimum or with irrelevant data for the quick check
-        for(prevSrc=src; src!=limit;) {
+        prevSrc=src;
+        src=SIMDUtil::spanBelow(src, limit, minDecompNoCP);
+        while(src!=limit) {
             if( (c=*src)<minNoCP ||
                 isMostDecompYesAndZeroCC(norm16=UCPTRIE_FAST_BMP_GET(normTrie, UCPTRIE_16, c))
             ) {
@@ -752,6 +755,7 @@ Normalizer2Impl::decomposeUTF8(uint32_t options,
         const uint8_t *fastStart = src;
         const uint8_t *prevSrc;
         uint16_t norm16 = 0;
+        src = SIMDUtil::spanBelow(src, limit, minNoLead);
 
         for (;;) {
             if (src == limit) {
@@ -1466,6 +1470,7 @@ Normalizer2Impl::compose(const UChar *src, const UChar *limit,
         const UChar *prevSrc;
         UChar32 c = 0;
         uint16_t norm16 = 0;
+        src = SIMDUtil::spanBelow(src, limit, minCompNoMaybeCP);
         for (;;) {
             if (src == limit) {
                 if (prevBoundary != limit && doCompose) {
@@ -1730,6 +1735,7 @@ Normalizer2Impl::composeQuickCheck(const UChar *src, const UChar *limit,
         const UChar *prevSrc;
         UChar32 c = 0;
         uint16_t norm16 = 0;
+        src = SIMDUtil::spanBelow(src, limit, minCompNoMaybeCP);
         for (;;) {
             if(src==limit) {
                 return src;
@@ -1877,6 +1883,7 @@ Normalizer2Impl::composeUTF8(uint32_t options, UBool onlyContiguous,
         // or with (compYes && ccc==0) properties.
         const uint8_t *prevSrc;
         uint16_t norm16 = 0;
+        src = SIMDUtil::spanBelow(src, limit, minNoMaybeLead);
         for (;;) {
             if (src == limit) {
                 if (prevBoundary != limit && sink != nullptr) {
@@ -82,6 +82,29 @@ RuleBasedBreakIterator::RuleBasedBreakIterator(RBBIDataHeader* data, UErrorCode
     }
 }
 
+/**
+ * Constructs a RuleBasedBreakIterator that uses shared tables.
+ * Adopts one reference to the RBBIDataWrapper.
+ */
+RuleBasedBreakIterator::RuleBasedBreakIterator(RBBIDataWrapper* data, UErrorCode &status)
+ : fSCharIter(UnicodeString())
+{
+    init(status);
+    if (U_FAILURE(status)) {
+        data->removeReference();
+        return;
+    }
+    fData = data;
+    if (fData->fForwardTable->fLookAheadResultsSize > 0) {
+        fLookAheadMatches = static_cast<int32_t *>(
+            uprv_malloc(fData->fForwardTable->fLookAheadResultsSize * sizeof(int32_t)));
+        if (fLookAheadMatches == nullptr) {
+            status = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+}
+
 //-------------------------------------------------------------------------------
 //
 //   Constructor   from a UDataMemory handle to precompiled break rules
@@ -263,10 +286,34 @@ RuleBasedBreakIterator::operator=(const RuleBasedBreakIterator& that) {
 
     if (fLanguageBreakEngines != NULL) {
         delete fLanguageBreakEngines;
-        fLanguageBreakEngines = NULL;   // Just rebuild for now
+        fLanguageBreakEngines = NULL;
     }
-    // TODO: clone fLanguageBreakEngines from "that"
+    delete fUnhandledBreakEngine;
+    fUnhandledBreakEngine = NULL;
     UErrorCode status = U_ZERO_ERROR;
+    // The dictionary and LSTM engines are immutable and owned by the factory,
+    // so the new iterator shares them rather than looking them up again.
+    // The UnhandledEngine is mutable and per iterator; it is re-created when needed.
+    if (that.fLanguageBreakEngines != NULL) {
+        int32_t count = that.fLanguageBreakEngines->size();
+        if (count > 1 || (count == 1 && that.fUnhandledBreakEngine == NULL)) {
+            fLanguageBreakEngines = new UStack(status);
+            if (fLanguageBreakEngines != NULL && U_SUCCESS(status)) {
+                for (int32_t i = 0; i < count; ++i) {
+                    void *lbe = that.fLanguageBreakEngines->elementAt(i);
+                    if (lbe != that.fUnhandledBreakEngine) {
+                        fLanguageBreakEngines->push(lbe, status);
+                    }
+                }
+            }
+            if (U_FAILURE(status)) {
+                // Just rebuild when needed.
+                delete fLanguageBreakEngines;
+                fLanguageBreakEngines = NULL;
+                status = U_ZERO_ERROR;
+            }
+        }
+    }
     utext_clone(&fText, &that.fText, false, true, &status);
 
     if (fCharIter != &fSCharIter) {
@@ -820,6 +867,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
     const char         *tableData          = statetable->fTableData;
     uint32_t            tableRowLen        = statetable->fRowLen;
     uint32_t            dictStart          = statetable->fDictCategoriesStart;
+    const uint16_t     *latin1Categories   = fData->fLatin1Categories;
     #ifdef RBBI_DEBUG
         if (gTrace) {
             RBBIDebugPuts("Handle Next   pos   char  state category");
@@ -880,7 +928,7 @@ int32_t RuleBasedBreakIterator::handleNext() {
         if (mode == RBBI_RUN) {
             // look up the current character's character category, which tells us
             // which column in the state table to look at.
-            category = trieFunc(fData->fTrie, c);
+            category = c < 0x100 ? latin1Categories[c] : trieFunc(fData->fTrie, c);
             fDictionaryCharCount += (category >= dictStart);
         }
 
@@ -1027,7 +1075,7 @@ int32_t RuleBasedBreakIterator::handleSafePrevious(int32_t fromPosition) {
         // which column in the state table to look at.
         //
         //  Off the dictionary flag bit. For reverse iteration it is not used.
-        category = trieFunc(fData->fTrie, c);
+        category = c < 0x100 ? fData->fLatin1Categories[c] : trieFunc(fData->fTrie, c);
 
         #ifdef RBBI_DEBUG
             if (gTrace) {
@@ -1108,6 +1156,201 @@ int32_t RuleBasedBreakIterator::getRuleStatusVec(
 }
 
 
+//-------------------------------------------------------------------------------
+//
+//   fillBoundaries()   Bulk version of next().
+//                      Boundaries already in the break cache are taken from it.
+//                      Beyond it, the rules are run directly, without adding each
+//                      boundary to the cache; the logic mirrors
+//                      BreakCache::populateFollowing(). Afterwards the cache is
+//                      reset to the final position.
+//
+//-------------------------------------------------------------------------------
+int32_t RuleBasedBreakIterator::fillBoundaries(int32_t *boundaries, int32_t *ruleStatuses,
+                                               int32_t capacity, UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (capacity < 0 || (boundaries == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const int32_t *ruleStatusTable = fData->fRuleStatusTable;
+    UBool cacheInSync = true;
+    int32_t length = 0;
+    while (length < capacity) {
+        if (cacheInSync && !fBreakCache->isAtEnd()) {
+            fBreakCache->next();
+        } else {
+            cacheInSync = false;
+            fDone = false;
+            int32_t fromPosition = fPosition;
+            int32_t fromRuleStatusIdx = fRuleStatusIndex;
+            int32_t pos = 0;
+            int32_t ruleStatusIdx = 0;
+            if (fDictionaryCache->following(fromPosition, &pos, &ruleStatusIdx)) {
+                fPosition = pos;
+                fRuleStatusIndex = ruleStatusIdx;
+            } else if (handleNext() != UBRK_DONE && fDictionaryCharCount > 0) {
+                // handleNext() left fPosition and fRuleStatusIndex at the rule based boundary.
+                // Subdivide the segment, as in populateFollowing().
+                fDictionaryCache->populateDictionary(fromPosition, fPosition,
+                                                     fromRuleStatusIdx, fRuleStatusIndex);
+                if (fDictionaryCache->following(fromPosition, &pos, &ruleStatusIdx)) {
+                    fPosition = pos;
+                    fRuleStatusIndex = ruleStatusIdx;
+                }
+            }
+        }
+        if (fDone) {
+            break;
+        }
+        boundaries[length] = fPosition;
+        if (ruleStatuses != nullptr) {
+            ruleStatuses[length] = ruleStatusTable[fRuleStatusIndex + ruleStatusTable[fRuleStatusIndex]];
+        }
+        ++length;
+    }
+    if (!cacheInSync) {
+        fBreakCache->reset(fPosition, fRuleStatusIndex);
+    }
+    if (length > 0) {
+        fDone = false;
+    }
+    return length;
+}
+
+
+//-------------------------------------------------------------------------------
+//
+//   updateBoundaries()   Re-segment the text around an edit.
+//
+//          A boundary from which the rules find the same following boundaries
+//          in the old and in the new text is one where the text that follows
+//          is the same, and which is not inside a run of dictionary text,
+//          since a dictionary break engine divides up a whole run at once.
+//          Before the edit, back up with preceding() to such a boundary;
+//          after the edit, continue with next() until reaching one.
+//
+//-------------------------------------------------------------------------------
+namespace {
+
+/** Returns the index of the first of the boundaries that is >= pos. */
+int32_t findBoundary(const int32_t *boundaries, int32_t length, int32_t pos) {
+    int32_t start = 0;
+    while (start < length) {
+        int32_t i = (start + length) / 2;
+        if (boundaries[i] < pos) {
+            start = i + 1;
+        } else {
+            length = i;
+        }
+    }
+    return start;
+}
+
+}  // namespace
+
+UBool RuleBasedBreakIterator::isDictionaryCharBefore(int32_t pos) {
+    UTEXT_SETNATIVEINDEX(&fText, pos);
+    UChar32 c = UTEXT_PREVIOUS32(&fText);
+    return ucptrie_get(fData->fTrie, c) >= fData->fForwardTable->fDictCategoriesStart;
+}
+
+int32_t RuleBasedBreakIterator::updateBoundaries(int32_t editStart, int32_t oldEditLimit,
+                                                 int32_t newEditLimit,
+                                                 int32_t *boundaries, int32_t *ruleStatuses,
+                                                 int32_t length, int32_t capacity,
+                                                 UErrorCode &status) {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    int64_t textLength = utext_nativeLength(&fText);
+    int32_t delta = newEditLimit - oldEditLimit;
+    if (length < 0 || capacity < length || (boundaries == nullptr && capacity > 0) ||
+            editStart < 0 || oldEditLimit < editStart || newEditLimit < editStart ||
+            newEditLimit > textLength ||
+            (length > 0 && boundaries[length - 1] + (int64_t)delta != textLength)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+
+    // Keep the old boundaries up to the start boundary.
+    int32_t keep = 0;
+    if (editStart == 0) {
+        first();
+    } else {
+        int32_t pos = preceding(editStart);
+        while (pos > 0) {
+            int32_t i = findBoundary(boundaries, length, pos);
+            if (i < length && boundaries[i] == pos && !isDictionaryCharBefore(pos)) {
+                keep = i + 1;
+                break;
+            }
+            pos = preceding(pos);
+        }
+    }
+
+    // Segment the new text from there up to a boundary after the edit
+    // that is also an old one, or up to the end of the text.
+    // The rule status of a boundary is that of the segment before it,
+    // so the status of that last boundary is also a new one.
+    int32_t oldIndex = keep;
+    MaybeStackArray<int32_t, 40> newBoundaries;
+    MaybeStackArray<int32_t, 40> newStatuses;
+    int32_t newLength = 0;
+    int32_t pos;
+    UBool isSync = false;
+    while (!isSync && (pos = next()) != UBRK_DONE) {
+        if (pos > newEditLimit) {
+            while (oldIndex < length && boundaries[oldIndex] + delta < pos) {
+                ++oldIndex;
+            }
+            if (oldIndex < length && boundaries[oldIndex] + delta == pos &&
+                    (pos == textLength || !isDictionaryCharBefore(pos))) {
+                isSync = true;
+                ++oldIndex;
+            }
+        }
+        if (newLength == newBoundaries.getCapacity()) {
+            if (newBoundaries.resize(newLength * 2, newLength) == nullptr ||
+                    (ruleStatuses != nullptr && newStatuses.resize(newLength * 2, newLength) == nullptr)) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return 0;
+            }
+        }
+        newBoundaries[newLength] = pos;
+        if (ruleStatuses != nullptr) {
+            newStatuses[newLength] = getRuleStatus();
+        }
+        ++newLength;
+    }
+    if (!isSync) {
+        oldIndex = length;
+    }
+
+    int32_t tailLength = length - oldIndex;
+    int32_t resultLength = keep + newLength + tailLength;
+    if (resultLength > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+        return resultLength;
+    }
+    int32_t *tail = boundaries + keep + newLength;
+    uprv_memmove(tail, boundaries + oldIndex, tailLength * 4);
+    if (delta != 0) {
+        for (int32_t i = 0; i < tailLength; ++i) {
+            tail[i] += delta;
+        }
+    }
+    uprv_memcpy(boundaries + keep, newBoundaries.getAlias(), newLength * 4);
+    if (ruleStatuses != nullptr) {
+        uprv_memmove(ruleStatuses + keep + newLength, ruleStatuses + oldIndex, tailLength * 4);
+        uprv_memcpy(ruleStatuses + keep, newStatuses.getAlias(), newLength * 4);
+    }
+    return resultLength;
+}
+
+
 
 //-------------------------------------------------------------------------------
 //
@@ -14,6 +14,7 @@
 
 #include "brkeng.h"
 #include "cmemory.h"
+#include "dictbe.h"
 #include "rbbidata.h"
 #include "rbbirb.h"
 #include "uassert.h"
@@ -27,10 +28,12 @@ U_NAMESPACE_BEGIN
 
 RuleBasedBreakIterator::DictionaryCache::DictionaryCache(RuleBasedBreakIterator *bi, UErrorCode &status) :
         fBI(bi), fBreaks(status), fPositionInCache(-1),
-        fStart(0), fLimit(0), fFirstRuleStatusIndex(0), fOtherRuleStatusIndex(0) {
+        fStart(0), fLimit(0), fFirstRuleStatusIndex(0), fOtherRuleStatusIndex(0),
+        fScratch(nullptr) {
 }
 
 RuleBasedBreakIterator::DictionaryCache::~DictionaryCache() {
+    delete fScratch;
 }
 
 void RuleBasedBreakIterator::DictionaryCache::reset() {
@@ -160,10 +163,23 @@ void RuleBasedBreakIterator::DictionaryCache::populateDictionary(int32_t startPo
         // to deal with it.
         const LanguageBreakEngine *lbe = fBI->getLanguageBreakEngine(c);
 
+        // The engines' temporary buffers live here so that they are reused
+        // for all of the text that this iterator breaks.
+        if (lbe != NULL && fScratch == nullptr) {
+            fScratch = new BreakEngineScratch(status);
+            if (fScratch == nullptr) {
+                status = U_MEMORY_ALLOCATION_ERROR;
+            } else if (U_FAILURE(status)) {
+                delete fScratch;
+                fScratch = nullptr;
+            }
+        }
+
         // Ask the language object if there are any breaks. It will add them to the cache and
         // leave the text pointer on the other side of its range, ready to search for the next one.
-        if (lbe != NULL) {
-            foundBreakCount += lbe->findBreaks(text, rangeStart, rangeEnd, fBreaks, fBI->fIsPhraseBreaking, status);
+        if (lbe != NULL && U_SUCCESS(status)) {
+            foundBreakCount += lbe->findBreaks(text, rangeStart, rangeEnd, fBreaks, fBI->fIsPhraseBreaking,
+                                               fScratch, status);
         }
 
         // Reload the loop variables for the next go-round
@@ -17,6 +17,8 @@
 
 U_NAMESPACE_BEGIN
 
+class BreakEngineScratch;
+
 /* DictionaryCache  stores the boundaries obtained from a run of dictionary characters.
  *                 Dictionary boundaries are moved first to this cache, then from here
  *                 to the main BreakCache, where they may inter-leave with non-dictionary
@@ -64,6 +66,8 @@ class RuleBasedBreakIterator::DictionaryCache: public UMemory {
                                                 //    text segment being handled by the dictionary.
     int32_t             fFirstRuleStatusIndex;  // Rule status info for first boundary.
     int32_t             fOtherRuleStatusIndex;  // Rule status info for 2nd through last boundaries.
+    BreakEngineScratch *fScratch;               // Buffers for the break engines, kept across texts.
+                                                //    Allocated on first use.
 };
 
 
@@ -101,6 +105,9 @@ class RuleBasedBreakIterator::BreakCache: public UMemory {
     void        nextOL();
     void        previous(UErrorCode &status);
 
+    /** Returns true if next() has to add to the cache. */
+    UBool       isAtEnd() const { return fBufIdx == fEndBufIdx; }
+
     // Move the iteration state to the position following the startPosition.
     // Input position must be pinned to the input length.
     void        following(int32_t startPosition, UErrorCode &status);
@@ -0,0 +1,245 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// file: rbbi_parallel.cpp
+//
+//   RuleBasedBreakIterator::getAllBoundaries(), segmenting a text on multiple threads.
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/rbbi.h"
+#include "unicode/ucptrie.h"
+#include "unicode/utext.h"
+
+#include "cmemory.h"
+#include "rbbidata.h"
+#include "uparallel.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Shorter texts per thread are not worth starting a thread.
+constexpr int32_t MIN_CHARS_PER_THREAD = 16384;
+constexpr int32_t MAX_THREADS = U_PARALLEL_MAX_THREADS;
+// Number of boundaries fetched at a time with fillBoundaries().
+constexpr int32_t BATCH_SIZE = 256;
+
+/**
+ * One worker's part of the text.
+ * The worker starts at the first boundary after start and stops
+ * with the first batch of boundaries that reaches beyond limit,
+ * so that its boundaries overlap with those of the next chunk.
+ */
+struct SegmentChunk : public UMemory {
+    LocalPointer<RuleBasedBreakIterator> bi;
+    int32_t start;
+    int32_t limit;  // -1 for the last chunk
+    UBool withStatuses;
+    MaybeStackArray<int32_t, BATCH_SIZE> boundaries;
+    MaybeStackArray<int32_t, BATCH_SIZE> statuses;
+    int32_t length;
+    UBool atEnd;  // true if the boundaries reach the end of the text
+    UErrorCode errorCode;
+};
+
+void segmentChunk(SegmentChunk &chunk) {
+    RuleBasedBreakIterator &bi = *chunk.bi;
+    UErrorCode &errorCode = chunk.errorCode;
+    chunk.length = 0;
+    chunk.atEnd = false;
+    if (chunk.start == 0) {
+        bi.first();
+    } else if (bi.following(chunk.start) == UBRK_DONE) {
+        chunk.atEnd = true;
+        return;
+    } else {
+        chunk.boundaries[0] = bi.current();
+        chunk.statuses[0] = bi.getRuleStatus();
+        chunk.length = 1;
+    }
+    for (;;) {
+        int32_t capacity = chunk.boundaries.getCapacity();
+        if (chunk.length + BATCH_SIZE > capacity) {
+            capacity *= 2;
+            if (chunk.boundaries.resize(capacity, chunk.length) == nullptr ||
+                    (chunk.withStatuses && chunk.statuses.resize(capacity, chunk.length) == nullptr)) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+        }
+        int32_t n = bi.fillBoundaries(chunk.boundaries.getAlias() + chunk.length,
+                                      chunk.withStatuses ? chunk.statuses.getAlias() + chunk.length : nullptr,
+                                      BATCH_SIZE, errorCode);
+        if (U_FAILURE(errorCode)) {
+            return;
+        }
+        if (n == 0) {
+            chunk.atEnd = true;
+            return;
+        }
+        chunk.length += n;
+        if (chunk.limit >= 0 && chunk.boundaries[chunk.length - 1] > chunk.limit) {
+            return;
+        }
+    }
+}
+
+/** Collects the results, counting but not writing those beyond the capacity. */
+struct BoundarySink {
+    int32_t *boundaries;
+    int32_t *ruleStatuses;
+    int32_t capacity;
+    int32_t length;
+
+    void append(int32_t boundary, int32_t ruleStatus) {
+        if (length < capacity) {
+            boundaries[length] = boundary;
+            if (ruleStatuses != nullptr) {
+                ruleStatuses[length] = ruleStatus;
+            }
+        }
+        ++length;
+    }
+};
+
+}  // namespace
+
+int32_t RuleBasedBreakIterator::getAllBoundaries(UText *text, int32_t *boundaries, int32_t *ruleStatuses,
+                                                 int32_t capacity, int32_t numThreads,
+                                                 UErrorCode &status) const {
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    if (text == nullptr || capacity < 0 || (boundaries == nullptr && capacity > 0)) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    int64_t textLength = utext_nativeLength(text);
+    if (textLength > INT32_MAX) {
+        status = U_INDEX_OUTOFBOUNDS_ERROR;
+        return 0;
+    }
+    if (numThreads <= 0) {
+        numThreads = uprv_getNumberOfProcessors();
+    }
+    int32_t maxThreads = (int32_t)(textLength / MIN_CHARS_PER_THREAD);
+    if (maxThreads > MAX_THREADS) { maxThreads = MAX_THREADS; }
+    if (numThreads > maxThreads) { numThreads = maxThreads > 0 ? maxThreads : 1; }
+
+    LocalArray<SegmentChunk> chunks(new SegmentChunk[numThreads]);
+    if (chunks.isNull()) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return 0;
+    }
+    // The clones and their shallow UText clones are made on this thread,
+    // so that the workers only read the shared text.
+    for (int32_t i = 0; i < numThreads; ++i) {
+        SegmentChunk &chunk = chunks[i];
+        chunk.bi.adoptInsteadAndCheckErrorCode(clone(), status);
+        if (U_FAILURE(status)) {
+            return 0;
+        }
+        chunk.bi->setText(text, status);
+        chunk.start = (int32_t)((textLength * i) / numThreads);
+        chunk.limit = i + 1 < numThreads ? (int32_t)((textLength * (i + 1)) / numThreads) : -1;
+        chunk.withStatuses = ruleStatuses != nullptr;
+        chunk.errorCode = U_ZERO_ERROR;
+    }
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    runInParallel(segmentChunk, chunks.getAlias(), numThreads);
+    for (int32_t i = 0; i < numThreads; ++i) {
+        if (U_FAILURE(chunks[i].errorCode)) {
+            status = chunks[i].errorCode;
+            return 0;
+        }
+    }
+
+    // Join the chunks. The boundaries of the first chunk are the same as from a single thread.
+    // Take the boundaries from one chunk until one of them is also a boundary of the next chunk,
+    // and continue with the next chunk after it.
+    // From a boundary where neither adjacent character is handled by a dictionary,
+    // all following boundaries depend only on the text after it, not on where
+    // the iteration started. At other boundaries, the next chunk may have
+    // started inside a run of dictionary text that it segments differently.
+    // If a chunk's boundaries end before such a common one, its break iterator
+    // continues on this thread.
+    LocalUTextPointer ut(utext_clone(nullptr, text, false, true, &status));
+    if (U_FAILURE(status)) {
+        return 0;
+    }
+    const UCPTrie *trie = fData->fTrie;
+    uint32_t dictStart = fData->fForwardTable->fDictCategoriesStart;
+    BoundarySink sink = { boundaries, ruleStatuses, capacity, 0 };
+    int32_t src = 0;  // The chunk whose boundaries are being copied.
+    int32_t srcIndex = 0;
+    RuleBasedBreakIterator *live = nullptr;  // Continues chunk src beyond its boundaries.
+    int32_t dest = 1;  // The next chunk to join.
+    int32_t destIndex = 0;
+    for (;;) {
+        int32_t boundary;
+        int32_t ruleStatus;
+        if (live == nullptr) {
+            SegmentChunk &chunk = chunks[src];
+            if (srcIndex < chunk.length) {
+                boundary = chunk.boundaries[srcIndex];
+                ruleStatus = chunk.withStatuses ? chunk.statuses[srcIndex] : 0;
+                ++srcIndex;
+            } else if (chunk.atEnd) {
+                break;
+            } else {
+                live = chunk.bi.getAlias();
+                continue;
+            }
+        } else {
+            boundary = live->next();
+            if (boundary == UBRK_DONE) {
+                break;
+            }
+            ruleStatus = live->getRuleStatus();
+        }
+        sink.append(boundary, ruleStatus);
+
+        while (dest < numThreads) {
+            SegmentChunk &next = chunks[dest];
+            while (destIndex < next.length && next.boundaries[destIndex] < boundary) {
+                ++destIndex;
+            }
+            if (destIndex == next.length) {
+                // All of the next chunk's boundaries are before this one. Skip the chunk.
+                ++dest;
+                destIndex = 0;
+                continue;
+            }
+            if (next.boundaries[destIndex] == boundary) {
+                UBool isSafe = boundary == textLength;
+                if (!isSafe) {
+                    UTEXT_SETNATIVEINDEX(ut.getAlias(), boundary);
+                    UChar32 after = UTEXT_CURRENT32(ut.getAlias());
+                    UChar32 before = UTEXT_PREVIOUS32(ut.getAlias());
+                    isSafe = ucptrie_get(trie, before) < dictStart && ucptrie_get(trie, after) < dictStart;
+                }
+                if (isSafe) {
+                    src = dest;
+                    srcIndex = destIndex + 1;
+                    live = nullptr;
+                    ++dest;
+                    destIndex = 0;
+                }
+            }
+            break;
+        }
+    }
+    if (sink.length > capacity) {
+        status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return sink.length;
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
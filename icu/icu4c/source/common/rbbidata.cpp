@@ -66,6 +66,14 @@ RBBIDataWrapper::RBBIDataWrapper(UDataMemory* udm, UErrorCode &status) {
     fUDataMem = udm;
 }
 
+// For data inside a memory-mapped file without an ICU data header.
+// The UDataMemory is adopted even if the data is not valid.
+RBBIDataWrapper::RBBIDataWrapper(UDataMemory* udm, const RBBIDataHeader *data, UErrorCode &status) {
+    init0();
+    fUDataMem = udm;
+    init(data, status);
+}
+
 UBool RBBIDataWrapper::isDataVersionAcceptable(const UVersionInfo version) {
     return RBBI_DATA_FORMAT_VERSION[0] == version[0];
 }
@@ -125,6 +133,9 @@ void RBBIDataWrapper::init(const RBBIDataHeader *data, UErrorCode &status) {
         status = U_INVALID_FORMAT_ERROR;
         return;
     }
+    for (UChar32 c = 0; c < UPRV_LENGTHOF(fLatin1Categories); ++c) {
+        fLatin1Categories[c] = (uint16_t)ucptrie_get(fTrie, c);
+    }
 
     fRuleSource   = ((char *)data + fHeader->fRuleSource);
     fRuleString = UnicodeString::fromUTF8(StringPiece(fRuleSource, fHeader->fRuleSourceLen));
@@ -163,6 +163,7 @@ class RBBIDataWrapper : public UMemory {
     RBBIDataWrapper(const RBBIDataHeader *data, UErrorCode &status);
     RBBIDataWrapper(const RBBIDataHeader *data, enum EDontAdopt dontAdopt, UErrorCode &status);
     RBBIDataWrapper(UDataMemory* udm, UErrorCode &status);
+    RBBIDataWrapper(UDataMemory* udm, const RBBIDataHeader *data, UErrorCode &status);
     ~RBBIDataWrapper();
 
     static UBool          isDataVersionAcceptable(const UVersionInfo version);
@@ -191,6 +192,10 @@ class RBBIDataWrapper : public UMemory {
 
     UCPTrie             *fTrie;
 
+    /* Character categories of the Latin-1 code points, copied from the trie.
+     * Used by the break iterators to avoid trie lookups for the most common characters. */
+    uint16_t            fLatin1Categories[0x100];
+
 private:
     u_atomic_int32_t    fRefCount;
     UDataMemory        *fUDataMem;
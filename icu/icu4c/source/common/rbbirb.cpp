@@ -34,6 +34,7 @@
 #include "rbbisetb.h"
 #include "rbbitblb.h"
 #include "rbbidata.h"
+#include "rbbirulecache.h"
 #include "uassert.h"
 
 
@@ -244,6 +245,48 @@ RBBIRuleBuilder::createRuleBasedBreakIterator( const UnicodeString    &rules,
                                     UParseError      *parseError,
                                     UErrorCode       &status)
 {
+    return createRuleBasedBreakIterator(rules, nullptr, parseError, status);
+}
+
+BreakIterator *
+RBBIRuleBuilder::createRuleBasedBreakIterator( const UnicodeString    &rules,
+                                    const char       *cacheDir,
+                                    UParseError      *parseError,
+                                    UErrorCode       &status)
+{
+    if (U_FAILURE(status)) {
+        return nullptr;
+    }
+    UBool useCacheDir = cacheDir != nullptr && *cacheDir != 0;
+
+    //
+    // Look for previously compiled rules, first in this process, then in the cache directory.
+    //
+    RBBIDataWrapper *cachedData = RBBIRuleCache::get(rules);
+    if (cachedData == nullptr && useCacheDir) {
+        cachedData = RBBIRuleCache::load(cacheDir, rules, status);
+        if (U_FAILURE(status)) {
+            return nullptr;
+        }
+        if (cachedData != nullptr) {
+            RBBIRuleCache::put(rules, cachedData);
+        }
+    }
+    if (cachedData != nullptr) {
+        if (parseError) {
+            uprv_memset(parseError, 0, sizeof(UParseError));
+        }
+        RuleBasedBreakIterator *bi = new RuleBasedBreakIterator(cachedData, status);
+        if (bi == nullptr) {
+            cachedData->removeReference();
+            status = U_MEMORY_ALLOCATION_ERROR;
+        } else if (U_FAILURE(status)) {
+            delete bi;
+            bi = nullptr;
+        }
+        return bi;
+    }
+
     //
     // Read the input rules, generate a parse tree, symbol table,
     // and list of all Unicode Sets referenced by the rules.
@@ -272,6 +315,12 @@ RBBIRuleBuilder::createRuleBasedBreakIterator( const UnicodeString    &rules,
     else if(This == NULL) { // test for NULL
         status = U_MEMORY_ALLOCATION_ERROR;
     }
+    else {
+        RBBIRuleCache::put(rules, This->fData);
+        if (useCacheDir) {
+            RBBIRuleCache::write(cacheDir, rules, *This->fData);
+        }
+    }
     return This;
 }
 
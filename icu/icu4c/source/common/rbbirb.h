@@ -116,6 +116,15 @@ class RBBIRuleBuilder : public UMemory {
                                     UParseError      *parseError,
                                     UErrorCode       &status);
 
+    //  Same, but previously compiled rules are also looked up in, and newly
+    //   compiled rules written to, cache files in cacheDir if it is not NULL or empty.
+    //   In either case, compiled rules are shared through a process-wide cache.
+    //
+    static BreakIterator * createRuleBasedBreakIterator( const UnicodeString    &rules,
+                                    const char       *cacheDir,
+                                    UParseError      *parseError,
+                                    UErrorCode       &status);
+
 public:
     // The "public" functions and data members that appear below are accessed
     //  (and shared) by the various parts that make up the rule builder.  They
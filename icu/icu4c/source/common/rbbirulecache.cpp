@@ -0,0 +1,315 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// file: rbbirulecache.cpp
+//
+// Caches of compiled break rules.
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+#include <stdio.h>
+
+#include "unicode/udata.h"
+#include "unicode/uversion.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "mutex.h"
+#include "putilimp.h"
+#include "rbbidata.h"
+#include "rbbirulecache.h"
+#include "ucln_cmn.h"
+#include "udatamem.h"
+#include "umapfile.h"
+#include "umutex.h"
+#include "ustr_imp.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Process cache. The entries array is allocated on first use.
+
+constexpr int32_t MAX_CACHED_RULES = 32;
+
+struct RuleCacheEntry : public UMemory {
+    UnicodeString rules;
+    int32_t hash = 0;
+    RBBIDataWrapper *data = nullptr;
+    uint32_t lastUse = 0;
+};
+
+UMutex gRuleCacheMutex;
+RuleCacheEntry *gRuleCache = nullptr;
+int32_t gRuleCacheLength = 0;
+uint32_t gRuleCacheUseCount = 0;
+
+inline int32_t hashRules(const UnicodeString &rules) {
+    return ustr_hashUCharsN(rules.getBuffer(), rules.length());
+}
+
+/** Returns the entry for the rules, or nullptr. Must be called with the mutex held. */
+RuleCacheEntry *findEntry(const UnicodeString &rules, int32_t hash) {
+    for (int32_t i = 0; i < gRuleCacheLength; ++i) {
+        RuleCacheEntry &entry = gRuleCache[i];
+        if (entry.hash == hash && entry.rules == rules) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+}  // namespace
+
+U_NAMESPACE_END
+
+U_CDECL_BEGIN
+static UBool U_CALLCONV rbbiRuleCacheCleanup() {
+    for (int32_t i = 0; i < icu::gRuleCacheLength; ++i) {
+        icu::gRuleCache[i].data->removeReference();
+    }
+    delete[] icu::gRuleCache;
+    icu::gRuleCache = nullptr;
+    icu::gRuleCacheLength = 0;
+    icu::gRuleCacheUseCount = 0;
+    return true;
+}
+U_CDECL_END
+
+U_NAMESPACE_BEGIN
+
+RBBIDataWrapper *RBBIRuleCache::get(const UnicodeString &rules) {
+    int32_t hash = hashRules(rules);
+    Mutex lock(&gRuleCacheMutex);
+    RuleCacheEntry *entry = findEntry(rules, hash);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+    entry->lastUse = ++gRuleCacheUseCount;
+    return entry->data->addReference();
+}
+
+void RBBIRuleCache::put(const UnicodeString &rules, RBBIDataWrapper *data) {
+    int32_t hash = hashRules(rules);
+    Mutex lock(&gRuleCacheMutex);
+    if (gRuleCache == nullptr) {
+        gRuleCache = new RuleCacheEntry[MAX_CACHED_RULES];
+        if (gRuleCache == nullptr) {
+            return;
+        }
+        ucln_common_registerCleanup(UCLN_COMMON_RBBI_RULE_CACHE, rbbiRuleCacheCleanup);
+    }
+    if (findEntry(rules, hash) != nullptr) {
+        // Another thread built the same rules at the same time.
+        return;
+    }
+    RuleCacheEntry *entry;
+    if (gRuleCacheLength < MAX_CACHED_RULES) {
+        entry = &gRuleCache[gRuleCacheLength];
+    } else {
+        entry = &gRuleCache[0];
+        for (int32_t i = 1; i < gRuleCacheLength; ++i) {
+            if (gRuleCache[i].lastUse < entry->lastUse) {
+                entry = &gRuleCache[i];
+            }
+        }
+        entry->data->removeReference();
+        entry->data = nullptr;
+        // Move the last entry into the evicted one's place, and set up the new one at the end.
+        *entry = gRuleCache[--gRuleCacheLength];
+        entry = &gRuleCache[gRuleCacheLength];
+    }
+    entry->rules = rules;
+    if (entry->rules.isBogus()) {
+        return;
+    }
+    entry->hash = hash;
+    entry->data = data->addReference();
+    entry->lastUse = ++gRuleCacheUseCount;
+    ++gRuleCacheLength;
+}
+
+#if !UCONFIG_NO_FILE_IO
+
+namespace {
+
+/*
+ * Cache file format, in the platform's endianness:
+ *
+ * int32_t indexes[IX_COUNT];
+ * char16_t rules[indexes[IX_RULES_LENGTH]];
+ * zero padding up to indexes[IX_DATA_OFFSET] which is a multiple of 16;
+ * uint8_t data[indexes[IX_DATA_LENGTH]];  // as from RuleBasedBreakIterator::getBinaryRules()
+ */
+enum {
+    IX_MAGIC,
+    IX_ICU_VERSION,  // UVersionInfo bytes
+    IX_RULES_LENGTH,
+    IX_DATA_OFFSET,
+    IX_DATA_LENGTH,
+    IX_RESERVED_5,
+    IX_RESERVED_6,
+    IX_RESERVED_7,
+    IX_COUNT
+};
+
+constexpr int32_t CACHE_MAGIC = 0x5542724b;  // "UBrK"
+
+inline int32_t getDataOffset(int32_t rulesLength) {
+    return (IX_COUNT * 4 + rulesLength * 2 + 15) & ~15;
+}
+
+/** Returns true if each section of the data lies within its fLength bytes. */
+bool areSectionsInBounds(const RBBIDataHeader &header) {
+    const uint32_t sections[][2] = {
+        { header.fFTable, header.fFTableLen },
+        { header.fRTable, header.fRTableLen },
+        { header.fTrie, header.fTrieLen },
+        { header.fRuleSource, header.fRuleSourceLen },
+        { header.fStatusTable, header.fStatusTableLen }
+    };
+    for (const uint32_t *section : sections) {
+        if (section[0] > header.fLength || section[1] > header.fLength - section[0]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int32_t getICUVersion() {
+    UVersionInfo version;
+    u_getVersion(version);
+    int32_t result;
+    uprv_memcpy(&result, version, 4);
+    return result;
+}
+
+void getCachePath(const char *cacheDir, const UnicodeString &rules,
+                  CharString &path, UErrorCode &status) {
+    static const char hexDigits[] = "0123456789abcdef";
+    uint32_t hash = hashRules(rules);
+    path.append(cacheDir, status).ensureEndsWithFileSeparator(status);
+    path.append("ubrk" U_ICU_VERSION_SHORT "_", status);
+    for (int32_t shift = 28; shift >= 0; shift -= 4) {
+        path.append(hexDigits[(hash >> shift) & 0xf], status);
+    }
+    path.append(".brk", status);
+}
+
+}  // namespace
+
+RBBIDataWrapper *RBBIRuleCache::load(const char *cacheDir, const UnicodeString &rules,
+                                     UErrorCode &status) {
+    CharString path;
+    getCachePath(cacheDir, rules, path, status);
+    if (U_FAILURE(status)) { return nullptr; }
+    LocalUDataMemoryPointer memory(UDataMemory_createNewInstance(&status));
+    if (U_FAILURE(status)) { return nullptr; }
+    UDataMemory mapped;
+    UErrorCode mapStatus = U_ZERO_ERROR;
+    if (!uprv_mapFile(&mapped, path.data(), &mapStatus)) { return nullptr; }
+    // Hand the mapping to the heap instance, which the RBBIDataWrapper adopts.
+    memory->pHeader = mapped.pHeader;
+    memory->mapAddr = mapped.mapAddr;
+    memory->map = mapped.map;
+    memory->length = mapped.length;
+
+    // A crash or a full disk can leave a truncated file behind,
+    // so all of the offsets and lengths below are bounded by the mapped length.
+    int32_t mapLength = uprv_getMappedFileLength(memory.getAlias());
+    int32_t rulesLength = rules.length();
+    if (mapLength < IX_COUNT * 4 || rulesLength > (mapLength - IX_COUNT * 4) / 2) {
+        return nullptr;
+    }
+    // The Windows mapping sets only pHeader, not mapAddr.
+    const int32_t *indexes = reinterpret_cast<const int32_t *>(memory->pHeader);
+    int32_t dataOffset = getDataOffset(rulesLength);
+    if (!(indexes[IX_MAGIC] == CACHE_MAGIC &&
+            indexes[IX_ICU_VERSION] == getICUVersion() &&
+            indexes[IX_RULES_LENGTH] == rulesLength &&
+            indexes[IX_DATA_OFFSET] == dataOffset &&
+            dataOffset <= mapLength &&
+            indexes[IX_DATA_LENGTH] >= (int32_t)sizeof(RBBIDataHeader) &&
+            indexes[IX_DATA_LENGTH] <= mapLength - dataOffset)) {
+        return nullptr;
+    }
+    // Different rules may have the same hash.
+    const char16_t *cachedRules = reinterpret_cast<const char16_t *>(indexes + IX_COUNT);
+    if (rulesLength > 0 && uprv_memcmp(cachedRules, rules.getBuffer(), rulesLength * 2) != 0) {
+        return nullptr;
+    }
+    const RBBIDataHeader *header = reinterpret_cast<const RBBIDataHeader *>(
+        reinterpret_cast<const char *>(indexes) + dataOffset);
+    if (header->fLength != (uint32_t)indexes[IX_DATA_LENGTH] || !areSectionsInBounds(*header)) {
+        return nullptr;
+    }
+    UErrorCode dataStatus = U_ZERO_ERROR;
+    RBBIDataWrapper *data = new RBBIDataWrapper(memory.getAlias(), header, dataStatus);
+    if (data == nullptr) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return nullptr;
+    }
+    memory.orphan();
+    if (U_FAILURE(dataStatus)) {
+        // For example, the data format changed without an ICU version change.
+        if (dataStatus == U_MEMORY_ALLOCATION_ERROR) {
+            status = dataStatus;
+        }
+        delete data;
+        return nullptr;
+    }
+    return data;
+}
+
+void RBBIRuleCache::write(const char *cacheDir, const UnicodeString &rules,
+                          const RBBIDataWrapper &data) {
+    UErrorCode status = U_ZERO_ERROR;
+    CharString path;
+    getCachePath(cacheDir, rules, path, status);
+    const RBBIDataHeader *header = data.fHeader;
+    int32_t length = header->fLength;
+    int32_t rulesLength = rules.length();
+    int32_t dataOffset = getDataOffset(rulesLength);
+    int32_t indexes[IX_COUNT] = {
+        CACHE_MAGIC, getICUVersion(), rulesLength, dataOffset, length, 0, 0, 0
+    };
+    static const char padding[16] = { 0 };
+    size_t paddingLength = dataOffset - (IX_COUNT * 4 + rulesLength * 2);
+
+    // Concurrent writers, also in other processes, each write their own temporary file
+    // and then atomically rename it to the cache file.
+    CharString tempPath;
+    tempPath.append(path, status).append('.', status);
+    tempPath.appendNumber(static_cast<int32_t>(reinterpret_cast<uintptr_t>(&tempPath)), status);
+    tempPath.append('.', status);
+    tempPath.appendNumber(static_cast<int32_t>(
+        static_cast<int64_t>(uprv_getRawUTCtime()) & 0x7fffffff), status);
+    tempPath.append(".tmp", status);
+    if (U_FAILURE(status)) { return; }
+    FILE *f = fopen(tempPath.data(), "wbx");
+    if (f == nullptr) { return; }
+    bool ok =
+        fwrite(indexes, 4, IX_COUNT, f) == IX_COUNT &&
+        fwrite(rules.getBuffer(), 2, rulesLength, f) == static_cast<size_t>(rulesLength) &&
+        fwrite(padding, 1, paddingLength, f) == paddingLength &&
+        fwrite(header, 1, length, f) == static_cast<size_t>(length);
+    ok = fclose(f) == 0 && ok;
+    if (!ok || rename(tempPath.data(), path.data()) != 0) {
+        remove(tempPath.data());
+    }
+}
+
+#else  // UCONFIG_NO_FILE_IO
+
+RBBIDataWrapper *RBBIRuleCache::load(const char *, const UnicodeString &, UErrorCode &) {
+    return nullptr;
+}
+
+void RBBIRuleCache::write(const char *, const UnicodeString &, const RBBIDataWrapper &) {}
+
+#endif  // UCONFIG_NO_FILE_IO
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
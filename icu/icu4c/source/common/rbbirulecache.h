@@ -0,0 +1,72 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// file: rbbirulecache.h
+//
+// Caches of compiled break rules, so that RuleBasedBreakIterators for
+// the same rule string share one compiled copy instead of each running
+// the rule builder.
+
+#ifndef RBBIRULECACHE_H
+#define RBBIRULECACHE_H
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/unistr.h"
+
+U_NAMESPACE_BEGIN
+
+class RBBIDataWrapper;
+
+/**
+ * Static functions for the process-wide cache of compiled rules,
+ * and for the optional cache files in a caller-provided directory.
+ *
+ * The process cache holds a bounded number of rule strings, each with
+ * a reference to its RBBIDataWrapper; the least recently used entry is
+ * evicted when a new one does not fit.
+ *
+ * The cache files hold the rule string and the compiled rules as from
+ * RuleBasedBreakIterator::getBinaryRules(). They are memory-mapped and
+ * used in place.
+ */
+class RBBIRuleCache {
+public:
+    /**
+     * Returns the compiled data for the rules with an added reference,
+     * or nullptr if the rules are not in the process cache.
+     */
+    static RBBIDataWrapper *get(const UnicodeString &rules);
+
+    /**
+     * Adds the compiled data for the rules to the process cache,
+     * which takes its own reference.
+     */
+    static void put(const UnicodeString &rules, RBBIDataWrapper *data);
+
+    /**
+     * Returns the compiled data for the rules from the cache file in cacheDir,
+     * with one reference for the caller,
+     * or nullptr if there is no file or it is not usable for these rules.
+     * Sets a failure code only for memory allocation errors.
+     */
+    static RBBIDataWrapper *load(const char *cacheDir, const UnicodeString &rules,
+                                 UErrorCode &status);
+
+    /**
+     * Writes the cache file for the rules and their compiled data into cacheDir.
+     * The cache is best-effort: Errors are ignored, and the next process just builds again.
+     */
+    static void write(const char *cacheDir, const UnicodeString &rules,
+                      const RBBIDataWrapper &data);
+
+private:
+    RBBIRuleCache() = delete;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
+#endif  // RBBIRULECACHE_H
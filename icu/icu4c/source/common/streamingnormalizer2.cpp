@@ -0,0 +1,202 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// streamingnormalizer2.cpp
+// created: 2026oct17
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_NORMALIZATION
+
+#include "unicode/appendable.h"
+#include "unicode/bytestream.h"
+#include "unicode/normalizer2.h"
+#include "unicode/unistr.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "charstr.h"
+
+U_NAMESPACE_BEGIN
+
+StreamingNormalizer2::StreamingNormalizer2(const Normalizer2 &n2) : norm2(n2), pending8(nullptr) {}
+
+StreamingNormalizer2::~StreamingNormalizer2() {
+    delete pending8;
+}
+
+// A position is usable as a split point if the code point there has a boundary before it,
+// and if the position is not inside a surrogate pair or UTF-8 sequence
+// that started in an earlier chunk.
+// Ill-formed sequences (c<0) never interact with their neighbors,
+// except that a lead surrogate or a truncated sequence at the end of a chunk
+// may yet be completed by the next chunk.
+
+int32_t
+StreamingNormalizer2::lastBoundary(const char16_t *s, int32_t length) const {
+    int32_t i = length;
+    if (i > 0 && U16_IS_LEAD(s[i - 1])) {
+        --i;
+    }
+    while (i > 0) {
+        UChar32 c;
+        U16_PREV(s, 0, i, c);
+        if (!U16_IS_TRAIL(s[i]) && norm2.hasBoundaryBefore(c)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int32_t
+StreamingNormalizer2::firstBoundary(const char16_t *s, int32_t limit) const {
+    int32_t i = 0;
+    while (i < limit) {
+        int32_t prev = i;
+        UChar32 c;
+        U16_NEXT(s, i, limit, c);
+        if (!U16_IS_TRAIL(s[prev]) && norm2.hasBoundaryBefore(c)) {
+            return prev;
+        }
+    }
+    return limit;
+}
+
+int32_t
+StreamingNormalizer2::lastBoundaryUTF8(const uint8_t *s, int32_t length) const {
+    int32_t i = length;
+    while (i > 0) {
+        UChar32 c;
+        U8_PREV(s, 0, i, c);
+        if (c < 0 && i + 1 + U8_COUNT_TRAIL_BYTES(s[i]) > length) {
+            continue;  // possibly truncated
+        }
+        if (!U8_IS_TRAIL(s[i]) && (c < 0 || norm2.hasBoundaryBefore(c))) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int32_t
+StreamingNormalizer2::firstBoundaryUTF8(const uint8_t *s, int32_t limit) const {
+    int32_t i = 0;
+    while (i < limit) {
+        int32_t prev = i;
+        UChar32 c;
+        U8_NEXT(s, i, limit, c);
+        if (!U8_IS_TRAIL(s[prev]) && (c < 0 || norm2.hasBoundaryBefore(c))) {
+            return prev;
+        }
+    }
+    return limit;
+}
+
+void
+StreamingNormalizer2::normalizeChunk(const UnicodeString &chunk, Appendable &dest,
+                                     UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (chunk.isBogus()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (pending8 != nullptr && !pending8->isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return;
+    }
+    const char16_t *s = chunk.getBuffer();
+    int32_t length = chunk.length();
+    int32_t last = lastBoundary(s, length);
+    if (last < 0) {
+        pending.append(chunk);
+        return;
+    }
+    // The held-back text interacts at most with the chunk text up to its first boundary.
+    // Normalize that short piece separately, so that the bulk of the chunk is not copied.
+    int32_t first = firstBoundary(s, last);
+    UnicodeString result;
+    pending.append(s, 0, first);
+    if (!pending.isEmpty()) {
+        norm2.normalize(pending, result, errorCode);
+        dest.appendString(result.getBuffer(), result.length());
+    }
+    if (first < last) {
+        norm2.normalize(chunk.tempSubString(first, last - first), result, errorCode);
+        dest.appendString(result.getBuffer(), result.length());
+    }
+    pending.setTo(chunk, last);
+}
+
+void
+StreamingNormalizer2::finish(Appendable &dest, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (!pending.isEmpty()) {
+        UnicodeString result;
+        norm2.normalize(pending, result, errorCode);
+        dest.appendString(result.getBuffer(), result.length());
+    }
+    reset();
+}
+
+void
+StreamingNormalizer2::normalizeChunkUTF8(StringPiece chunk, ByteSink &sink,
+                                         UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (!pending.isEmpty()) {
+        errorCode = U_INVALID_STATE_ERROR;
+        return;
+    }
+    if (pending8 == nullptr) {
+        pending8 = new CharString();
+        if (pending8 == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return;
+        }
+    }
+    const uint8_t *s = reinterpret_cast<const uint8_t *>(chunk.data());
+    int32_t length = chunk.length();
+    int32_t last = lastBoundaryUTF8(s, length);
+    if (last < 0) {
+        pending8->append(chunk, errorCode);
+        return;
+    }
+    int32_t first = firstBoundaryUTF8(s, last);
+    pending8->append(chunk.data(), first, errorCode);
+    if (!pending8->isEmpty()) {
+        norm2.normalizeUTF8(0, pending8->toStringPiece(), sink, nullptr, errorCode);
+    }
+    if (first < last) {
+        norm2.normalizeUTF8(0, StringPiece(chunk.data() + first, last - first),
+                            sink, nullptr, errorCode);
+    }
+    pending8->clear();
+    pending8->append(chunk.data() + last, length - last, errorCode);
+}
+
+void
+StreamingNormalizer2::finishUTF8(ByteSink &sink, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) {
+        return;
+    }
+    if (pending8 != nullptr && !pending8->isEmpty()) {
+        norm2.normalizeUTF8(0, pending8->toStringPiece(), sink, nullptr, errorCode);
+    }
+    reset();
+}
+
+void
+StreamingNormalizer2::reset() {
+    pending.remove();
+    if (pending8 != nullptr) {
+        pending8->clear();
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_NORMALIZATION
@@ -120,6 +120,34 @@ ubrk_openRules(  const UChar        *rules,
 }
 
 
+U_CAPI UBreakIterator* U_EXPORT2
+ubrk_openRulesWithCache(const UChar        *rules,
+                              int32_t       rulesLength,
+                        const UChar        *text,
+                              int32_t       textLength,
+                        const char         *cacheDir,
+                              UParseError  *parseErr,
+                              UErrorCode   *status)  {
+
+    if (status == NULL || U_FAILURE(*status)){
+        return 0;
+    }
+
+    UnicodeString ruleString(rules, rulesLength);
+    BreakIterator *result =
+        RBBIRuleBuilder::createRuleBasedBreakIterator(ruleString, cacheDir, parseErr, *status);
+    if(U_FAILURE(*status)) {
+        return 0;
+    }
+
+    UBreakIterator *uBI = (UBreakIterator *)result;
+    if (text != NULL) {
+        ubrk_setText(uBI, text, textLength, status);
+    }
+    return uBI;
+}
+
+
 U_CAPI UBreakIterator* U_EXPORT2
 ubrk_openBinaryRules(const uint8_t *binaryRules, int32_t rulesLength,
                      const UChar *  text, int32_t textLength,
@@ -298,6 +326,118 @@ ubrk_getRuleStatusVec(UBreakIterator *bi, int32_t *fillInVec, int32_t capacity,
     return ((BreakIterator*)bi)->getRuleStatusVec(fillInVec, capacity, *status);
 }
 
+U_CAPI int32_t U_EXPORT2
+ubrk_getBoundaries(UBreakIterator *bi, int32_t *boundaries, int32_t *ruleStatuses,
+                   int32_t capacity, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (bi == NULL || capacity < 0 || (boundaries == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    BreakIterator *brkit = (BreakIterator*)bi;
+    RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(brkit);
+    if (rbbi != NULL) {
+        return rbbi->fillBoundaries(boundaries, ruleStatuses, capacity, *status);
+    }
+    // Other break iterators, for example with sentence break suppressions.
+    int32_t length = 0;
+    int32_t pos;
+    while (length < capacity && (pos = brkit->next()) != UBRK_DONE) {
+        boundaries[length] = pos;
+        if (ruleStatuses != NULL) {
+            ruleStatuses[length] = brkit->getRuleStatus();
+        }
+        ++length;
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+ubrk_getAllBoundaries(const UBreakIterator *bi, UText *text,
+                      int32_t *boundaries, int32_t *ruleStatuses, int32_t capacity,
+                      int32_t numThreads, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (bi == NULL || text == NULL || capacity < 0 || (boundaries == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    const BreakIterator *brkit = (const BreakIterator*)bi;
+    const RuleBasedBreakIterator *rbbi = dynamic_cast<const RuleBasedBreakIterator *>(brkit);
+    if (rbbi != NULL) {
+        return rbbi->getAllBoundaries(text, boundaries, ruleStatuses, capacity, numThreads, *status);
+    }
+    // Other break iterators, for example with sentence break suppressions,
+    // iterate over the text on this thread.
+    LocalPointer<BreakIterator> clone(brkit->clone(), *status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    clone->setText(text, *status);
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    int32_t length = 0;
+    int32_t pos;
+    while ((pos = clone->next()) != UBRK_DONE) {
+        if (length < capacity) {
+            boundaries[length] = pos;
+            if (ruleStatuses != NULL) {
+                ruleStatuses[length] = clone->getRuleStatus();
+            }
+        }
+        ++length;
+    }
+    if (length > capacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return length;
+}
+
+U_CAPI int32_t U_EXPORT2
+ubrk_updateBoundaries(UBreakIterator *bi,
+                      int32_t editStart, int32_t oldEditLimit, int32_t newEditLimit,
+                      int32_t *boundaries, int32_t *ruleStatuses,
+                      int32_t length, int32_t capacity, UErrorCode *status)
+{
+    if (U_FAILURE(*status)) {
+        return 0;
+    }
+    if (bi == NULL) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    BreakIterator *brkit = (BreakIterator*)bi;
+    RuleBasedBreakIterator *rbbi = dynamic_cast<RuleBasedBreakIterator *>(brkit);
+    if (rbbi != NULL) {
+        return rbbi->updateBoundaries(editStart, oldEditLimit, newEditLimit,
+                                      boundaries, ruleStatuses, length, capacity, *status);
+    }
+    if (length < 0 || capacity < length || (boundaries == NULL && capacity > 0)) {
+        *status = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    // Other break iterators, for example with sentence break suppressions,
+    // segment the whole new text. Count first, so that the arrays are
+    // not modified if they are too short.
+    int32_t newLength = 0;
+    brkit->first();
+    while (brkit->next() != UBRK_DONE) {
+        ++newLength;
+    }
+    if (newLength > capacity) {
+        *status = U_BUFFER_OVERFLOW_ERROR;
+        return newLength;
+    }
+    brkit->first();
+    return ubrk_getBoundaries(bi, boundaries, ruleStatuses, capacity, status);
+}
+
 
 U_CAPI const char* U_EXPORT2
 ubrk_getLocaleByType(const UBreakIterator *bi,
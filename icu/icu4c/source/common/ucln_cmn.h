@@ -35,6 +35,8 @@ typedef enum ECleanupCommonType {
     UCLN_COMMON_USPREP,
     UCLN_COMMON_BREAKITERATOR,
     UCLN_COMMON_RBBI,
+    UCLN_COMMON_RBBI_RULE_CACHE,
+    UCLN_COMMON_GRAPHEME,
     UCLN_COMMON_SERVICE,
     UCLN_COMMON_LOCALE_KEY_TYPE,
     UCLN_COMMON_LOCALE,
@@ -326,29 +326,13 @@ ucnv_clone(const UConverter* cnv, UErrorCode *status)
     return ucnv_safeClone(cnv, nullptr, nullptr, status);
 }
 
-/*Decreases the reference counter in the shared immutable section of the object
- *and frees the mutable part*/
-
-U_CAPI void  U_EXPORT2
-ucnv_close (UConverter * converter)
-{
-    UErrorCode errorCode = U_ZERO_ERROR;
-
-    UTRACE_ENTRY_OC(UTRACE_UCNV_CLOSE);
-
-    if (converter == NULL)
-    {
-        UTRACE_EXIT();
-        return;
-    }
-
-    UTRACE_DATA3(UTRACE_OPEN_CLOSE, "close converter %s at %p, isCopyLocal=%b",
-        ucnv_getName(converter, &errorCode), converter, converter->isCopyLocal);
+U_CFUNC void
+ucnv_notifyCallbacksOfClose(UConverter *converter) {
+    UErrorCode errorCode;
 
     /* In order to speed up the close, only call the callbacks when they have been changed.
     This performance check will only work when the callbacks are set within a shared library
     or from user code that statically links this code. */
-    /* first, notify the callback functions that the converter is closed */
     if (converter->fromCharErrorBehaviour != UCNV_TO_U_DEFAULT_CALLBACK) {
         UConverterToUnicodeArgs toUArgs = {
             sizeof(UConverterToUnicodeArgs),
@@ -380,6 +364,30 @@ ucnv_close (UConverter * converter)
         errorCode = U_ZERO_ERROR;
         converter->fromUCharErrorBehaviour(converter->fromUContext, &fromUArgs, NULL, 0, 0, UCNV_CLOSE, &errorCode);
     }
+}
+
+/*Decreases the reference counter in the shared immutable section of the object
+ *and frees the mutable part*/
+
+U_CAPI void  U_EXPORT2
+ucnv_close (UConverter * converter)
+{
+    UErrorCode errorCode = U_ZERO_ERROR;
+
+    UTRACE_ENTRY_OC(UTRACE_UCNV_CLOSE);
+
+    if (converter == NULL)
+    {
+        UTRACE_EXIT();
+        return;
+    }
+
+    UTRACE_DATA3(UTRACE_OPEN_CLOSE, "close converter %s at %p, isCopyLocal=%b",
+        ucnv_getName(converter, &errorCode), converter, converter->isCopyLocal);
+    (void)errorCode;  /* unused without tracing */
+
+    /* first, notify the callback functions that the converter is closed */
+    ucnv_notifyCallbacksOfClose(converter);
 
     if (converter->sharedData->impl->close != NULL) {
         converter->sharedData->impl->close(converter);
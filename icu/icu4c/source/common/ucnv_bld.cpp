@@ -45,6 +45,10 @@
 #include "cmemory.h"
 #include "ucln_cmn.h"
 #include "ustr_cnv.h"
+#include "ustr_imp.h"
+#include "udatamem.h"
+
+#include <atomic>
 
 
 #if 0
@@ -198,6 +202,29 @@ static icu::UMutex cnvCacheMutex;
 /*  Note:  the global mutex is used for      */
 /*         reference count updates.          */
 
+/*
+ * Memory accounting for SHARED_DATA_HASHTABLE, see ucnv_setCacheMemoryLimit().
+ * gCacheClock counts the times when cached data became unused,
+ * for least-recently-used eviction.
+ * Protected by cnvCacheMutex.
+ */
+static int32_t gCacheMemoryLimit = -1;
+static int32_t gCacheMemoryUsage = 0;
+static uint32_t gCacheClock = 0;
+
+/*
+ * Pool of reset converters for ucnv_openPooled() and ucnv_recycle().
+ * The slots are grouped into buckets by the hash of the canonical converter name.
+ * A converter is taken out of a slot with an atomic exchange and put into
+ * an empty slot with a compare-and-swap, so the pool does not need a mutex.
+ * A slot may hold a converter for another name with the same hash;
+ * it is put back when it is taken out by mistake.
+ */
+#define UCNV_POOL_BUCKETS 32
+#define UCNV_POOL_BUCKET_SIZE 8
+
+static std::atomic<UConverter *> gConverterPool[UCNV_POOL_BUCKETS * UCNV_POOL_BUCKET_SIZE] = {};
+
 static const char **gAvailableConverters = NULL;
 static uint16_t gAvailableConverterCount = 0;
 static icu::UInitOnce gAvailableConvertersInitOnce {};
@@ -237,6 +264,13 @@ ucnv_flushAvailableConverterCache() {
     gAvailableConvertersInitOnce.reset();
 }
 
+/* The number of bytes that the cache accounts for one converter's shared data. */
+static int32_t
+getSharedDataMemorySize(const UConverterSharedData *sharedData) {
+    int32_t length = udata_getLength((const UDataMemory *)sharedData->dataMemory);
+    return (int32_t)sizeof(UConverterSharedData) + (length > 0 ? length : 0);
+}
+
 /* ucnv_cleanup - delete all storage held by the converter cache, except any  */
 /*                in use by open converters.                                  */
 /*                Not thread safe.                                            */
@@ -250,6 +284,7 @@ static UBool U_CALLCONV ucnv_cleanup(void) {
 
     /* Isn't called from flushCache because other threads may have preexisting references to the table. */
     ucnv_flushAvailableConverterCache();
+    gCacheMemoryLimit = -1;
 
 #if !U_CHARSET_IS_UTF8
     gDefaultConverterName = NULL;
@@ -464,6 +499,7 @@ ucnv_shareConverterData(UConverterSharedData * data)
 
     /* Mark it shared */
     data->sharedDataCached = true;
+    gCacheMemoryUsage += getSharedDataMemorySize(data);
 
     uhash_put(SHARED_DATA_HASHTABLE,
             (void*) data->staticData->name, /* Okay to cast away const as long as
@@ -590,18 +626,65 @@ ucnv_unload(UConverterSharedData *sharedData) {
             sharedData->referenceCounter--;
         }
 
-        if((sharedData->referenceCounter <= 0)&&(sharedData->sharedDataCached == false)) {
-            ucnv_deleteSharedConverterData(sharedData);
+        if(sharedData->referenceCounter <= 0) {
+            if(sharedData->sharedDataCached == false) {
+                ucnv_deleteSharedConverterData(sharedData);
+            } else {
+                /* remember when it became unused, for ucnv_evictUnusedSharedData() */
+                sharedData->unusedSince = ++gCacheClock;
+            }
         }
     }
 }
 
+/**
+ * Unloads the least recently used, unused cached shared data
+ * while the cache uses more memory than its limit.
+ * Must be called inside umtx_lock(&cnvCacheMutex),
+ * and not while iterating over SHARED_DATA_HASHTABLE.
+ */
+static void
+ucnv_evictUnusedSharedData() {
+    while (gCacheMemoryLimit >= 0 && gCacheMemoryUsage > gCacheMemoryLimit &&
+            SHARED_DATA_HASHTABLE != NULL) {
+        /*
+         * Find the unused data that has been unused the longest.
+         * Count the clock differences from the current time
+         * so that clock wrap-around does not matter.
+         */
+        const UHashElement *e, *oldest = NULL;
+        uint32_t oldestAge = 0;
+        int32_t pos = UHASH_FIRST;
+        while ((e = uhash_nextElement(SHARED_DATA_HASHTABLE, &pos)) != NULL) {
+            const UConverterSharedData *sharedData = (const UConverterSharedData *)e->value.pointer;
+            if (sharedData->referenceCounter == 0) {
+                uint32_t age = gCacheClock - sharedData->unusedSince;
+                if (oldest == NULL || age > oldestAge) {
+                    oldest = e;
+                    oldestAge = age;
+                }
+            }
+        }
+        if (oldest == NULL) {
+            break;  /* All cached data is in use. */
+        }
+        UConverterSharedData *sharedData = (UConverterSharedData *)oldest->value.pointer;
+        UCNV_DEBUG_LOG("evict", sharedData->staticData->name, sharedData);
+        uhash_removeElement(SHARED_DATA_HASHTABLE, oldest);
+        sharedData->sharedDataCached = false;
+        gCacheMemoryUsage -= getSharedDataMemorySize(sharedData);
+        /* This may make a base table's shared data unused, which is then also evictable. */
+        ucnv_deleteSharedConverterData(sharedData);
+    }
+}
+
 U_CFUNC void
 ucnv_unloadSharedDataIfReady(UConverterSharedData *sharedData)
 {
     if(sharedData != NULL && sharedData->isReferenceCounted) {
         umtx_lock(&cnvCacheMutex);
         ucnv_unload(sharedData);
+        ucnv_evictUnusedSharedData();
         umtx_unlock(&cnvCacheMutex);
     }
 }
@@ -815,6 +898,7 @@ ucnv_loadSharedData(const char *converterName,
 
         umtx_lock(&cnvCacheMutex);
         mySharedConverterData = ucnv_load(pArgs, err);
+        ucnv_evictUnusedSharedData();
         umtx_unlock(&cnvCacheMutex);
         if (U_FAILURE (*err) || (mySharedConverterData == NULL))
         {
@@ -1001,6 +1085,9 @@ ucnv_createConverterFromSharedData(UConverter *myUConverter,
     /*myUConverter->isExtraLocal = false;*/ /* Set by the memset call */
     myUConverter->sharedData = mySharedConverterData;
     myUConverter->options = pArgs->options;
+    myUConverter->hasNameOptions =
+        (pArgs->options & (UCNV_OPTION_VERSION | UCNV_OPTION_SWAP_LFNL)) != 0 ||
+        (pArgs->locale != NULL && *pArgs->locale != 0);
     if(!pArgs->onlyTestIsLoadable) {
         myUConverter->preFromUFirstCP = U_SENTINEL;
         myUConverter->fromCharErrorBehaviour = UCNV_TO_U_DEFAULT_CALLBACK;
@@ -1026,6 +1113,114 @@ ucnv_createConverterFromSharedData(UConverter *myUConverter,
     return myUConverter;
 }
 
+static std::atomic<UConverter *> *
+getPoolBucket(const char *name) {
+    int32_t hash = ustr_hashCharsN(name, (int32_t)uprv_strlen(name));
+    return gConverterPool + ((uint32_t)hash % UCNV_POOL_BUCKETS) * UCNV_POOL_BUCKET_SIZE;
+}
+
+/* Puts cnv into an empty slot of the bucket. Returns false if the bucket is full. */
+static UBool
+putIntoPoolBucket(std::atomic<UConverter *> *bucket, UConverter *cnv) {
+    for (int32_t i = 0; i < UCNV_POOL_BUCKET_SIZE; ++i) {
+        UConverter *expected = NULL;
+        if (bucket[i].load(std::memory_order_relaxed) == NULL &&
+                bucket[i].compare_exchange_strong(expected, cnv, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* Closes all pooled converters. Other threads may keep using the pool. */
+static void
+ucnv_flushConverterPool() {
+    for (int32_t i = 0; i < UCNV_POOL_BUCKETS * UCNV_POOL_BUCKET_SIZE; ++i) {
+        if (gConverterPool[i].load(std::memory_order_relaxed) != NULL) {
+            ucnv_close(gConverterPool[i].exchange(NULL, std::memory_order_acq_rel));
+        }
+    }
+}
+
+U_CAPI UConverter * U_EXPORT2
+ucnv_openPooled(const char *name, UErrorCode *err) {
+    if (U_FAILURE(*err)) {
+        return NULL;
+    }
+    const char *canonicalName;
+    if (name == NULL || *name == 0) {
+        canonicalName = ucnv_getDefaultName();
+    } else if (UCNV_FAST_IS_UTF8(name)) {
+        canonicalName = "UTF-8";
+    } else if (uprv_strchr(name, UCNV_OPTION_SEP_CHAR) != NULL) {
+        /* Options are not part of the pool key. */
+        canonicalName = NULL;
+    } else {
+        UErrorCode localErr = U_ZERO_ERROR;
+        UBool containsOption;
+        canonicalName = ucnv_io_getConverterName(name, &containsOption, &localErr);
+        if (U_FAILURE(localErr)) {
+            canonicalName = NULL;
+        }
+    }
+    if (canonicalName != NULL) {
+        std::atomic<UConverter *> *bucket = getPoolBucket(canonicalName);
+        for (int32_t i = 0; i < UCNV_POOL_BUCKET_SIZE; ++i) {
+            if (bucket[i].load(std::memory_order_relaxed) == NULL) {
+                continue;
+            }
+            UConverter *cnv = bucket[i].exchange(NULL, std::memory_order_acq_rel);
+            if (cnv == NULL) {
+                continue;  /* Another thread took it. */
+            }
+            UErrorCode localErr = U_ZERO_ERROR;
+            if (uprv_strcmp(ucnv_getName(cnv, &localErr), canonicalName) == 0) {
+                return cnv;
+            }
+            if (!putIntoPoolBucket(bucket, cnv)) {
+                ucnv_close(cnv);
+            }
+        }
+    }
+    return ucnv_open(name, err);
+}
+
+U_CAPI void U_EXPORT2
+ucnv_recycle(UConverter *cnv) {
+    if (cnv == NULL) {
+        return;
+    }
+    const UConverterSharedData *sharedData = cnv->sharedData;
+    const UConverterStaticData *staticData = sharedData->staticData;
+    /*
+     * ucnv_openPooled() looks up only names without options,
+     * and only converters from the shared cache, not from ucnv_openPackage().
+     */
+    if (cnv->isCopyLocal || cnv->hasNameOptions ||
+            (sharedData->isReferenceCounted && !sharedData->sharedDataCached) ||
+            cnv->useFallback ||
+            cnv->subCharLen != staticData->subCharLen ||
+            cnv->subChar1 != staticData->subChar1 ||
+            (cnv->subCharLen > 0 && uprv_memcmp(cnv->subChars, staticData->subChar, cnv->subCharLen) != 0)) {
+        ucnv_close(cnv);
+        return;
+    }
+    ucnv_reset(cnv);
+    /* The callbacks may own their contexts, as with ucnv_close(). */
+    ucnv_notifyCallbacksOfClose(cnv);
+    cnv->fromCharErrorBehaviour = UCNV_TO_U_DEFAULT_CALLBACK;
+    cnv->fromUCharErrorBehaviour = UCNV_FROM_U_DEFAULT_CALLBACK;
+    cnv->toUContext = NULL;
+    cnv->fromUContext = NULL;
+    /* u_cleanup() closes the pooled converters, even if no data converter was loaded. */
+    ucnv_enableCleanup();
+    UErrorCode localErr = U_ZERO_ERROR;
+    const char *name = ucnv_getName(cnv, &localErr);
+    if (U_FAILURE(localErr) || !putIntoPoolBucket(getPoolBucket(name), cnv)) {
+        ucnv_close(cnv);
+    }
+}
+
 /*Frees all shared immutable objects that aren't referred to (reference count = 0)
  */
 U_CAPI int32_t U_EXPORT2
@@ -1042,6 +1237,7 @@ ucnv_flushCache ()
 
     /* Close the default converter without creating a new one so that everything will be flushed. */
     u_flushDefaultConverter();
+    ucnv_flushConverterPool();
 
     /*if shared data hasn't even been lazy evaluated yet
     * return 0
@@ -1085,6 +1281,7 @@ ucnv_flushCache ()
 
                 uhash_removeElement(SHARED_DATA_HASHTABLE, e);
                 mySharedData->sharedDataCached = false;
+                gCacheMemoryUsage -= getSharedDataMemorySize(mySharedData);
                 ucnv_deleteSharedConverterData (mySharedData);
             } else {
                 ++remaining;
@@ -1099,6 +1296,22 @@ ucnv_flushCache ()
     return tableDeletedNum;
 }
 
+U_CAPI void U_EXPORT2
+ucnv_setCacheMemoryLimit(int32_t maxBytes) {
+    umtx_lock(&cnvCacheMutex);
+    gCacheMemoryLimit = maxBytes < 0 ? -1 : maxBytes;
+    ucnv_evictUnusedSharedData();
+    umtx_unlock(&cnvCacheMutex);
+}
+
+U_CAPI int32_t U_EXPORT2
+ucnv_getCacheMemoryUsage() {
+    umtx_lock(&cnvCacheMutex);
+    int32_t usage = gCacheMemoryUsage;
+    umtx_unlock(&cnvCacheMutex);
+    return usage;
+}
+
 /* available converters list --------------------------------------------------- */
 
 static void U_CALLCONV initAvailableConvertersList(UErrorCode &errCode) {
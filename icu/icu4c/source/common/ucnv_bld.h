@@ -122,6 +122,12 @@ struct UConverterSharedData {
      * markus 2003-nov-07
      */
     UConverterMBCSTable mbcs;
+
+    /**
+     * For cached data: The value of the cache clock when referenceCounter last dropped to 0.
+     * Unused cached data is unloaded in this order when the cache exceeds its memory limit.
+     */
+    uint32_t unusedSince;
 };
 
 /** UConverterSharedData initializer for static, non-reference-counted converters. */
@@ -129,7 +135,7 @@ struct UConverterSharedData {
     { \
         sizeof(UConverterSharedData), ~((uint32_t)0), \
         NULL, pStaticData, false, false, pImpl, \
-        0, UCNV_MBCS_TABLE_INITIALIZER \
+        0, UCNV_MBCS_TABLE_INITIALIZER, 0 \
     }
 
 /* Defines a UConverter, the lightweight mutable part the user sees */
@@ -180,6 +186,7 @@ struct UConverter {
     UConverterSharedData *sharedData;   /* Pointer to the shared immutable part of the converter object */
 
     uint32_t options; /* options flags from UConverterOpen, may contain additional bits */
+    UBool hasNameOptions; /* true if opened with options like ",locale=ja" or ",swaplfnl", which ucnv_openPooled() does not look up */
 
     UBool sharedDataIsCached;  /* true:  shared data is in cache, don't destroy on ucnv_close() if 0 ref.  false: shared data isn't in the cache, do attempt to clean it up if the ref is 0 */
     UBool isCopyLocal;  /* true if UConverter is not owned and not released in ucnv_close() (stack-allocated, safeClone(), etc.) */
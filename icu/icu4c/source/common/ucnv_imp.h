@@ -127,6 +127,13 @@ ucnv_unloadSharedDataIfReady(UConverterSharedData *sharedData);
 U_CFUNC void
 ucnv_incrementRefCount(UConverterSharedData *sharedData);
 
+/**
+ * Calls the converter's callbacks with UCNV_CLOSE unless they are the defaults.
+ * Used by ucnv_close(), and by ucnv_recycle() before it resets the callbacks.
+ */
+U_CFUNC void
+ucnv_notifyCallbacksOfClose(UConverter *converter);
+
 /**
  * These are the default error handling callbacks for the charset conversion framework.
  * For performance reasons, they are only called to handle an error (not normally called for a reset or close).
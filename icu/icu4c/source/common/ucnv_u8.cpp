@@ -33,6 +33,7 @@
 #include "ucnv_cnv.h"
 #include "cmemory.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
 /* Prototypes --------------------------------------------------------------- */
 
@@ -53,6 +54,27 @@ static const uint32_t offsetsFromUTF8[5] = {0,
   (uint32_t) 0x03C82080
 };
 
+/*
+ * Copy the rest of an ASCII run in bulk, as far as the target has room.
+ * Used by the conversion loops after an ASCII character that is followed by another one.
+ * @return the number of characters copied
+ */
+static U_SIMD_NOINLINE int32_t
+copyASCIIRun(const uint8_t *source, const uint8_t *sourceLimit,
+             UChar *target, const UChar *targetLimit) {
+    int32_t length = (int32_t)(sourceLimit - source);
+    int32_t capacity = (int32_t)(targetLimit - target);
+    return icu::SIMDUtil::widenASCII(source, length < capacity ? length : capacity, target);
+}
+
+static U_SIMD_NOINLINE int32_t
+copyASCIIRun(const UChar *source, const UChar *sourceLimit,
+             uint8_t *target, const uint8_t *targetLimit) {
+    int32_t length = (int32_t)(sourceLimit - source);
+    int32_t capacity = (int32_t)(targetLimit - target);
+    return icu::SIMDUtil::narrowASCII(source, length < capacity ? length : capacity, target);
+}
+
 static UBool hasCESU8Data(const UConverter *cnv)
 {
 #if UCONFIG_ONLY_HTML_CONVERSION
@@ -94,6 +116,11 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8 (UConverterToUnicodeArgs * args,
         if (U8_IS_SINGLE(ch))        /* Simple case */
         {
             *(myTarget++) = (UChar) ch;
+            if (mySource < sourceLimit && U8_IS_SINGLE(*mySource)) {
+                int32_t count = copyASCIIRun(mySource, sourceLimit, myTarget, targetLimit);
+                mySource += count;
+                myTarget += count;
+            }
         }
         else
         {
@@ -212,6 +239,14 @@ static void  U_CALLCONV ucnv_toUnicode_UTF8_OFFSETS_LOGIC (UConverterToUnicodeAr
         {
             *(myTarget++) = (UChar) ch;
             *(myOffsets++) = offsetNum++;
+            if (mySource < sourceLimit && U8_IS_SINGLE(*mySource)) {
+                int32_t count = copyASCIIRun(mySource, sourceLimit, myTarget, targetLimit);
+                mySource += count;
+                myTarget += count;
+                while (count-- > 0) {
+                    *(myOffsets++) = offsetNum++;
+                }
+            }
         }
         else
         {
@@ -325,6 +360,11 @@ U_CFUNC void  U_CALLCONV ucnv_fromUnicode_UTF8 (UConverterFromUnicodeArgs * args
         if (ch < 0x80)        /* Single byte */
         {
             *(myTarget++) = (uint8_t) ch;
+            if (mySource < sourceLimit && *mySource < 0x80) {
+                int32_t count = copyASCIIRun(mySource, sourceLimit, myTarget, targetLimit);
+                mySource += count;
+                myTarget += count;
+            }
         }
         else if (ch < 0x800)  /* Double byte */
         {
@@ -446,6 +486,14 @@ U_CFUNC void  U_CALLCONV ucnv_fromUnicode_UTF8_OFFSETS_LOGIC (UConverterFromUnic
         {
             *(myOffsets++) = offsetNum++;
             *(myTarget++) = (char) ch;
+            if (mySource < sourceLimit && *mySource < 0x80) {
+                int32_t count = copyASCIIRun(mySource, sourceLimit, myTarget, targetLimit);
+                mySource += count;
+                myTarget += count;
+                while (count-- > 0) {
+                    *(myOffsets++) = offsetNum++;
+                }
+            }
         }
         else if (ch < 0x800)  /* Double byte */
         {
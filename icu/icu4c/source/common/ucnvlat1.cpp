@@ -23,10 +23,27 @@
 #include "unicode/utf8.h"
 #include "ucnv_bld.h"
 #include "ucnv_cnv.h"
+#include "cmemory.h"
 #include "ustr_imp.h"
-
-/* control optimizations according to the platform */
-#define LATIN1_UNROLL_FROM_UNICODE 1
+#include "usimd.h"
+
+using icu::SIMDUtil;
+
+/*
+ * Copies the ASCII bytes at the start of [source, sourceLimit[ to target,
+ * at most targetCapacity of them, and returns their number.
+ * Used in the direct UTF-8 conversion loops, for runs of ASCII between
+ * non-ASCII characters.
+ */
+static U_SIMD_NOINLINE int32_t
+copyASCII(const uint8_t *source, const uint8_t *sourceLimit, uint8_t *target, int32_t targetCapacity) {
+    if(targetCapacity<(sourceLimit-source)) {
+        sourceLimit=source+targetCapacity;
+    }
+    int32_t count=(int32_t)(SIMDUtil::spanBelow(source, sourceLimit, 0x80)-source);
+    uprv_memcpy(target, source, count);
+    return count;
+}
 
 /* ISO 8859-1 --------------------------------------------------------------- */
 
@@ -40,68 +57,27 @@ _Latin1ToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
     int32_t targetCapacity, length;
     int32_t *offsets;
 
-    int32_t sourceIndex;
-
     /* set up the local pointers */
     source=(const uint8_t *)pArgs->source;
     target=pArgs->target;
     targetCapacity=(int32_t)(pArgs->targetLimit-pArgs->target);
     offsets=pArgs->offsets;
 
-    sourceIndex=0;
-
     /*
      * since the conversion here is 1:1 UChar:uint8_t, we need only one counter
      * for the minimum of the sourceLength and targetCapacity
      */
     length=(int32_t)((const uint8_t *)pArgs->sourceLimit-source);
-    if(length<=targetCapacity) {
-        targetCapacity=length;
-    } else {
+    if(length>targetCapacity) {
         /* target will be full */
         *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
         length=targetCapacity;
     }
 
-    if(targetCapacity>=8) {
-        /* This loop is unrolled for speed and improved pipelining. */
-        int32_t count, loops;
-
-        loops=count=targetCapacity>>3;
-        length=targetCapacity&=0x7;
-        do {
-            target[0]=source[0];
-            target[1]=source[1];
-            target[2]=source[2];
-            target[3]=source[3];
-            target[4]=source[4];
-            target[5]=source[5];
-            target[6]=source[6];
-            target[7]=source[7];
-            target+=8;
-            source+=8;
-        } while(--count>0);
-
-        if(offsets!=NULL) {
-            do {
-                offsets[0]=sourceIndex++;
-                offsets[1]=sourceIndex++;
-                offsets[2]=sourceIndex++;
-                offsets[3]=sourceIndex++;
-                offsets[4]=sourceIndex++;
-                offsets[5]=sourceIndex++;
-                offsets[6]=sourceIndex++;
-                offsets[7]=sourceIndex++;
-                offsets+=8;
-            } while(--loops>0);
-        }
-    }
-
-    /* conversion loop */
-    while(targetCapacity>0) {
-        *target++=*source++;
-        --targetCapacity;
-    }
+    /* conversion: widen all bytes */
+    SIMDUtil::widenLatin1(source, length, target);
+    source+=length;
+    target+=length;
 
     /* write back the updated pointers */
     pArgs->source=(const char *)source;
@@ -109,11 +85,8 @@ _Latin1ToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     /* set offsets */
     if(offsets!=NULL) {
-        while(length>0) {
-            *offsets++=sourceIndex++;
-            --length;
-        }
-        pArgs->offsets=offsets;
+        SIMDUtil::writeIndexes(offsets, length, 0);
+        pArgs->offsets=offsets+length;
     }
 }
 
@@ -181,82 +154,18 @@ _Latin1FromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
         goto getTrail;
     }
 
-#if LATIN1_UNROLL_FROM_UNICODE
-    /* unroll the loop with the most common case */
+    /* convert the longest prefix that does not need the callback */
     if(targetCapacity>=16) {
-        int32_t count, loops;
-        UChar u, oredChars;
-
-        loops=count=targetCapacity>>4;
-        do {
-            oredChars=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-            oredChars|=u=*source++;
-            *target++=(uint8_t)u;
-
-            /* were all 16 entries really valid? */
-            if(oredChars>max) {
-                /* no, return to the first of these 16 */
-                source-=16;
-                target-=16;
-                break;
-            }
-        } while(--count>0);
-        count=loops-count;
-        targetCapacity-=16*count;
-
-        if(offsets!=NULL) {
-            oldTarget+=16*count;
-            while(count>0) {
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                *offsets++=sourceIndex++;
-                --count;
-            }
+        int32_t count;
+        if(max==0xff) {
+            count=SIMDUtil::narrowLatin1(source, targetCapacity, target);
+        } else {
+            count=SIMDUtil::narrowASCII(source, targetCapacity, target);
         }
+        source+=count;
+        target+=count;
+        targetCapacity-=count;
     }
-#endif
 
     /* conversion loop */
     c=0;
@@ -301,11 +210,9 @@ _Latin1FromUnicodeWithOffsets(UConverterFromUnicodeArgs *pArgs,
 
     /* set offsets since the start */
     if(offsets!=NULL) {
-        size_t count=target-oldTarget;
-        while(count>0) {
-            *offsets++=sourceIndex++;
-            --count;
-        }
+        int32_t count=(int32_t)(target-oldTarget);
+        SIMDUtil::writeIndexes(offsets, count, sourceIndex);
+        offsets+=count;
     }
 
     if(U_SUCCESS(*pErrorCode) && source<sourceLimit && target>=(uint8_t *)pArgs->targetLimit) {
@@ -380,9 +287,15 @@ ucnv_Latin1FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
         if(targetCapacity>0) {
             b=*source++;
             if(U8_IS_SINGLE(b)) {
-                /* convert ASCII */
+                /* convert ASCII, and copy the rest of an ASCII run in bulk */
                 *target++=(uint8_t)b;
                 --targetCapacity;
+                if(targetCapacity>0 && U8_IS_SINGLE(*source)) {
+                    int32_t count=copyASCII(source, sourceLimit, target, targetCapacity);
+                    source+=count;
+                    target+=count;
+                    targetCapacity-=count;
+                }
             } else if( /* handle U+0080..U+00FF inline */
                        b>=0xc2 && b<=0xc3 &&
                        (t1=(uint8_t)(*source-0x80)) <= 0x3f
@@ -422,6 +335,76 @@ ucnv_Latin1FromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/* Convert Latin-1 to UTF-8: Copy ASCII, and write two bytes for U+0080..U+00FF. */
+static void U_CALLCONV
+ucnv_Latin1ToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                  UConverterToUnicodeArgs *pToUArgs,
+                  UErrorCode *pErrorCode) {
+    const uint8_t *source, *sourceLimit;
+    uint8_t *target, *targetLimit;
+    uint8_t b;
+
+    if(pFromUArgs->converter->fromUChar32!=0) {
+        /* the UTF-8 converter has a pending lead surrogate, fall back to pivoting */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(uint8_t *)pFromUArgs->targetLimit;
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if((sourceLimit-source)>=8 && (targetLimit-target)>=16) {
+            /* convert 8 bytes at a time, and copy them together if they are all ASCII */
+            uint64_t word;
+            uprv_memcpy(&word, source, 8);
+            if((word&0x8080808080808080ULL)==0) {
+                uprv_memcpy(target, &word, 8);
+                target+=8;
+            } else {
+                for(int32_t i=0; i<8; ++i) {
+                    b=source[i];
+                    if(U8_IS_SINGLE(b)) {
+                        *target++=b;
+                    } else {
+                        target[0]=(uint8_t)(0xc0|(b>>6));
+                        target[1]=(uint8_t)(0x80|(b&0x3f));
+                        target+=2;
+                    }
+                }
+            }
+            source+=8;
+            continue;
+        } else if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+        b=*source;
+        if(U8_IS_SINGLE(b)) {
+            ++source;
+            *target++=b;
+        } else if((targetLimit-target)>=2) {
+            ++source;
+            target[0]=(uint8_t)(0xc0|(b>>6));
+            target[1]=(uint8_t)(0x80|(b&0x3f));
+            target+=2;
+        } else {
+            /* only one byte fits: let the pivoting code write the character into the overflow buffer */
+            *pErrorCode=U_USING_DEFAULT_WARNING;
+            break;
+        }
+    }
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 static void U_CALLCONV
 _Latin1GetUnicodeSet(const UConverter *cnv,
                      const USetAdder *sa,
@@ -457,7 +440,7 @@ static const UConverterImpl _Latin1Impl={
     NULL,
     _Latin1GetUnicodeSet,
 
-    NULL,
+    ucnv_Latin1ToUTF8,
     ucnv_Latin1FromUTF8
 };
 
@@ -509,48 +492,12 @@ _ASCIIToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
         targetCapacity=length;
     }
 
-    if(targetCapacity>=8) {
-        /* This loop is unrolled for speed and improved pipelining. */
-        int32_t count, loops;
-        UChar oredChars;
-
-        loops=count=targetCapacity>>3;
-        do {
-            oredChars=target[0]=source[0];
-            oredChars|=target[1]=source[1];
-            oredChars|=target[2]=source[2];
-            oredChars|=target[3]=source[3];
-            oredChars|=target[4]=source[4];
-            oredChars|=target[5]=source[5];
-            oredChars|=target[6]=source[6];
-            oredChars|=target[7]=source[7];
-
-            /* were all 16 entries really valid? */
-            if(oredChars>0x7f) {
-                /* no, return to the first of these 16 */
-                break;
-            }
-            source+=8;
-            target+=8;
-        } while(--count>0);
-        count=loops-count;
-        targetCapacity-=count*8;
-
-        if(offsets!=NULL) {
-            oldTarget+=count*8;
-            while(count>0) {
-                offsets[0]=sourceIndex++;
-                offsets[1]=sourceIndex++;
-                offsets[2]=sourceIndex++;
-                offsets[3]=sourceIndex++;
-                offsets[4]=sourceIndex++;
-                offsets[5]=sourceIndex++;
-                offsets[6]=sourceIndex++;
-                offsets[7]=sourceIndex++;
-                offsets+=8;
-                --count;
-            }
-        }
+    /* convert the longest prefix of ASCII bytes */
+    if(targetCapacity>=16) {
+        int32_t count=SIMDUtil::widenASCII(source, targetCapacity, target);
+        source+=count;
+        target+=count;
+        targetCapacity-=count;
     }
 
     /* conversion loop */
@@ -573,11 +520,9 @@ _ASCIIToUnicodeWithOffsets(UConverterToUnicodeArgs *pArgs,
 
     /* set offsets since the start */
     if(offsets!=NULL) {
-        size_t count=target-oldTarget;
-        while(count>0) {
-            *offsets++=sourceIndex++;
-            --count;
-        }
+        int32_t count=(int32_t)(target-oldTarget);
+        SIMDUtil::writeIndexes(offsets, count, sourceIndex);
+        offsets+=count;
     }
 
     /* write back the updated pointers */
@@ -645,40 +590,12 @@ ucnv_ASCIIFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
         targetCapacity=length;
     }
 
-    /* unroll the loop with the most common case */
+    /* copy the longest prefix of ASCII bytes */
     if(targetCapacity>=16) {
-        int32_t count, loops;
-        uint8_t oredChars;
-
-        loops=count=targetCapacity>>4;
-        do {
-            oredChars=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-            oredChars|=*target++=*source++;
-
-            /* were all 16 entries really valid? */
-            if(oredChars>0x7f) {
-                /* no, return to the first of these 16 */
-                source-=16;
-                target-=16;
-                break;
-            }
-        } while(--count>0);
-        count=loops-count;
-        targetCapacity-=16*count;
+        int32_t count=copyASCII(source, sourceLimit, target, targetCapacity);
+        source+=count;
+        target+=count;
+        targetCapacity-=count;
     }
 
     /* conversion loop */
@@ -702,6 +619,22 @@ ucnv_ASCIIFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/*
+ * "Convert" US-ASCII to UTF-8: Validate and copy, which is the same operation
+ * as from UTF-8, except that the UTF-8 converter must not have a pending lead surrogate.
+ */
+static void U_CALLCONV
+ucnv_ASCIIToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                 UConverterToUnicodeArgs *pToUArgs,
+                 UErrorCode *pErrorCode) {
+    if(pFromUArgs->converter->fromUChar32!=0) {
+        /* the UTF-8 converter has a pending lead surrogate, fall back to pivoting */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+    ucnv_ASCIIFromUTF8(pFromUArgs, pToUArgs, pErrorCode);
+}
+
 static void U_CALLCONV
 _ASCIIGetUnicodeSet(const UConverter *cnv,
                     const USetAdder *sa,
@@ -736,7 +669,7 @@ static const UConverterImpl _ASCIIImpl={
     NULL,
     _ASCIIGetUnicodeSet,
 
-    NULL,
+    ucnv_ASCIIToUTF8,
     ucnv_ASCIIFromUTF8
 };
 
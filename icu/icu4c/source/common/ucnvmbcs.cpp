@@ -60,6 +60,7 @@
 #include "cstring.h"
 #include "umutex.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 
 /* control optimizations according to the platform */
 #define MBCS_UNROLL_SINGLE_TO_BMP 1
@@ -431,6 +432,11 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
                   UConverterToUnicodeArgs *pToUArgs,
                   UErrorCode *pErrorCode);
 
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode);
+
 static const UConverterImpl _SBCSUTF8Impl={
     UCNV_MBCS,
 
@@ -453,7 +459,7 @@ static const UConverterImpl _SBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_SBCSFromUTF8
 };
 
@@ -479,7 +485,7 @@ static const UConverterImpl _DBCSUTF8Impl={
     NULL,
     ucnv_MBCSGetUnicodeSet,
 
-    NULL,
+    ucnv_MBCSToUTF8,
     ucnv_DBCSFromUTF8
 };
 
@@ -504,7 +510,7 @@ static const UConverterImpl _MBCSImpl={
     ucnv_MBCSWriteSub,
     NULL,
     ucnv_MBCSGetUnicodeSet,
-    NULL,
+    ucnv_MBCSToUTF8,
     NULL
 };
 
@@ -515,7 +521,7 @@ static const UConverterImpl _MBCSImpl={
 const UConverterSharedData _MBCSData={
     sizeof(UConverterSharedData), 1,
     NULL, NULL, false, true, &_MBCSImpl,
-    0, UCNV_MBCS_TABLE_INITIALIZER
+    0, UCNV_MBCS_TABLE_INITIALIZER, 0
 };
 
 
@@ -5622,6 +5628,300 @@ ucnv_DBCSFromUTF8(UConverterFromUnicodeArgs *pFromUArgs,
     pFromUArgs->target=(char *)target;
 }
 
+/* MBCS-to-UTF-8 conversion functions --------------------------------------- */
+
+/*
+ * Copy ASCII bytes that state 0 maps to themselves (see asciiRoundtrips) to UTF-8.
+ * Out of line so that the conversion loop keeps its registers.
+ */
+static U_SIMD_NOINLINE int32_t
+copyASCIIRun(const uint8_t *source, const uint8_t *sourceLimit,
+             uint8_t *target, const uint8_t *targetLimit,
+             uint32_t asciiRoundtrips) {
+    int32_t length=(int32_t)(sourceLimit-source);
+    int32_t capacity=(int32_t)(targetLimit-target);
+    int32_t i;
+    uint8_t b;
+    if(length>capacity) {
+        length=capacity;
+    }
+    if(asciiRoundtrips==0xffffffff) {
+        length=(int32_t)(icu::SIMDUtil::spanBelow(source, source+length, 0x80)-source);
+        uprv_memcpy(target, source, length);
+        return length;
+    }
+    for(i=0; i<length && (b=source[i])<=0x7f && IS_ASCII_ROUNDTRIP(b, asciiRoundtrips); ++i) {
+        target[i]=b;
+    }
+    return i;
+}
+
+/* results of the toUnicode action codes other than code points */
+#define MBCS_TO_UTF8_UNASSIGNED -1
+#define MBCS_TO_UTF8_ILLEGAL -2
+#define MBCS_TO_UTF8_NO_OUTPUT -3
+
+/*
+ * Convert from any MBCS codepage directly to UTF-8.
+ * Walks the same state table as ucnv_MBCSToUnicodeWithOffsets(),
+ * including SI/SO states, fallbacks, extension mappings and GB 18030 ranges.
+ *
+ * Illegal and unmappable input, and output that does not fit into the target,
+ * are left to the pivoting implementation (U_USING_DEFAULT_WARNING)
+ * with the source and state reset to the start of the character,
+ * so that callbacks and buffer overflows behave exactly as with pivoting.
+ */
+static void U_CALLCONV
+ucnv_MBCSToUTF8(UConverterFromUnicodeArgs *pFromUArgs,
+                UConverterToUnicodeArgs *pToUArgs,
+                UErrorCode *pErrorCode) {
+    UConverter *cnv, *utf8;
+    const uint8_t *source, *sourceLimit, *charStart;
+    uint8_t *target;
+    const uint8_t *targetLimit;
+
+    const int32_t (*stateTable)[256];
+    const int32_t *row;
+    const uint16_t *unicodeCodeUnits;
+
+    uint32_t offset;
+    uint8_t state, startState, lastState;
+    int32_t entry;
+    UChar32 c;
+    uint8_t action;
+    uint32_t asciiRoundtrips;
+
+    cnv=pToUArgs->converter;
+    utf8=pFromUArgs->converter;
+
+    if(cnv->toULength>0 || utf8->fromUChar32!=0) {
+        /* let the standard converters finish a partial character */
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        return;
+    }
+
+    /* set up the local pointers */
+    source=(const uint8_t *)pToUArgs->source;
+    sourceLimit=(const uint8_t *)pToUArgs->sourceLimit;
+    target=(uint8_t *)pFromUArgs->target;
+    targetLimit=(const uint8_t *)pFromUArgs->targetLimit;
+
+    if((cnv->options&UCNV_OPTION_SWAP_LFNL)!=0) {
+        stateTable=(const int32_t (*)[256])cnv->sharedData->mbcs.swapLFNLStateTable;
+    } else {
+        stateTable=cnv->sharedData->mbcs.stateTable;
+    }
+    unicodeCodeUnits=cnv->sharedData->mbcs.unicodeCodeUnits;
+
+    /* asciiRoundtrips is calculated from the state 0 toUnicode entries, see ucnv_MBCSLoad() */
+    if(stateTable==cnv->sharedData->mbcs.stateTable) {
+        asciiRoundtrips=cnv->sharedData->mbcs.asciiRoundtrips;
+    } else {
+        asciiRoundtrips=0;
+    }
+
+    /* see ucnv_MBCSToUnicodeWithOffsets() for the DBCS-only state */
+    if((state=(uint8_t)(cnv->mode))==0) {
+        state=cnv->sharedData->mbcs.dbcsOnlyState;
+    }
+
+    /* conversion loop */
+    while(source<sourceLimit) {
+        if(target>=targetLimit) {
+            /* target is full */
+            *pErrorCode=U_BUFFER_OVERFLOW_ERROR;
+            break;
+        }
+
+        /*
+         * Fast loop for 1/2-byte input and BMP output, like in ucnv_MBCSToUnicodeWithOffsets().
+         * The state row is only reloaded when the state changes, so that consecutive
+         * characters do not wait for each other's state table lookups.
+         */
+        row=stateTable[state];
+        while((targetLimit-target)>=3) {
+            entry=row[*source];
+            if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+                if((sourceLimit-source)<2) {
+                    break;
+                }
+                offset=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+                entry=stateTable[MBCS_ENTRY_TRANSITION_STATE(entry)][source[1]];
+                if( !MBCS_ENTRY_IS_FINAL(entry) ||
+                    MBCS_ENTRY_FINAL_ACTION(entry)!=MBCS_STATE_VALID_16 ||
+                    (c=unicodeCodeUnits[offset+MBCS_ENTRY_FINAL_VALUE_16(entry)])>=0xfffe ||
+                    U16_IS_SURROGATE(c)
+                ) {
+                    break;
+                }
+                source+=2;
+            } else if(MBCS_ENTRY_FINAL_IS_VALID_DIRECT_16(entry)) {
+                c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+                if(U16_IS_SURROGATE(c)) {
+                    break;
+                }
+                ++source;
+            } else {
+                break;
+            }
+            if(MBCS_ENTRY_FINAL_STATE(entry)!=state) {
+                state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry);
+                row=stateTable[state];
+            }
+            if(c<=0x7f) {
+                *target++=(uint8_t)c;
+                if(state==0 && source<sourceLimit && *source<=0x7f && IS_ASCII_ROUNDTRIP(*source, asciiRoundtrips)) {
+                    int32_t count=copyASCIIRun(source, sourceLimit, target, targetLimit, asciiRoundtrips);
+                    source+=count;
+                    target+=count;
+                }
+            } else if(c<=0x7ff) {
+                *target++=(uint8_t)((c>>6)|0xc0);
+                *target++=(uint8_t)((c&0x3f)|0x80);
+            } else {
+                *target++=(uint8_t)((c>>12)|0xe0);
+                *target++=(uint8_t)(((c>>6)&0x3f)|0x80);
+                *target++=(uint8_t)((c&0x3f)|0x80);
+            }
+            if(source==sourceLimit) {
+                break;
+            }
+        }
+        if(source==sourceLimit || target==targetLimit) {
+            continue;
+        }
+
+        charStart=source;
+        startState=state;
+        offset=0;
+        entry=stateTable[state][*source++];
+        while(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            state=(uint8_t)MBCS_ENTRY_TRANSITION_STATE(entry);
+            offset+=MBCS_ENTRY_TRANSITION_OFFSET(entry);
+            if(source==sourceLimit) {
+                break;
+            }
+            entry=stateTable[state][*source++];
+        }
+        if(MBCS_ENTRY_IS_TRANSITION(entry)) {
+            /* save a truncated character like ucnv_MBCSToUnicodeWithOffsets() does */
+            cnv->toULength=(int8_t)(source-charStart);
+            uprv_memcpy(cnv->toUBytes, charStart, cnv->toULength);
+            cnv->toUnicodeStatus=offset;
+            break;
+        }
+
+        /* the state in which the last byte was read, for SI/SO extension matching */
+        lastState=state;
+        state=(uint8_t)MBCS_ENTRY_FINAL_STATE(entry); /* typically 0 */
+
+        /* same action code handling as in ucnv_MBCSToUnicodeWithOffsets() */
+        action=(uint8_t)(MBCS_ENTRY_FINAL_ACTION(entry));
+        if(action==MBCS_STATE_VALID_16) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset];
+            if(c==0xfffe) {
+                if(UCNV_TO_U_USE_FALLBACK(cnv) && (entry=(int32_t)ucnv_MBCSGetFallback(&cnv->sharedData->mbcs, offset))!=0xfffe) {
+                    c=entry;
+                } else {
+                    c=MBCS_TO_UTF8_UNASSIGNED;
+                }
+            } else if(c==0xffff) {
+                c=MBCS_TO_UTF8_ILLEGAL;
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_16) {
+            c=MBCS_ENTRY_FINAL_VALUE_16(entry);
+        } else if(action==MBCS_STATE_VALID_16_PAIR) {
+            offset+=MBCS_ENTRY_FINAL_VALUE_16(entry);
+            c=unicodeCodeUnits[offset++];
+            if(c<0xd800) {
+                /* BMP code point below 0xd800 */
+            } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? c<=0xdfff : c<=0xdbff) {
+                /* roundtrip or fallback supplementary code point */
+                c=((c&0x3ff)<<10)+unicodeCodeUnits[offset]+(0x10000-0xdc00);
+            } else if(UCNV_TO_U_USE_FALLBACK(cnv) ? (c&0xfffe)==0xe000 : c==0xe000) {
+                /* roundtrip BMP code point above 0xd800 or fallback BMP code point */
+                c=unicodeCodeUnits[offset];
+            } else if(c==0xffff) {
+                c=MBCS_TO_UTF8_ILLEGAL;
+            } else {
+                c=MBCS_TO_UTF8_UNASSIGNED;
+            }
+        } else if(action==MBCS_STATE_VALID_DIRECT_20 ||
+                  (action==MBCS_STATE_FALLBACK_DIRECT_20 && UCNV_TO_U_USE_FALLBACK(cnv))
+        ) {
+            c=0x10000+MBCS_ENTRY_FINAL_VALUE(entry);
+        } else if(action==MBCS_STATE_CHANGE_ONLY) {
+            /* SI/SO are illegal for DBCS-only conversion */
+            c= cnv->sharedData->mbcs.dbcsOnlyState==0 ? MBCS_TO_UTF8_NO_OUTPUT : MBCS_TO_UTF8_ILLEGAL;
+        } else if(action==MBCS_STATE_FALLBACK_DIRECT_16) {
+            c= UCNV_TO_U_USE_FALLBACK(cnv) ? MBCS_ENTRY_FINAL_VALUE_16(entry) : MBCS_TO_UTF8_UNASSIGNED;
+        } else if(action==MBCS_STATE_UNASSIGNED) {
+            c=MBCS_TO_UTF8_UNASSIGNED;
+        } else if(action==MBCS_STATE_ILLEGAL) {
+            c=MBCS_TO_UTF8_ILLEGAL;
+        } else {
+            /* reserved, must never occur */
+            c=MBCS_TO_UTF8_NO_OUTPUT;
+        }
+
+        if(c>=0) {
+            /* output the code point */
+            if(c<=0x7f) {
+                *target++=(uint8_t)c;
+                continue;
+            } else if(!U_IS_SURROGATE(c) && U8_LENGTH(c)<=(targetLimit-target)) {
+                int32_t i=0;
+                U8_APPEND_UNSAFE(target, i, c);
+                target+=i;
+                continue;
+            }
+            /* single surrogate, or partial-character target overflow */
+        } else if(c==MBCS_TO_UTF8_NO_OUTPUT) {
+            continue;
+        } else if(c==MBCS_TO_UTF8_UNASSIGNED && (targetLimit-target)>=3*UCNV_EXT_MAX_UCHARS) {
+            /* try an extension mapping, via a small UTF-16 buffer */
+            UChar buffer[UCNV_EXT_MAX_UCHARS];
+            UChar *pBuffer=buffer;
+            UErrorCode errorCode=U_ZERO_ERROR;
+            int8_t length=(int8_t)(source-charStart);
+
+            uprv_memcpy(cnv->toUBytes, charStart, length);
+            cnv->mode=lastState;
+            _extToU(cnv, cnv->sharedData,
+                    length, &source, sourceLimit,
+                    &pBuffer, buffer+UPRV_LENGTHOF(buffer),
+                    NULL, -1,
+                    pToUArgs->flush,
+                    &errorCode);
+            if(U_SUCCESS(errorCode)) {
+                /* a mapping was found, or a partial match consumed the rest of the input */
+                int32_t i=0, j=0;
+                int32_t bufferLength=(int32_t)(pBuffer-buffer);
+                while(i<bufferLength) {
+                    U16_NEXT_UNSAFE(buffer, i, c);
+                    U8_APPEND_UNSAFE(target, j, c);
+                }
+                target+=j;
+                continue;
+            }
+        }
+
+        /* illegal or unmappable input: revert to pivoting from the start of this character */
+        source=charStart;
+        state=startState;
+        *pErrorCode=U_USING_DEFAULT_WARNING;
+        break;
+    }
+
+    /* set the converter state back into UConverter */
+    cnv->mode=state;
+
+    /* write back the updated pointers */
+    pToUArgs->source=(const char *)source;
+    pFromUArgs->target=(char *)target;
+}
+
 /* miscellaneous ------------------------------------------------------------ */
 
 static void U_CALLCONV
@@ -32,6 +32,14 @@
 U_CAPI  UBool U_EXPORT2 uprv_mapFile(UDataMemory *pdm, const char *path, UErrorCode *status);
 U_CFUNC void  uprv_unmapFile(UDataMemory *pData);
 
+/**
+ * Returns the length in bytes of the file mapped by uprv_mapFile(),
+ * or -1 if it is not known.
+ * uprv_mapFile() also sets pData->length, which must be copied along with
+ * the other fields when the mapping is handed to another UDataMemory.
+ */
+U_CAPI  int32_t U_EXPORT2 uprv_getMappedFileLength(const UDataMemory *pData);
+
 /* MAP_NONE: no memory mapping, no file access at all */
 #define MAP_NONE        0
 #define MAP_WIN32       1
@@ -0,0 +1,180 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// graphemeiter.h
+// created: 2026oct17
+
+#ifndef __GRAPHEMEITER_H__
+#define __GRAPHEMEITER_H__
+
+#include "unicode/utypes.h"
+
+#if U_SHOW_CPLUSPLUS_API
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/char16ptr.h"
+#include "unicode/stringpiece.h"
+#include "unicode/uobject.h"
+
+/**
+ * \file
+ * \brief C++ API: Extended grapheme cluster iteration over UTF-16 and UTF-8 strings.
+ */
+
+struct UCPTrie;
+
+U_NAMESPACE_BEGIN
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Lightweight forward iterator over the extended grapheme clusters
+ * (user-perceived characters) of a UTF-16 or UTF-8 string.
+ *
+ * It finds the same boundaries as BreakIterator::createCharacterInstance():
+ * Extended grapheme clusters as specified in Unicode Standard Annex #29,
+ * with ICU's tailoring that keeps Indic consonant conjuncts together.
+ * Unlike a BreakIterator, it works directly on the string without a UText,
+ * does not allocate memory, and can be a stack object. Only the first use
+ * in a process builds the shared character property data.
+ *
+ * The string must remain valid and unchanged while it is being iterated over.
+ * Unpaired surrogates and ill-formed UTF-8 sequences are each treated as
+ * one code point. In UTF-8, such a sequence behaves like U+FFFD.
+ *
+ * \code
+ * UErrorCode errorCode = U_ZERO_ERROR;
+ * GraphemeClusterIterator iter(u"e\u0301\U0001F1E9\U0001F1EA", -1, errorCode);
+ * for (int32_t end = iter.next(); end != GraphemeClusterIterator::DONE; end = iter.next()) {
+ *     // 2, 6
+ * }
+ * \endcode
+ *
+ * @see ugrapheme.h
+ * @see BreakIterator::createCharacterInstance
+ * @draft ICU 72
+ */
+class U_COMMON_API GraphemeClusterIterator U_FINAL : public UMemory {
+public:
+    enum {
+        /**
+         * Value returned by next() when there are no more boundaries.
+         * @draft ICU 72
+         */
+        DONE = (int32_t)-1
+    };
+
+    /**
+     * Constructs an iterator over a UTF-16 string.
+     * @param s UTF-16 string
+     * @param length length of s, or -1 if it is NUL-terminated
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  If it fails, then the iterator is empty.
+     * @draft ICU 72
+     */
+    GraphemeClusterIterator(ConstChar16Ptr s, int32_t length, UErrorCode &errorCode);
+
+    /**
+     * Constructs an iterator over a UTF-8 string.
+     * @param s UTF-8 string
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  If it fails, then the iterator is empty.
+     * @draft ICU 72
+     */
+    GraphemeClusterIterator(StringPiece s, UErrorCode &errorCode);
+
+    /**
+     * Moves the iterator to the start of the string.
+     * @return 0
+     * @draft ICU 72
+     */
+    int32_t first() {
+        index = 0;
+        return 0;
+    }
+
+    /**
+     * Moves the iterator to the end of the next grapheme cluster.
+     * @return the index after the grapheme cluster, in code units,
+     *         or DONE if the iterator was at the end of the string
+     * @draft ICU 72
+     */
+    int32_t next();
+
+    /**
+     * @return the index of the current boundary, in code units
+     * @draft ICU 72
+     */
+    int32_t current() const { return index; }
+
+    /**
+     * Counts the grapheme clusters in a UTF-16 string.
+     * @param s UTF-16 string
+     * @param length length of s, or -1 if it is NUL-terminated
+     * @param errorCode Standard ICU error code.
+     * @return the number of grapheme clusters
+     * @see ugrapheme_count
+     * @draft ICU 72
+     */
+    static int32_t count(ConstChar16Ptr s, int32_t length, UErrorCode &errorCode);
+
+    /**
+     * Counts the grapheme clusters in a UTF-8 string.
+     * @param s UTF-8 string
+     * @param errorCode Standard ICU error code.
+     * @return the number of grapheme clusters
+     * @see ugrapheme_countUTF8
+     * @draft ICU 72
+     */
+    static int32_t count(StringPiece s, UErrorCode &errorCode);
+
+    /**
+     * Returns the length of the longest prefix of a UTF-16 string that consists of
+     * at most maxCount whole grapheme clusters.
+     * @param s UTF-16 string
+     * @param length length of s, or -1 if it is NUL-terminated
+     * @param maxCount maximum number of grapheme clusters; must be >=0
+     * @param errorCode Standard ICU error code.
+     * @return the prefix length, at a grapheme cluster boundary
+     * @see ugrapheme_truncate
+     * @draft ICU 72
+     */
+    static int32_t truncate(ConstChar16Ptr s, int32_t length, int32_t maxCount,
+                            UErrorCode &errorCode);
+
+    /**
+     * Returns the length of the longest prefix of a UTF-8 string that consists of
+     * at most maxCount whole grapheme clusters.
+     * @param s UTF-8 string
+     * @param maxCount maximum number of grapheme clusters; must be >=0
+     * @param errorCode Standard ICU error code.
+     * @return the prefix length in bytes, at a grapheme cluster boundary
+     * @see ugrapheme_truncateUTF8
+     * @draft ICU 72
+     */
+    static int32_t truncate(StringPiece s, int32_t maxCount, UErrorCode &errorCode);
+
+private:
+    const UCPTrie *trie;
+    const char16_t *s16;  // nullptr for UTF-8
+    const char *s8;
+    int32_t length;
+    int32_t index;
+};
+
+#endif  // U_HIDE_DRAFT_API
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
+
+#endif  // U_SHOW_CPLUSPLUS_API
+
+#endif  // __GRAPHEMEITER_H__
@@ -37,7 +37,9 @@
 
 U_NAMESPACE_BEGIN
 
+class Appendable;
 class ByteSink;
+class CharString;
 
 /**
  * Unicode normalization functionality for standard Unicode normalization or
@@ -762,6 +764,124 @@ class U_COMMON_API FilteredNormalizer2 : public Normalizer2 {
     const UnicodeSet &set;
 };
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Incremental normalization of text that arrives in chunks.
+ *
+ * Each chunk is normalized up to the last normalization boundary in it
+ * (see Normalizer2::hasBoundaryBefore()), and the normalized text is appended
+ * to the output right away. Only the unstable tail after that boundary is held back
+ * and merged with the next chunk, so that memory use does not grow with the length of the text.
+ * Call finish() (or finishUTF8()) after the last chunk to flush the held-back text.
+ *
+ * The concatenated output is the same as the normalization of the
+ * concatenated input, for any way of splitting the input into chunks,
+ * including splits inside surrogate pairs or UTF-8 byte sequences.
+ *
+ * One instance handles either UTF-16 or UTF-8 text at a time;
+ * switching between them requires finish()/finishUTF8() or reset() in between.
+ * Instances are not thread-safe.
+ *
+ * @draft ICU 72
+ */
+class U_COMMON_API StreamingNormalizer2 U_FINAL : public UMemory {
+public:
+    /**
+     * Constructs a streaming normalizer.
+     * @param n2 wrapped Normalizer2 instance; must outlive this object
+     * @draft ICU 72
+     */
+    explicit StreamingNormalizer2(const Normalizer2 &n2);
+
+    /**
+     * Destructor.
+     * @draft ICU 72
+     */
+    ~StreamingNormalizer2();
+
+    /**
+     * Copy constructor is not supported.
+     * @draft ICU 72
+     */
+    StreamingNormalizer2(const StreamingNormalizer2 &other) = delete;
+
+    /**
+     * Assignment operator is not supported.
+     * @draft ICU 72
+     */
+    StreamingNormalizer2 &operator=(const StreamingNormalizer2 &other) = delete;
+
+    /**
+     * Normalizes the next chunk of UTF-16 text and appends as much
+     * of the normalized text as is stable to dest.
+     * @param chunk next piece of the input text
+     * @param dest receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Sets U_INVALID_STATE_ERROR if UTF-8 text is held back.
+     * @draft ICU 72
+     */
+    void normalizeChunk(const UnicodeString &chunk, Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Appends the normalized form of the held-back UTF-16 text to dest
+     * and resets this object for a new text.
+     * @param dest receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 72
+     */
+    void finish(Appendable &dest, UErrorCode &errorCode);
+
+    /**
+     * Normalizes the next chunk of UTF-8 text and writes as much
+     * of the normalized text as is stable to the sink.
+     * Ill-formed byte sequences are passed through as with Normalizer2::normalizeUTF8().
+     * @param chunk next piece of the input text
+     * @param sink receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     *                  Sets U_INVALID_STATE_ERROR if UTF-16 text is held back.
+     * @draft ICU 72
+     */
+    void normalizeChunkUTF8(StringPiece chunk, ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Writes the normalized form of the held-back UTF-8 text to the sink
+     * and resets this object for a new text.
+     * @param sink receives the normalized text
+     * @param errorCode Standard ICU error code. Its input value must
+     *                  pass the U_SUCCESS() test, or else the function returns
+     *                  immediately. Check for U_FAILURE() on output or use with
+     *                  function chaining. (See User Guide for details.)
+     * @draft ICU 72
+     */
+    void finishUTF8(ByteSink &sink, UErrorCode &errorCode);
+
+    /**
+     * Discards any held-back text.
+     * @draft ICU 72
+     */
+    void reset();
+
+private:
+    int32_t lastBoundary(const char16_t *s, int32_t length) const;
+    int32_t firstBoundary(const char16_t *s, int32_t limit) const;
+    int32_t lastBoundaryUTF8(const uint8_t *s, int32_t length) const;
+    int32_t firstBoundaryUTF8(const uint8_t *s, int32_t limit) const;
+
+    const Normalizer2 &norm2;
+    UnicodeString pending;
+    CharString *pending8;  // Pointer not object so we need not #include internal charstr.h.
+};
+#endif  // U_HIDE_DRAFT_API
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_NORMALIZATION
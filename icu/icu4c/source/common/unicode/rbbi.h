@@ -183,6 +183,14 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     RuleBasedBreakIterator(UDataMemory* image, UBool isPhraseBreaking, UErrorCode &status);
 
+    /**
+     * Constructor from compiled rules that are shared with other break iterators,
+     * for example through the cache of compiled rules.
+     * The break iterator adopts one reference to the data.
+     * @internal (private)
+     */
+    RuleBasedBreakIterator(RBBIDataWrapper* data, UErrorCode &status);
+
     /** @internal */
     friend class RBBIRuleBuilder;
     /** @internal */
@@ -539,6 +547,91 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
     */
     virtual int32_t getRuleStatusVec(int32_t *fillInVec, int32_t capacity, UErrorCode &status) override;
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Advances the iterator over up to capacity boundaries, as if by repeated calls
+     * to next(), and writes their positions and, optionally, their rule status values
+     * (as from getRuleStatus()) into arrays provided by the caller.
+     * This is much faster than calling next() for each boundary.
+     * <p>
+     * The iterator is left at the last boundary written, so that repeated calls
+     * return consecutive runs of boundaries. When there are no more boundaries,
+     * 0 is returned.
+     *
+     * @param boundaries  an array to be filled in with the boundary positions.
+     * @param ruleStatuses an array to be filled in with the rule status values of the
+     *                  boundaries; can be nullptr if they are not needed.
+     * @param capacity  the length of the arrays.
+     * @param status    receives error codes.
+     * @return          The number of boundaries written.
+     * @draft ICU 72
+     */
+    int32_t fillBoundaries(int32_t *boundaries, int32_t *ruleStatuses, int32_t capacity,
+                           UErrorCode &status);
+
+    /**
+     * Finds all of the boundaries of a text, as repeated calls to next() from first()
+     * would, and writes their positions and, optionally, their rule status values
+     * into arrays provided by the caller.
+     * <p>
+     * Large texts are split into chunks that are segmented on up to numThreads threads,
+     * each with its own clone of this break iterator. Where neighbouring chunks meet,
+     * their boundaries are joined at a boundary that both of them found away from
+     * dictionary text, so that the results are the same as those from a single thread.
+     * If a thread cannot be started, then its chunk is segmented on the calling thread.
+     * <p>
+     * This break iterator is not modified; its text and position are not used.
+     *
+     * @param text      the text to segment. It must not be modified while this function runs.
+     * @param boundaries an array to be filled in with the boundary positions.
+     * @param ruleStatuses an array to be filled in with the rule status values of the
+     *                  boundaries; can be nullptr if they are not needed.
+     * @param capacity  the length of the arrays.
+     * @param numThreads the maximum number of threads to use, including the calling thread.
+     *                  0 or negative uses the number of hardware threads.
+     * @param status    receives error codes. U_BUFFER_OVERFLOW_ERROR if there are more
+     *                  than capacity boundaries.
+     * @return          The number of boundaries in the text.
+     * @draft ICU 72
+     */
+    int32_t getAllBoundaries(UText *text, int32_t *boundaries, int32_t *ruleStatuses,
+                             int32_t capacity, int32_t numThreads, UErrorCode &status) const;
+
+    /**
+     * Updates the boundaries of a text after an edit, re-segmenting only the text
+     * near the edit instead of all of it. The boundaries before and after the edit
+     * are taken from the old ones, starting and ending at boundaries from which
+     * the segmentation cannot have changed.
+     * <p>
+     * Before calling this function, set the edited text with setText().
+     * The arrays hold the boundaries of the text before the edit, as from
+     * repeated calls to next() after first() or from fillBoundaries(), and are
+     * updated in place with those of the new text. Positions after the edit are
+     * shifted by the difference in length between the new and the replaced text.
+     * The time taken depends on the size of the edit and of the segments around it,
+     * not on the length of the text.
+     * <p>
+     * The iterator is left at a boundary after the edit.
+     *
+     * @param editStart the start index of the edit, the same in the old and new text.
+     * @param oldEditLimit the limit of the replaced text in the old text.
+     * @param newEditLimit the limit of the replacement text in the new text.
+     * @param boundaries in: the boundary positions of the old text;
+     *                  out: the boundary positions of the new text.
+     * @param ruleStatuses in: the rule status values of the boundaries of the old text,
+     *                  out: those of the new text; can be nullptr if they are not needed.
+     * @param length    the number of boundaries of the old text.
+     * @param capacity  the length of the arrays.
+     * @param status    receives error codes. U_BUFFER_OVERFLOW_ERROR if the new text
+     *                  has more than capacity boundaries; then the arrays are not modified.
+     * @return          The number of boundaries of the new text.
+     * @draft ICU 72
+     */
+    int32_t updateBoundaries(int32_t editStart, int32_t oldEditLimit, int32_t newEditLimit,
+                             int32_t *boundaries, int32_t *ruleStatuses,
+                             int32_t length, int32_t capacity, UErrorCode &status);
+#endif  /* U_HIDE_DRAFT_API */
+
     /**
      * Returns a unique class ID POLYMORPHICALLY.  Pure virtual override.
      * This method is to implement a simple version of RTTI, since not all
@@ -710,6 +803,14 @@ class U_COMMON_API RuleBasedBreakIterator /*U_FINAL*/ : public BreakIterator {
      */
     const LanguageBreakEngine *getLanguageBreakEngine(UChar32 c);
 
+    /**
+     * Returns true if the character before pos in the text is one that
+     * the rules hand to a dictionary break engine.
+     * @param pos  a text index > 0
+     * @internal (private)
+     */
+    UBool isDictionaryCharBefore(int32_t pos);
+
   public:
 #ifndef U_HIDE_INTERNAL_API
     /**
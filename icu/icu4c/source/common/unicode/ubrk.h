@@ -271,6 +271,48 @@ ubrk_openRules(const UChar     *rules,
                UParseError     *parseErr,
                UErrorCode      *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Like ubrk_openRules(), but keeps the compiled rules in a file
+ * in the cacheDir directory so that later calls with the same rules,
+ * also in other processes, need not compile them again.
+ *
+ * The cache file name is derived from a hash of the rule string.
+ * On a later call, the file is memory-mapped and the compiled rules
+ * are used in place, without parsing the rules or copying the data.
+ * The file is used only if it was written by the same ICU version
+ * for exactly the same rule string; otherwise the rules are compiled
+ * and the file is replaced.
+ * Failure to read or write the cache is not an error.
+ *
+ * Independent of the cache directory, ubrk_openRules() and this function
+ * share the compiled rules of recently used rule strings within the process.
+ *
+ * @param rules A set of rules specifying the text breaking conventions.
+ * @param rulesLength The number of characters in rules, or -1 if null-terminated.
+ * @param text The text to be iterated over.  May be null, in which case ubrk_setText() is
+ *        used to specify the text to be iterated.
+ * @param textLength The number of characters in text, or -1 if null-terminated.
+ * @param cacheDir An existing, writable directory for the cache files.
+ *                 If NULL or empty, then this function behaves like ubrk_openRules().
+ * @param parseErr   Receives position and context information for any syntax errors
+ *                   detected while parsing the rules.
+ * @param status A UErrorCode to receive any errors.
+ * @return A UBreakIterator for the specified rules.
+ * @see ubrk_openRules
+ * @see ubrk_getBinaryRules
+ * @draft ICU 72
+ */
+U_CAPI UBreakIterator* U_EXPORT2
+ubrk_openRulesWithCache(const UChar     *rules,
+                        int32_t         rulesLength,
+                        const UChar     *text,
+                        int32_t          textLength,
+                        const char      *cacheDir,
+                        UParseError     *parseErr,
+                        UErrorCode      *status);
+#endif /* U_HIDE_DRAFT_API */
+
 /**
  * Open a new UBreakIterator for locating text boundaries using precompiled binary rules.
  * Opening a UBreakIterator this way is substantially faster than using ubrk_openRules.
@@ -569,6 +611,102 @@ ubrk_getRuleStatus(UBreakIterator *bi);
 U_CAPI  int32_t U_EXPORT2
 ubrk_getRuleStatusVec(UBreakIterator *bi, int32_t *fillInVec, int32_t capacity, UErrorCode *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Advance the iterator over up to capacity boundaries, as if by repeated calls
+ * to ubrk_next(), and store their positions and, optionally, their rule status
+ * values (as from ubrk_getRuleStatus()) into arrays provided by the caller.
+ * For the rule based break iterators from ubrk_open() and ubrk_openRules(),
+ * this is much faster than calling ubrk_next() for each boundary.
+ * <p>
+ * The iterator is left at the last boundary stored, so that repeated calls
+ * return consecutive runs of boundaries. When there are no more boundaries,
+ * 0 is returned.
+ *
+ * @param bi           The break iterator to use.
+ * @param boundaries   an array to be filled in with the boundary positions.
+ * @param ruleStatuses an array to be filled in with the rule status values of the
+ *                     boundaries; can be NULL if they are not needed.
+ * @param capacity     the length of the arrays.
+ * @param status       receives error codes.
+ * @return             The number of boundaries stored.
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ubrk_getBoundaries(UBreakIterator *bi, int32_t *boundaries, int32_t *ruleStatuses,
+                   int32_t capacity, UErrorCode *status);
+
+/**
+ * Find all of the boundaries of a text, as repeated calls to ubrk_next() after
+ * ubrk_first() would, and store their positions and, optionally, their rule
+ * status values into arrays provided by the caller.
+ * <p>
+ * For the rule based break iterators from ubrk_open() and ubrk_openRules(),
+ * large texts are split into chunks that are segmented on up to numThreads
+ * threads, each with its own clone of the break iterator. The results are the
+ * same as those from a single thread. If a thread cannot be started, then its
+ * chunk is segmented on the calling thread.
+ * <p>
+ * The break iterator is not modified; its text and position are not used.
+ *
+ * @param bi           The break iterator to use.
+ * @param text         The text to segment. It must not be modified while this function runs.
+ * @param boundaries   an array to be filled in with the boundary positions.
+ * @param ruleStatuses an array to be filled in with the rule status values of the
+ *                     boundaries; can be NULL if they are not needed.
+ * @param capacity     the length of the arrays.
+ * @param numThreads   the maximum number of threads to use, including the calling thread.
+ *                     0 or negative uses the number of hardware threads.
+ * @param status       receives error codes. U_BUFFER_OVERFLOW_ERROR if there are more
+ *                     than capacity boundaries.
+ * @return             The number of boundaries in the text.
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ubrk_getAllBoundaries(const UBreakIterator *bi, UText *text,
+                      int32_t *boundaries, int32_t *ruleStatuses, int32_t capacity,
+                      int32_t numThreads, UErrorCode *status);
+
+/**
+ * Update the boundaries of a text after an edit, re-segmenting only the text
+ * near the edit instead of all of it. The boundaries before and after the edit
+ * are taken from the old ones, starting and ending at boundaries from which
+ * the segmentation cannot have changed.
+ * <p>
+ * Before calling this function, set the edited text with ubrk_setText() or
+ * ubrk_setUText(). The arrays hold the boundaries of the text before the edit,
+ * as from repeated calls to ubrk_next() after ubrk_first() or from
+ * ubrk_getBoundaries(), and are updated in place with those of the new text.
+ * Positions after the edit are shifted by the difference in length between
+ * the new and the replaced text.
+ * For the rule based break iterators from ubrk_open() and ubrk_openRules(),
+ * the time taken depends on the size of the edit and of the segments around it,
+ * not on the length of the text. Other break iterators segment the whole text.
+ * <p>
+ * The iterator is left at a boundary after the edit.
+ *
+ * @param bi           The break iterator to use.
+ * @param editStart    the start index of the edit, the same in the old and new text.
+ * @param oldEditLimit the limit of the replaced text in the old text.
+ * @param newEditLimit the limit of the replacement text in the new text.
+ * @param boundaries   in: the boundary positions of the old text;
+ *                     out: the boundary positions of the new text.
+ * @param ruleStatuses in: the rule status values of the boundaries of the old text,
+ *                     out: those of the new text; can be NULL if they are not needed.
+ * @param length       the number of boundaries of the old text.
+ * @param capacity     the length of the arrays.
+ * @param status       receives error codes. U_BUFFER_OVERFLOW_ERROR if the new text
+ *                     has more than capacity boundaries; then the arrays are not modified.
+ * @return             The number of boundaries of the new text.
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ubrk_updateBoundaries(UBreakIterator *bi,
+                      int32_t editStart, int32_t oldEditLimit, int32_t newEditLimit,
+                      int32_t *boundaries, int32_t *ruleStatuses,
+                      int32_t length, int32_t capacity, UErrorCode *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
  * Return the locale of the break iterator. You can choose between the valid and
  * the actual locale.
@@ -583,6 +583,62 @@ ucnv_safeClone(const UConverter *cnv,
 U_CAPI void  U_EXPORT2
 ucnv_close(UConverter * converter);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Opens a converter like ucnv_open(), but first tries to take one
+ * from a process-wide pool of converters that were returned with ucnv_recycle().
+ *
+ * The pool is keyed by the canonical converter name, so any alias of
+ * a converter finds the pooled converters for it. Taking a converter from
+ * the pool does not lock any mutex and does not allocate memory.
+ * This helps applications that open and close converters
+ * at a high rate on many threads.
+ * If the pool has no converter for the name, then a new one is opened.
+ * Names with options (e.g., "ibm-1047,swaplfnl") and names that are not
+ * in the alias table always open a new converter.
+ *
+ * A pooled converter is in its initial state, as after ucnv_reset(),
+ * with the default callbacks and substitution characters.
+ *
+ * The converter can be closed with ucnv_close() or returned to the pool
+ * with ucnv_recycle(). Converters need not have been opened by this function
+ * to be recycled.
+ *
+ * @param converterName Name of the converter, as for ucnv_open().
+ *                      If NULL or empty, then the default converter is used.
+ * @param err outgoing error status
+ * @return the created Unicode converter object, or <TT>NULL</TT> if an error occurred
+ * @see ucnv_open
+ * @see ucnv_recycle
+ * @draft ICU 72
+ */
+U_CAPI UConverter* U_EXPORT2
+ucnv_openPooled(const char *converterName, UErrorCode *err);
+
+/**
+ * Resets the converter and returns it to the process-wide converter pool
+ * so that a later ucnv_openPooled() for the same converter can reuse it.
+ * This does not lock any mutex unless the pool is full, in which case
+ * the converter is closed with ucnv_close().
+ *
+ * Converters whose substitution characters or fallback behavior were changed
+ * from the defaults, converters opened with options (e.g., "ibm-1047,swaplfnl")
+ * or with ucnv_openPackage(), and converters created with ucnv_safeClone()
+ * in a caller-provided buffer, are closed rather than pooled.
+ * Callbacks other than the defaults are called with UCNV_CLOSE, as in ucnv_close(),
+ * so that they can release their contexts, and are then replaced by the defaults.
+ * The caller must not use the converter after this call.
+ * The pool is emptied by ucnv_flushCache().
+ *
+ * @param converter the converter object to be recycled; may be NULL
+ * @see ucnv_openPooled
+ * @see ucnv_close
+ * @draft ICU 72
+ */
+U_CAPI void U_EXPORT2
+ucnv_recycle(UConverter *converter);
+#endif /* U_HIDE_DRAFT_API */
+
 #if U_SHOW_CPLUSPLUS_API
 
 U_NAMESPACE_BEGIN
@@ -1690,6 +1746,7 @@ ucnv_fromAlgorithmic(UConverter *cnv,
 
 /**
  * Frees up memory occupied by unused, cached converter shared data.
+ * Also closes the converters in the ucnv_openPooled() pool.
  *
  * @return the number of cached converters successfully deleted
  * @see ucnv_close
@@ -1698,6 +1755,48 @@ ucnv_fromAlgorithmic(UConverter *cnv,
 U_CAPI int32_t U_EXPORT2
 ucnv_flushCache(void);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Limits the memory used by the cache of converter data.
+ *
+ * ICU caches the data of a data-based converter after it is first opened,
+ * so that converters with the same name open quickly, and keeps the data
+ * until ucnv_flushCache() even if no converter uses it any more.
+ * With a limit, whenever the total size of the cached data exceeds it,
+ * ICU unloads the data that is not used by any open converter,
+ * least recently used first, until the cache fits into the limit again.
+ * Data that is used by open converters is never unloaded,
+ * so the cache can exceed the limit.
+ *
+ * Converter data files are memory-mapped where the platform supports it;
+ * unloading the data of a converter that was loaded from its own .cnv file
+ * unmaps the file.
+ *
+ * The default is no limit. u_cleanup() resets the limit.
+ *
+ * @param maxBytes the maximum number of bytes of cached converter data;
+ *                 0 unloads converter data as soon as it is unused;
+ *                 negative for no limit
+ * @see ucnv_getCacheMemoryUsage
+ * @see ucnv_flushCache
+ * @draft ICU 72
+ */
+U_CAPI void U_EXPORT2
+ucnv_setCacheMemoryLimit(int32_t maxBytes);
+
+/**
+ * Returns the total size of the cached converter data, in bytes,
+ * as accounted for by ucnv_setCacheMemoryLimit().
+ * This includes the data of open converters.
+ *
+ * @return the number of bytes of cached converter data
+ * @see ucnv_setCacheMemoryLimit
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ucnv_getCacheMemoryUsage(void);
+#endif /* U_HIDE_DRAFT_API */
+
 /**
  * Returns the number of available converters, as per the alias file.
  *
@@ -0,0 +1,131 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ugrapheme.h
+// created: 2026oct17
+
+#ifndef __UGRAPHEME_H__
+#define __UGRAPHEME_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+/**
+ * \file
+ * \brief C API: Extended grapheme cluster boundaries in UTF-16 and UTF-8 strings.
+ *
+ * These functions find the same boundaries as a character break iterator
+ * from ubrk_open(UBRK_CHARACTER, ...): Extended grapheme clusters as specified
+ * in Unicode Standard Annex #29, with ICU's tailoring that keeps
+ * Indic consonant conjuncts together.
+ *
+ * Unlike a UBreakIterator, they work directly on the string and never allocate memory
+ * after the first call, which builds the shared character property data.
+ * Each call starts at a boundary and only looks forward, which is what
+ * counting clusters and truncating a string to a number of clusters need.
+ *
+ * Unpaired surrogates and ill-formed UTF-8 sequences are each treated as
+ * one code point. In UTF-8, such a sequence behaves like U+FFFD.
+ *
+ * @see ubrk_open
+ * @see icu::GraphemeClusterIterator
+ */
+
+#ifndef U_HIDE_DRAFT_API
+
+/**
+ * Returns the end of the extended grapheme cluster that starts at index start.
+ *
+ * @param s UTF-16 string
+ * @param start index of a grapheme cluster boundary in s, for example 0 or
+ *              the result of the previous call; must be 0<=start<=length
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the index after the grapheme cluster, which is >start if start<length,
+ *         or length if start==length
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ugrapheme_next(const UChar *s, int32_t start, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * Returns the end of the extended grapheme cluster that starts at index start.
+ *
+ * @param s UTF-8 string
+ * @param start index of a grapheme cluster boundary in s, for example 0 or
+ *              the result of the previous call; must be 0<=start<=length
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the index after the grapheme cluster, which is >start if start<length,
+ *         or length if start==length
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ugrapheme_nextUTF8(const char *s, int32_t start, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * Counts the extended grapheme clusters (user-perceived characters) in the string.
+ *
+ * @param s UTF-16 string
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the number of grapheme clusters
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ugrapheme_count(const UChar *s, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * Counts the extended grapheme clusters (user-perceived characters) in the string.
+ *
+ * @param s UTF-8 string
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the number of grapheme clusters
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ugrapheme_countUTF8(const char *s, int32_t length, UErrorCode *pErrorCode);
+
+/**
+ * Returns the length of the longest prefix of the string that consists of
+ * at most maxCount whole extended grapheme clusters.
+ * For example, to truncate a string to 10 user-perceived characters,
+ * keep the first ugrapheme_truncate(s, length, 10, &errorCode) code units.
+ *
+ * @param s UTF-16 string
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param maxCount maximum number of grapheme clusters; must be >=0
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the prefix length, at a grapheme cluster boundary
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ugrapheme_truncate(const UChar *s, int32_t length, int32_t maxCount, UErrorCode *pErrorCode);
+
+/**
+ * Returns the length of the longest prefix of the string that consists of
+ * at most maxCount whole extended grapheme clusters.
+ *
+ * @param s UTF-8 string
+ * @param length length of s, or -1 if it is NUL-terminated
+ * @param maxCount maximum number of grapheme clusters; must be >=0
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return the prefix length in bytes, at a grapheme cluster boundary
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ugrapheme_truncateUTF8(const char *s, int32_t length, int32_t maxCount, UErrorCode *pErrorCode);
+
+#endif  // U_HIDE_DRAFT_API
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
+
+#endif  // __UGRAPHEME_H__
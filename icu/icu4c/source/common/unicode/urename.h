@@ -494,8 +494,10 @@
 #define ubrk_current U_ICU_ENTRY_POINT_RENAME(ubrk_current)
 #define ubrk_first U_ICU_ENTRY_POINT_RENAME(ubrk_first)
 #define ubrk_following U_ICU_ENTRY_POINT_RENAME(ubrk_following)
+#define ubrk_getAllBoundaries U_ICU_ENTRY_POINT_RENAME(ubrk_getAllBoundaries)
 #define ubrk_getAvailable U_ICU_ENTRY_POINT_RENAME(ubrk_getAvailable)
 #define ubrk_getBinaryRules U_ICU_ENTRY_POINT_RENAME(ubrk_getBinaryRules)
+#define ubrk_getBoundaries U_ICU_ENTRY_POINT_RENAME(ubrk_getBoundaries)
 #define ubrk_getLocaleByType U_ICU_ENTRY_POINT_RENAME(ubrk_getLocaleByType)
 #define ubrk_getRuleStatus U_ICU_ENTRY_POINT_RENAME(ubrk_getRuleStatus)
 #define ubrk_getRuleStatusVec U_ICU_ENTRY_POINT_RENAME(ubrk_getRuleStatusVec)
@@ -505,6 +507,7 @@
 #define ubrk_open U_ICU_ENTRY_POINT_RENAME(ubrk_open)
 #define ubrk_openBinaryRules U_ICU_ENTRY_POINT_RENAME(ubrk_openBinaryRules)
 #define ubrk_openRules U_ICU_ENTRY_POINT_RENAME(ubrk_openRules)
+#define ubrk_openRulesWithCache U_ICU_ENTRY_POINT_RENAME(ubrk_openRulesWithCache)
 #define ubrk_preceding U_ICU_ENTRY_POINT_RENAME(ubrk_preceding)
 #define ubrk_previous U_ICU_ENTRY_POINT_RENAME(ubrk_previous)
 #define ubrk_refreshUText U_ICU_ENTRY_POINT_RENAME(ubrk_refreshUText)
@@ -512,6 +515,7 @@
 #define ubrk_setText U_ICU_ENTRY_POINT_RENAME(ubrk_setText)
 #define ubrk_setUText U_ICU_ENTRY_POINT_RENAME(ubrk_setUText)
 #define ubrk_swap U_ICU_ENTRY_POINT_RENAME(ubrk_swap)
+#define ubrk_updateBoundaries U_ICU_ENTRY_POINT_RENAME(ubrk_updateBoundaries)
 #define ucache_compareKeys U_ICU_ENTRY_POINT_RENAME(ucache_compareKeys)
 #define ucache_deleteKey U_ICU_ENTRY_POINT_RENAME(ucache_deleteKey)
 #define ucache_hashKeys U_ICU_ENTRY_POINT_RENAME(ucache_hashKeys)
@@ -665,6 +669,7 @@
 #define ucnv_getAliases U_ICU_ENTRY_POINT_RENAME(ucnv_getAliases)
 #define ucnv_getAvailableName U_ICU_ENTRY_POINT_RENAME(ucnv_getAvailableName)
 #define ucnv_getCCSID U_ICU_ENTRY_POINT_RENAME(ucnv_getCCSID)
+#define ucnv_getCacheMemoryUsage U_ICU_ENTRY_POINT_RENAME(ucnv_getCacheMemoryUsage)
 #define ucnv_getCanonicalName U_ICU_ENTRY_POINT_RENAME(ucnv_getCanonicalName)
 #define ucnv_getCompleteUnicodeSet U_ICU_ENTRY_POINT_RENAME(ucnv_getCompleteUnicodeSet)
 #define ucnv_getDefaultName U_ICU_ENTRY_POINT_RENAME(ucnv_getDefaultName)
@@ -694,16 +699,20 @@
 #define ucnv_isFixedWidth U_ICU_ENTRY_POINT_RENAME(ucnv_isFixedWidth)
 #define ucnv_load U_ICU_ENTRY_POINT_RENAME(ucnv_load)
 #define ucnv_loadSharedData U_ICU_ENTRY_POINT_RENAME(ucnv_loadSharedData)
+#define ucnv_notifyCallbacksOfClose U_ICU_ENTRY_POINT_RENAME(ucnv_notifyCallbacksOfClose)
 #define ucnv_open U_ICU_ENTRY_POINT_RENAME(ucnv_open)
 #define ucnv_openAllNames U_ICU_ENTRY_POINT_RENAME(ucnv_openAllNames)
 #define ucnv_openCCSID U_ICU_ENTRY_POINT_RENAME(ucnv_openCCSID)
 #define ucnv_openPackage U_ICU_ENTRY_POINT_RENAME(ucnv_openPackage)
+#define ucnv_openPooled U_ICU_ENTRY_POINT_RENAME(ucnv_openPooled)
 #define ucnv_openStandardNames U_ICU_ENTRY_POINT_RENAME(ucnv_openStandardNames)
 #define ucnv_openU U_ICU_ENTRY_POINT_RENAME(ucnv_openU)
+#define ucnv_recycle U_ICU_ENTRY_POINT_RENAME(ucnv_recycle)
 #define ucnv_reset U_ICU_ENTRY_POINT_RENAME(ucnv_reset)
 #define ucnv_resetFromUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetFromUnicode)
 #define ucnv_resetToUnicode U_ICU_ENTRY_POINT_RENAME(ucnv_resetToUnicode)
 #define ucnv_safeClone U_ICU_ENTRY_POINT_RENAME(ucnv_safeClone)
+#define ucnv_setCacheMemoryLimit U_ICU_ENTRY_POINT_RENAME(ucnv_setCacheMemoryLimit)
 #define ucnv_setDefaultName U_ICU_ENTRY_POINT_RENAME(ucnv_setDefaultName)
 #define ucnv_setFallback U_ICU_ENTRY_POINT_RENAME(ucnv_setFallback)
 #define ucnv_setFromUCallBack U_ICU_ENTRY_POINT_RENAME(ucnv_setFromUCallBack)
@@ -737,6 +746,7 @@
 #define ucol_getAttribute U_ICU_ENTRY_POINT_RENAME(ucol_getAttribute)
 #define ucol_getAvailable U_ICU_ENTRY_POINT_RENAME(ucol_getAvailable)
 #define ucol_getBound U_ICU_ENTRY_POINT_RENAME(ucol_getBound)
+#define ucol_getCompactSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getCompactSortKey)
 #define ucol_getContractions U_ICU_ENTRY_POINT_RENAME(ucol_getContractions)
 #define ucol_getContractionsAndExpansions U_ICU_ENTRY_POINT_RENAME(ucol_getContractionsAndExpansions)
 #define ucol_getDisplayName U_ICU_ENTRY_POINT_RENAME(ucol_getDisplayName)
@@ -755,6 +765,7 @@
 #define ucol_getRulesEx U_ICU_ENTRY_POINT_RENAME(ucol_getRulesEx)
 #define ucol_getShortDefinitionString U_ICU_ENTRY_POINT_RENAME(ucol_getShortDefinitionString)
 #define ucol_getSortKey U_ICU_ENTRY_POINT_RENAME(ucol_getSortKey)
+#define ucol_getSortKeys U_ICU_ENTRY_POINT_RENAME(ucol_getSortKeys)
 #define ucol_getStrength U_ICU_ENTRY_POINT_RENAME(ucol_getStrength)
 #define ucol_getTailoredSet U_ICU_ENTRY_POINT_RENAME(ucol_getTailoredSet)
 #define ucol_getUCAVersion U_ICU_ENTRY_POINT_RENAME(ucol_getUCAVersion)
@@ -775,6 +786,7 @@
 #define ucol_openElements U_ICU_ENTRY_POINT_RENAME(ucol_openElements)
 #define ucol_openFromShortString U_ICU_ENTRY_POINT_RENAME(ucol_openFromShortString)
 #define ucol_openRules U_ICU_ENTRY_POINT_RENAME(ucol_openRules)
+#define ucol_openRulesWithCache U_ICU_ENTRY_POINT_RENAME(ucol_openRulesWithCache)
 #define ucol_prepareShortStringOpen U_ICU_ENTRY_POINT_RENAME(ucol_prepareShortStringOpen)
 #define ucol_previous U_ICU_ENTRY_POINT_RENAME(ucol_previous)
 #define ucol_primaryOrder U_ICU_ENTRY_POINT_RENAME(ucol_primaryOrder)
@@ -789,6 +801,8 @@
 #define ucol_setStrength U_ICU_ENTRY_POINT_RENAME(ucol_setStrength)
 #define ucol_setText U_ICU_ENTRY_POINT_RENAME(ucol_setText)
 #define ucol_setVariableTop U_ICU_ENTRY_POINT_RENAME(ucol_setVariableTop)
+#define ucol_sortStrings U_ICU_ENTRY_POINT_RENAME(ucol_sortStrings)
+#define ucol_sortStringsUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_sortStringsUTF8)
 #define ucol_strcoll U_ICU_ENTRY_POINT_RENAME(ucol_strcoll)
 #define ucol_strcollIter U_ICU_ENTRY_POINT_RENAME(ucol_strcollIter)
 #define ucol_strcollUTF8 U_ICU_ENTRY_POINT_RENAME(ucol_strcollUTF8)
@@ -973,6 +987,12 @@
 #define ufmtval_nextPosition U_ICU_ENTRY_POINT_RENAME(ufmtval_nextPosition)
 #define ugender_getInstance U_ICU_ENTRY_POINT_RENAME(ugender_getInstance)
 #define ugender_getListGender U_ICU_ENTRY_POINT_RENAME(ugender_getListGender)
+#define ugrapheme_count U_ICU_ENTRY_POINT_RENAME(ugrapheme_count)
+#define ugrapheme_countUTF8 U_ICU_ENTRY_POINT_RENAME(ugrapheme_countUTF8)
+#define ugrapheme_next U_ICU_ENTRY_POINT_RENAME(ugrapheme_next)
+#define ugrapheme_nextUTF8 U_ICU_ENTRY_POINT_RENAME(ugrapheme_nextUTF8)
+#define ugrapheme_truncate U_ICU_ENTRY_POINT_RENAME(ugrapheme_truncate)
+#define ugrapheme_truncateUTF8 U_ICU_ENTRY_POINT_RENAME(ugrapheme_truncateUTF8)
 #define uhash_close U_ICU_ENTRY_POINT_RENAME(uhash_close)
 #define uhash_compareCaselessUnicodeString U_ICU_ENTRY_POINT_RENAME(uhash_compareCaselessUnicodeString)
 #define uhash_compareChars U_ICU_ENTRY_POINT_RENAME(uhash_compareChars)
@@ -1443,9 +1463,11 @@
 #define uprv_getCharNameCharacters U_ICU_ENTRY_POINT_RENAME(uprv_getCharNameCharacters)
 #define uprv_getDefaultLocaleID U_ICU_ENTRY_POINT_RENAME(uprv_getDefaultLocaleID)
 #define uprv_getInfinity U_ICU_ENTRY_POINT_RENAME(uprv_getInfinity)
+#define uprv_getMappedFileLength U_ICU_ENTRY_POINT_RENAME(uprv_getMappedFileLength)
 #define uprv_getMaxCharNameLength U_ICU_ENTRY_POINT_RENAME(uprv_getMaxCharNameLength)
 #define uprv_getMaxValues U_ICU_ENTRY_POINT_RENAME(uprv_getMaxValues)
 #define uprv_getNaN U_ICU_ENTRY_POINT_RENAME(uprv_getNaN)
+#define uprv_getNumberOfProcessors U_ICU_ENTRY_POINT_RENAME(uprv_getNumberOfProcessors)
 #define uprv_getRawUTCtime U_ICU_ENTRY_POINT_RENAME(uprv_getRawUTCtime)
 #define uprv_getStaticCurrencyName U_ICU_ENTRY_POINT_RENAME(uprv_getStaticCurrencyName)
 #define uprv_getUTCtime U_ICU_ENTRY_POINT_RENAME(uprv_getUTCtime)
@@ -1474,6 +1496,7 @@
 #define uprv_pow10 U_ICU_ENTRY_POINT_RENAME(uprv_pow10)
 #define uprv_realloc U_ICU_ENTRY_POINT_RENAME(uprv_realloc)
 #define uprv_round U_ICU_ENTRY_POINT_RENAME(uprv_round)
+#define uprv_runInParallel U_ICU_ENTRY_POINT_RENAME(uprv_runInParallel)
 #define uprv_sortArray U_ICU_ENTRY_POINT_RENAME(uprv_sortArray)
 #define uprv_stableBinarySearch U_ICU_ENTRY_POINT_RENAME(uprv_stableBinarySearch)
 #define uprv_strCompare U_ICU_ENTRY_POINT_RENAME(uprv_strCompare)
@@ -1684,6 +1707,7 @@
 #define usearch_setOffset U_ICU_ENTRY_POINT_RENAME(usearch_setOffset)
 #define usearch_setPattern U_ICU_ENTRY_POINT_RENAME(usearch_setPattern)
 #define usearch_setText U_ICU_ENTRY_POINT_RENAME(usearch_setText)
+#define usearch_setTextUTF8 U_ICU_ENTRY_POINT_RENAME(usearch_setTextUTF8)
 #define uset_add U_ICU_ENTRY_POINT_RENAME(uset_add)
 #define uset_addAll U_ICU_ENTRY_POINT_RENAME(uset_addAll)
 #define uset_addAllCodePoints U_ICU_ENTRY_POINT_RENAME(uset_addAllCodePoints)
@@ -0,0 +1,117 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// uparallel.cpp
+// created: 2026oct17
+
+// Defines _XOPEN_SOURCE for access to POSIX functions.
+// Must be before any other #includes.
+#include "uposixdefs.h"
+
+#include "unicode/utypes.h"
+#include "uparallel.h"
+
+#if U_PLATFORM_USES_ONLY_WIN32_API && !U_PLATFORM_HAS_WINUWP_API
+#   define UPARALLEL_USE_WIN32 1
+#   ifndef WIN32_LEAN_AND_MEAN
+#       define WIN32_LEAN_AND_MEAN
+#   endif
+#   define VC_EXTRALEAN
+#   define NOUSER
+#   define NOSERVICE
+#   define NOIME
+#   define NOMCX
+#   include <windows.h>
+#   include <process.h>
+#elif U_PLATFORM_IMPLEMENTS_POSIX && !defined(__wasi__)
+#   define UPARALLEL_USE_PTHREADS 1
+#   include <pthread.h>
+#   include <unistd.h>
+#endif
+
+namespace {
+
+struct ThreadArgs {
+    UParallelTask *task;
+    void *context;
+    int32_t index;
+};
+
+#if UPARALLEL_USE_WIN32
+unsigned __stdcall runThread(void *arg) {
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+    args->task(args->context, args->index);
+    return 0;
+}
+#elif UPARALLEL_USE_PTHREADS
+extern "C" void *runThread(void *arg) {
+    ThreadArgs *args = static_cast<ThreadArgs *>(arg);
+    args->task(args->context, args->index);
+    return nullptr;
+}
+#endif
+
+}  // namespace
+
+U_CAPI int32_t U_EXPORT2
+uprv_getNumberOfProcessors() {
+#if UPARALLEL_USE_WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors > 0 ? (int32_t)info.dwNumberOfProcessors : 1;
+#elif UPARALLEL_USE_PTHREADS && defined(_SC_NPROCESSORS_ONLN)
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? (int32_t)(count < INT32_MAX ? count : INT32_MAX) : 1;
+#else
+    return 1;
+#endif
+}
+
+U_CAPI void U_EXPORT2
+uprv_runInParallel(UParallelTask *task, void *context, int32_t count) {
+    if (count <= 0) {
+        return;
+    }
+#if UPARALLEL_USE_WIN32 || UPARALLEL_USE_PTHREADS
+    ThreadArgs args[U_PARALLEL_MAX_THREADS];
+#if UPARALLEL_USE_WIN32
+    HANDLE threads[U_PARALLEL_MAX_THREADS];
+#else
+    pthread_t threads[U_PARALLEL_MAX_THREADS];
+#endif
+    UBool started[U_PARALLEL_MAX_THREADS];
+    int32_t numThreads = count < U_PARALLEL_MAX_THREADS ? count : U_PARALLEL_MAX_THREADS;
+    for (int32_t i = 1; i < numThreads; ++i) {
+        args[i].task = task;
+        args[i].context = context;
+        args[i].index = i;
+#if UPARALLEL_USE_WIN32
+        threads[i] = (HANDLE)_beginthreadex(NULL, 0, runThread, &args[i], 0, NULL);
+        started[i] = threads[i] != 0;
+#else
+        started[i] = pthread_create(&threads[i], NULL, runThread, &args[i]) == 0;
+#endif
+    }
+    task(context, 0);
+    // Run the tasks without threads on this one.
+    for (int32_t i = 1; i < count; ++i) {
+        if (i >= numThreads || !started[i]) {
+            task(context, i);
+        }
+    }
+    for (int32_t i = 1; i < numThreads; ++i) {
+        if (started[i]) {
+#if UPARALLEL_USE_WIN32
+            WaitForSingleObject(threads[i], INFINITE);
+            CloseHandle(threads[i]);
+#else
+            pthread_join(threads[i], NULL);
+#endif
+        }
+    }
+#else
+    for (int32_t i = 0; i < count; ++i) {
+        task(context, i);
+    }
+#endif
+}
@@ -0,0 +1,82 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// uparallel.h
+// created: 2026oct17
+
+// Internal functions for running independent tasks on multiple threads.
+// They use the platform's thread API directly so that they neither
+// throw exceptions nor allocate with the global operator new.
+
+#ifndef __UPARALLEL_H__
+#define __UPARALLEL_H__
+
+#include "unicode/utypes.h"
+
+/** The maximum number of tasks that uprv_runInParallel() runs at the same time. */
+#define U_PARALLEL_MAX_THREADS 64
+
+U_CDECL_BEGIN
+/**
+ * Function type for one of the tasks of uprv_runInParallel().
+ *
+ * @param context Application-specific pointer, passed through by uprv_runInParallel().
+ * @param index   The index of the task, 0<=index<count.
+ *
+ * @internal
+ */
+typedef void U_CALLCONV
+UParallelTask(void *context, int32_t index);
+U_CDECL_END
+
+/**
+ * Returns the number of processors that are available to the process, at least 1.
+ *
+ * @internal
+ */
+U_CAPI int32_t U_EXPORT2
+uprv_getNumberOfProcessors(void);
+
+/**
+ * Calls task(context, i) for each 0<=i<count and returns when all of them are done.
+ * Task 0 runs on the calling thread, and each other one on a new thread.
+ * A task whose thread cannot be started, or which exceeds U_PARALLEL_MAX_THREADS,
+ * runs on the calling thread instead.
+ * On platforms without thread support, all tasks run on the calling thread.
+ *
+ * @param task    The function to run.
+ * @param context Application-specific pointer, passed through to the task.
+ * @param count   The number of tasks.
+ *
+ * @internal
+ */
+U_CAPI void U_EXPORT2
+uprv_runInParallel(UParallelTask *task, void *context, int32_t count);
+
+#ifdef __cplusplus
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Runs task(contexts[i]) for each 0<=i<count via uprv_runInParallel().
+ * @internal
+ */
+template<typename T>
+void runInParallel(void (*task)(T &), T *contexts, int32_t count) {
+    struct Tasks {
+        void (*task)(T &);
+        T *contexts;
+
+        static void U_CALLCONV run(void *context, int32_t index) {
+            Tasks *tasks = static_cast<Tasks *>(context);
+            tasks->task(tasks->contexts[index]);
+        }
+    } tasks = { task, contexts };
+    uprv_runInParallel(Tasks::run, &tasks, count);
+}
+
+U_NAMESPACE_END
+
+#endif  // __cplusplus
+
+#endif  // __UPARALLEL_H__
@@ -0,0 +1,355 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// usimd.h
+// created: 2026oct17
+
+// Small set of vectorized span and copy helpers for hot scanning and conversion loops.
+// The vector code is selected at compile time for instruction sets that are
+// part of the baseline of the target architecture (SSE2 on x86-64, NEON on AArch64),
+// so that no runtime CPU detection is needed.
+// Every function has a scalar fallback and returns exactly
+// the same result as the equivalent simple loop.
+// Define U_SIMD_DISABLE to force the scalar code.
+
+#ifndef USIMD_H
+#define USIMD_H
+
+#include "unicode/utypes.h"
+
+#if defined(U_SIMD_DISABLE)
+    // Scalar only.
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#   define U_SIMD_SSE2 1
+#   include <emmintrin.h>
+#elif (defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)) && \
+        (defined(__aarch64__) || defined(_M_ARM64))
+#   define U_SIMD_NEON 1
+#   include <arm_neon.h>
+#endif
+
+#ifndef U_SIMD_SSE2
+#   define U_SIMD_SSE2 0
+#endif
+#ifndef U_SIMD_NEON
+#   define U_SIMD_NEON 0
+#endif
+
+/**
+ * Marks a function that wraps a bulk helper for a hot per-character loop.
+ * Keeping the vector code out of line keeps the loop's registers for the
+ * per-character work, which otherwise gets slower for non-ASCII text.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#   define U_SIMD_NOINLINE __attribute__((noinline))
+#elif defined(_MSC_VER)
+#   define U_SIMD_NOINLINE __declspec(noinline)
+#else
+#   define U_SIMD_NOINLINE
+#endif
+
+U_NAMESPACE_BEGIN
+
+class SIMDUtil {
+public:
+    SIMDUtil() = delete;  // all static
+
+    /**
+     * Returns the first position in [s, limit[ whose code unit is >=min,
+     * or limit if all code units are below min.
+     */
+    static inline const char16_t *spanBelow(const char16_t *s, const char16_t *limit, char16_t min) {
+        if (min == 0) {
+            return s;
+        }
+#if U_SIMD_SSE2
+        // SSE2 has no unsigned 16-bit comparison:
+        // u<min exactly when the saturating difference u-(min-1) is 0.
+        const __m128i threshold = _mm_set1_epi16(static_cast<short>(min - 1));
+        const __m128i zero = _mm_setzero_si128();
+        while ((limit - s) >= 8) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+            __m128i below = _mm_cmpeq_epi16(_mm_subs_epu16(v, threshold), zero);
+            if (_mm_movemask_epi8(below) != 0xffff) {
+                break;
+            }
+            s += 8;
+        }
+#elif U_SIMD_NEON
+        const uint16x8_t threshold = vdupq_n_u16(min);
+        while ((limit - s) >= 8) {
+            uint16x8_t v = vld1q_u16(reinterpret_cast<const uint16_t *>(s));
+            if (vmaxvq_u16(vcgeq_u16(v, threshold)) != 0) {
+                break;
+            }
+            s += 8;
+        }
+#endif
+        while (s != limit && *s < min) {
+            ++s;
+        }
+        return s;
+    }
+
+    /**
+     * Returns the first position in [s, limit[ whose byte is >=min,
+     * or limit if all bytes are below min.
+     */
+    static inline const uint8_t *spanBelow(const uint8_t *s, const uint8_t *limit, uint8_t min) {
+        if (min == 0) {
+            return s;
+        }
+#if U_SIMD_SSE2
+        // b<min exactly when max(b, min-1)==min-1.
+        const __m128i threshold = _mm_set1_epi8(static_cast<char>(min - 1));
+        while ((limit - s) >= 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+            __m128i below = _mm_cmpeq_epi8(_mm_max_epu8(v, threshold), threshold);
+            if (_mm_movemask_epi8(below) != 0xffff) {
+                break;
+            }
+            s += 16;
+        }
+#elif U_SIMD_NEON
+        const uint8x16_t threshold = vdupq_n_u8(min);
+        while ((limit - s) >= 16) {
+            uint8x16_t v = vld1q_u8(s);
+            if (vmaxvq_u8(vcgeq_u8(v, threshold)) != 0) {
+                break;
+            }
+            s += 16;
+        }
+#endif
+        while (s != limit && *s < min) {
+            ++s;
+        }
+        return s;
+    }
+
+    /**
+     * Copies the leading ASCII bytes (<0x80) of s to dest, widening them to UTF-16,
+     * and stops before the first non-ASCII byte or after length bytes.
+     * dest must have room for length code units.
+     * @return the number of bytes copied
+     */
+    static inline int32_t widenASCII(const uint8_t *s, int32_t length, char16_t *dest) {
+        int32_t i = 0;
+#if U_SIMD_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        while ((length - i) >= 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            if (_mm_movemask_epi8(v) != 0) {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(v, zero));
+            i += 16;
+        }
+#elif U_SIMD_NEON
+        while ((length - i) >= 16) {
+            uint8x16_t v = vld1q_u8(s + i);
+            if (vmaxvq_u8(v) >= 0x80) {
+                break;
+            }
+            uint16_t *d = reinterpret_cast<uint16_t *>(dest + i);
+            vst1q_u16(d, vmovl_u8(vget_low_u8(v)));
+            vst1q_u16(d + 8, vmovl_u8(vget_high_u8(v)));
+            i += 16;
+        }
+#endif
+        uint8_t b;
+        while (i != length && (b = s[i]) < 0x80) {
+            dest[i++] = b;
+        }
+        return i;
+    }
+
+    /**
+     * Copies the length bytes of s to dest, widening them to UTF-16 (Latin-1 to Unicode).
+     * dest must have room for length code units.
+     */
+    static inline void widenLatin1(const uint8_t *s, int32_t length, char16_t *dest) {
+        int32_t i = 0;
+#if U_SIMD_SSE2
+        const __m128i zero = _mm_setzero_si128();
+        while ((length - i) >= 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_unpacklo_epi8(v, zero));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 8), _mm_unpackhi_epi8(v, zero));
+            i += 16;
+        }
+#elif U_SIMD_NEON
+        while ((length - i) >= 16) {
+            uint8x16_t v = vld1q_u8(s + i);
+            uint16_t *d = reinterpret_cast<uint16_t *>(dest + i);
+            vst1q_u16(d, vmovl_u8(vget_low_u8(v)));
+            vst1q_u16(d + 8, vmovl_u8(vget_high_u8(v)));
+            i += 16;
+        }
+#endif
+        while (i != length) {
+            dest[i] = s[i];
+            ++i;
+        }
+    }
+
+    /**
+     * Copies the leading ASCII code units (<0x80) of s to dest, narrowing them to bytes,
+     * and stops before the first non-ASCII code unit or after length code units.
+     * dest must have room for length bytes.
+     * @return the number of code units copied
+     */
+    static inline int32_t narrowASCII(const char16_t *s, int32_t length, uint8_t *dest) {
+        return narrow(s, length, dest, 0x7f);
+    }
+
+    /**
+     * Copies the leading Latin-1 code units (<0x100) of s to dest, narrowing them to bytes,
+     * and stops before the first code unit >0xff or after length code units.
+     * dest must have room for length bytes.
+     * @return the number of code units copied
+     */
+    static inline int32_t narrowLatin1(const char16_t *s, int32_t length, uint8_t *dest) {
+        return narrow(s, length, dest, 0xff);
+    }
+
+    /**
+     * Writes start, start+1, ..., start+length-1 to dest.
+     * Used for the conversion offsets of 1:1 character set conversions.
+     */
+    static inline void writeIndexes(int32_t *dest, int32_t length, int32_t start) {
+        int32_t i = 0;
+#if U_SIMD_SSE2
+        __m128i v = _mm_add_epi32(_mm_set1_epi32(start), _mm_setr_epi32(0, 1, 2, 3));
+        const __m128i four = _mm_set1_epi32(4);
+        while ((length - i) >= 8) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), v);
+            v = _mm_add_epi32(v, four);
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i + 4), v);
+            v = _mm_add_epi32(v, four);
+            i += 8;
+        }
+#elif U_SIMD_NEON
+        static const int32_t steps[4] = { 0, 1, 2, 3 };
+        int32x4_t v = vaddq_s32(vdupq_n_s32(start), vld1q_s32(steps));
+        const int32x4_t four = vdupq_n_s32(4);
+        while ((length - i) >= 8) {
+            vst1q_s32(dest + i, v);
+            v = vaddq_s32(v, four);
+            vst1q_s32(dest + i + 4, v);
+            v = vaddq_s32(v, four);
+            i += 8;
+        }
+#endif
+        while (i != length) {
+            dest[i] = start + i;
+            ++i;
+        }
+    }
+
+    /**
+     * Returns the length of the common prefix of s and t,
+     * which must both have at least length code units.
+     */
+    static inline int32_t commonPrefixLength(const char16_t *s, const char16_t *t, int32_t length) {
+        int32_t i = 0;
+#if U_SIMD_SSE2
+        while ((length - i) >= 8) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(t + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(a, b)) != 0xffff) {
+                break;
+            }
+            i += 8;
+        }
+#elif U_SIMD_NEON
+        while ((length - i) >= 8) {
+            uint16x8_t a = vld1q_u16(reinterpret_cast<const uint16_t *>(s + i));
+            uint16x8_t b = vld1q_u16(reinterpret_cast<const uint16_t *>(t + i));
+            if (vminvq_u16(vceqq_u16(a, b)) == 0) {
+                break;
+            }
+            i += 8;
+        }
+#endif
+        while (i != length && s[i] == t[i]) {
+            ++i;
+        }
+        return i;
+    }
+
+    /**
+     * Returns the length of the common prefix of s and t,
+     * which must both have at least length bytes.
+     */
+    static inline int32_t commonPrefixLength(const uint8_t *s, const uint8_t *t, int32_t length) {
+        int32_t i = 0;
+#if U_SIMD_SSE2
+        while ((length - i) >= 16) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(t + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)) != 0xffff) {
+                break;
+            }
+            i += 16;
+        }
+#elif U_SIMD_NEON
+        while ((length - i) >= 16) {
+            uint8x16_t a = vld1q_u8(s + i);
+            uint8x16_t b = vld1q_u8(t + i);
+            if (vminvq_u8(vceqq_u8(a, b)) == 0) {
+                break;
+            }
+            i += 16;
+        }
+#endif
+        while (i != length && s[i] == t[i]) {
+            ++i;
+        }
+        return i;
+    }
+
+private:
+    /**
+     * Copies the leading code units <=max of s to dest, narrowing them to bytes.
+     * max must be 0x7f or 0xff.
+     */
+    static inline int32_t narrow(const char16_t *s, int32_t length, uint8_t *dest, char16_t max) {
+        int32_t i = 0;
+#if U_SIMD_SSE2
+        // All code units are <=max exactly when none has a bit set outside of max.
+        const __m128i outside = _mm_set1_epi16(static_cast<short>(~max));
+        const __m128i zero = _mm_setzero_si128();
+        while ((length - i) >= 16) {
+            __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+            __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i + 8));
+            __m128i high = _mm_and_si128(_mm_or_si128(a, b), outside);
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(high, zero)) != 0xffff) {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dest + i), _mm_packus_epi16(a, b));
+            i += 16;
+        }
+#elif U_SIMD_NEON
+        while ((length - i) >= 16) {
+            const uint16_t *p = reinterpret_cast<const uint16_t *>(s + i);
+            uint16x8_t a = vld1q_u16(p);
+            uint16x8_t b = vld1q_u16(p + 8);
+            if (vmaxvq_u16(vorrq_u16(a, b)) > max) {
+                break;
+            }
+            vst1q_u8(dest + i, vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+            i += 16;
+        }
+#endif
+        char16_t c;
+        while (i != length && (c = s[i]) <= max) {
+            dest[i++] = static_cast<uint8_t>(c);
+        }
+        return i;
+    }
+};
+
+U_NAMESPACE_END
+
+#endif  // USIMD_H
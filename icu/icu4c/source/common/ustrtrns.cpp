@@ -34,6 +34,7 @@
 #include "cstring.h"
 #include "cmemory.h"
 #include "ustr_imp.h"
+#include "usimd.h"
 #include "uassert.h"
 
 U_CAPI UChar* U_EXPORT2 
@@ -403,6 +404,12 @@ u_strFromUTF8WithSub(UChar *dest,
                 c = (uint8_t)src[i++];
                 if(U8_IS_SINGLE(c)) {
                     *pDest++=(UChar)c;
+                    // Copy the rest of an ASCII run in bulk,
+                    // at most as many bytes and UChars as the remaining count allows.
+                    int32_t n = icu::SIMDUtil::widenASCII((const uint8_t *)src + i, count - 1, pDest);
+                    i += n;
+                    pDest += n;
+                    count -= n;
                 } else {
                     uint8_t __t1, __t2;
                     if( /* handle U+0800..U+FFFF inline */
@@ -491,7 +498,11 @@ u_strFromUTF8WithSub(UChar *dest,
             // modified copy of U8_NEXT()
             c = (uint8_t)src[i++];
             if(U8_IS_SINGLE(c)) {
-                ++reqLength;
+                // Count the rest of an ASCII run in bulk.
+                const uint8_t *s = (const uint8_t *)src;
+                int32_t runLimit = (int32_t)(icu::SIMDUtil::spanBelow(s + i, s + srcLength, 0x80) - s);
+                reqLength += 1 + (runLimit - i);
+                i = runLimit;
             } else {
                 uint8_t __t1, __t2;
                 if( /* handle U+0800..U+FFFF inline */
@@ -921,6 +932,14 @@ u_strToUTF8WithSub(char *dest,
                 ch=*pSrc++;
                 if(ch <= 0x7f) {
                     *pDest++ = (uint8_t)ch;
+                    /*
+                     * Copy the rest of an ASCII run in bulk,
+                     * at most as many UChars and bytes as the remaining count allows.
+                     */
+                    int32_t n = icu::SIMDUtil::narrowASCII(pSrc, count - 1, pDest);
+                    pSrc += n;
+                    pDest += n;
+                    count -= n;
                 } else if(ch <= 0x7ff) {
                     *pDest++=(uint8_t)((ch>>6)|0xc0);
                     *pDest++=(uint8_t)((ch&0x3f)|0x80);
@@ -1019,7 +1038,10 @@ u_strToUTF8WithSub(char *dest,
         while(pSrc<pSrcLimit) {
             ch=*pSrc++;
             if(ch<=0x7f) {
-                ++reqLength;
+                /* Count the rest of an ASCII run in bulk. */
+                const UChar *runLimit = icu::SIMDUtil::spanBelow(pSrc, pSrcLimit, 0x80);
+                reqLength += 1 + (int32_t)(runLimit - pSrc);
+                pSrc = runLimit;
             } else if(ch<=0x7ff) {
                 reqLength+=2;
             } else if(!U16_IS_SURROGATE(ch)) {
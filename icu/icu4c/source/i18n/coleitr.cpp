@@ -33,7 +33,9 @@
 #include "unicode/coleitr.h"
 #include "unicode/tblcoll.h"
 #include "unicode/ustring.h"
+#include "unicode/utf8.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "collation.h"
 #include "collationdata.h"
 #include "collationiterator.h"
@@ -42,6 +44,7 @@
 #include "uassert.h"
 #include "uhash.h"
 #include "utf16collationiterator.h"
+#include "utf8collationiterator.h"
 #include "uvectr32.h"
 
 /* Constants --------------------------------------------------------------- */
@@ -54,7 +57,8 @@ UOBJECT_DEFINE_RTTI_IMPLEMENTATION(CollationElementIterator)
 
 CollationElementIterator::CollationElementIterator(
                                          const CollationElementIterator& other) 
-        : UObject(other), iter_(NULL), rbc_(NULL), otherHalf_(0), dir_(0), offsets_(NULL) {
+        : UObject(other), iter_(NULL), rbc_(NULL), otherHalf_(0), dir_(0), offsets_(NULL),
+          text8_(NULL), text8Length_(0) {
     *this = other;
 }
 
@@ -155,6 +159,8 @@ bool CollationElementIterator::operator==(
         otherHalf_ == that.otherHalf_ &&
         normalizeDir() == that.normalizeDir() &&
         string_ == that.string_ &&
+        text8Length_ == that.text8Length_ &&
+        (text8_ == that.text8_ || uprv_memcmp(text8_, that.text8_, text8Length_) == 0) &&
         *iter_ == *that.iter_;
 }
 
@@ -175,7 +181,7 @@ int32_t CollationElementIterator::previous(UErrorCode& status)
             return oh;
         }
     } else if (dir_ == 0) {
-        iter_->resetToOffset(string_.length());
+        iter_->resetToOffset(getTextLength());
         dir_ = -1;
     } else if (dir_ == 1) {
         // previous() after setOffset()
@@ -231,6 +237,10 @@ void CollationElementIterator::setOffset(int32_t newOffset,
                                          UErrorCode& status)
 {
     if (U_FAILURE(status)) { return; }
+    if (text8_ != NULL) {
+        setUTF8Offset(newOffset, status);
+        return;
+    }
     if (0 < newOffset && newOffset < string_.length()) {
         int32_t offset = newOffset;
         do {
@@ -248,18 +258,35 @@ void CollationElementIterator::setOffset(int32_t newOffset,
             // but for text "chu" setOffset(2) should remain at 2
             // although we initially back up to offset 0.
             // Find the last safe offset no greater than newOffset by iterating forward.
-            int32_t lastSafeOffset = offset;
-            do {
-                iter_->resetToOffset(lastSafeOffset);
-                do {
-                    iter_->nextCE(status);
-                    if (U_FAILURE(status)) { return; }
-                } while ((offset = iter_->getOffset()) == lastSafeOffset);
-                if (offset <= newOffset) {
-                    lastSafeOffset = offset;
-                }
-            } while (offset < newOffset);
-            newOffset = lastSafeOffset;
+            newOffset = getLastSafeOffset(offset, newOffset, status);
+            if (U_FAILURE(status)) { return; }
+        }
+    }
+    iter_->resetToOffset(newOffset);
+    otherHalf_ = 0;
+    dir_ = 1;
+}
+
+void CollationElementIterator::setUTF8Offset(int32_t newOffset, UErrorCode &status)
+{
+    if (0 < newOffset && newOffset < text8Length_) {
+        // Same as for UTF-16 text, but moving over whole code points,
+        // starting from the one that contains newOffset.
+        int32_t offset = newOffset;
+        U8_SET_CP_START(text8_, 0, offset);
+        while (offset > 0) {
+            int32_t i = offset;
+            UChar32 c;
+            U8_NEXT_OR_FFFD(text8_, i, text8Length_, c);
+            if (!rbc_->isUnsafe(c)) {
+                break;
+            }
+            // Back up to before this unsafe character.
+            U8_BACK_1(text8_, 0, offset);
+        }
+        if (offset < newOffset) {
+            newOffset = getLastSafeOffset(offset, newOffset, status);
+            if (U_FAILURE(status)) { return; }
         }
     }
     iter_->resetToOffset(newOffset);
@@ -267,6 +294,24 @@ void CollationElementIterator::setOffset(int32_t newOffset,
     dir_ = 1;
 }
 
+int32_t CollationElementIterator::getLastSafeOffset(int32_t safeOffset, int32_t newOffset,
+                                                    UErrorCode &status)
+{
+    int32_t lastSafeOffset = safeOffset;
+    int32_t offset;
+    do {
+        iter_->resetToOffset(lastSafeOffset);
+        do {
+            iter_->nextCE(status);
+            if (U_FAILURE(status)) { return newOffset; }
+        } while ((offset = iter_->getOffset()) == lastSafeOffset);
+        if (offset <= newOffset) {
+            lastSafeOffset = offset;
+        }
+    } while (offset < newOffset);
+    return lastSafeOffset;
+}
+
 /**
 * Sets the source to the new source string.
 */
@@ -294,6 +339,43 @@ void CollationElementIterator::setText(const UnicodeString& source,
     iter_ = newIter;
     otherHalf_ = 0;
     dir_ = 0;
+    text8_ = NULL;
+    text8Length_ = 0;
+}
+
+void CollationElementIterator::setUTF8Text(const char *source, int32_t length,
+                                           UErrorCode &status)
+{
+    if (U_FAILURE(status)) {
+        return;
+    }
+    if (source == NULL ? length != 0 : length < -1) {
+        status = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    const uint8_t *s = source != NULL ? reinterpret_cast<const uint8_t *>(source) :
+                                        reinterpret_cast<const uint8_t *>("");
+    if (length < 0) {
+        length = static_cast<int32_t>(uprv_strlen(source));
+    }
+    CollationIterator *newIter;
+    UBool numeric = rbc_->settings->isNumeric();
+    if (rbc_->settings->dontCheckFCD()) {
+        newIter = new UTF8CollationIterator(rbc_->data, numeric, s, 0, length);
+    } else {
+        newIter = new FCDUTF8CollationIterator(rbc_->data, numeric, s, 0, length);
+    }
+    if (newIter == NULL) {
+        status = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    delete iter_;
+    iter_ = newIter;
+    otherHalf_ = 0;
+    dir_ = 0;
+    string_.remove();
+    text8_ = s;
+    text8Length_ = length;
 }
 
 // Sets the source to the new character iterator.
@@ -331,7 +413,8 @@ CollationElementIterator::CollationElementIterator(
                                                const UnicodeString &source,
                                                const RuleBasedCollator *coll,
                                                UErrorCode &status)
-        : iter_(NULL), rbc_(coll), otherHalf_(0), dir_(0), offsets_(NULL) {
+        : iter_(NULL), rbc_(coll), otherHalf_(0), dir_(0), offsets_(NULL),
+          text8_(NULL), text8Length_(0) {
     setText(source, status);
 }
 
@@ -343,7 +426,8 @@ CollationElementIterator::CollationElementIterator(
                                            const CharacterIterator &source,
                                            const RuleBasedCollator *coll,
                                            UErrorCode &status)
-        : iter_(NULL), rbc_(coll), otherHalf_(0), dir_(0), offsets_(NULL) {
+        : iter_(NULL), rbc_(coll), otherHalf_(0), dir_(0), offsets_(NULL),
+          text8_(NULL), text8Length_(0) {
     // We only call source.getText() which should be const anyway.
     setText(const_cast<CharacterIterator &>(source), status);
 }
@@ -368,7 +452,20 @@ const CollationElementIterator& CollationElementIterator::operator=(
         if(otherIter != NULL) {
             newIter = new UTF16CollationIterator(*otherIter, string_.getBuffer());
         } else {
-            newIter = NULL;
+            // UTF-8 text is not copied, so the new iterator shares it.
+            const FCDUTF8CollationIterator *otherFCDIter8 =
+                    dynamic_cast<const FCDUTF8CollationIterator *>(other.iter_);
+            if(otherFCDIter8 != NULL) {
+                newIter = new FCDUTF8CollationIterator(*otherFCDIter8);
+            } else {
+                const UTF8CollationIterator *otherIter8 =
+                        dynamic_cast<const UTF8CollationIterator *>(other.iter_);
+                if(otherIter8 != NULL) {
+                    newIter = new UTF8CollationIterator(*otherIter8);
+                } else {
+                    newIter = NULL;
+                }
+            }
         }
     }
     if(newIter != NULL) {
@@ -379,6 +476,8 @@ const CollationElementIterator& CollationElementIterator::operator=(
         dir_ = other.dir_;
 
         string_ = other.string_;
+        text8_ = other.text8_;
+        text8Length_ = other.text8Length_;
     }
     if(other.dir_ < 0 && other.offsets_ != NULL && !other.offsets_->isEmpty()) {
         UErrorCode errorCode = U_ZERO_ERROR;
@@ -0,0 +1,269 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// collationbinarycache.cpp
+// created: 2026oct17
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include <stdio.h>
+
+#include "unicode/tblcoll.h"
+#include "unicode/ucol.h"
+#include "unicode/udata.h"
+#include "unicode/unistr.h"
+#include "unicode/uversion.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "collationdatareader.h"
+#include "collationroot.h"
+#include "collationtailoring.h"
+#include "putilimp.h"
+#include "udatamem.h"
+#include "umapfile.h"
+#include "ustr_imp.h"
+
+U_NAMESPACE_BEGIN
+
+#if !UCONFIG_NO_FILE_IO
+
+namespace {
+
+/*
+ * Cache file format, in the platform's endianness:
+ *
+ * int32_t indexes[IX_COUNT];
+ * char16_t rules[indexes[IX_RULES_LENGTH]];
+ * zero padding up to indexes[IX_TAILORING_OFFSET] which is a multiple of 16;
+ * uint8_t tailoring[indexes[IX_TAILORING_LENGTH]];  // as from RuleBasedCollator::cloneBinary()
+ *
+ * The file is memory-mapped, and the tailoring data and the rule string
+ * are used in place. The CollationTailoring owns the mapping.
+ */
+enum {
+    IX_MAGIC,
+    IX_ICU_VERSION,  // UVersionInfo bytes
+    IX_RULES_LENGTH,
+    IX_TAILORING_OFFSET,
+    IX_TAILORING_LENGTH,
+    IX_RESERVED_5,
+    IX_RESERVED_6,
+    IX_RESERVED_7,
+    IX_COUNT
+};
+
+constexpr int32_t CACHE_MAGIC = 0x55436f43;  // "UCoC"
+
+inline int32_t getTailoringOffset(int32_t rulesLength) {
+    return (IX_COUNT * 4 + rulesLength * 2 + 15) & ~15;
+}
+
+int32_t getICUVersion() {
+    UVersionInfo version;
+    u_getVersion(version);
+    int32_t result;
+    uprv_memcpy(&result, version, 4);
+    return result;
+}
+
+void getCachePath(const char *cacheDir, const UnicodeString &rules,
+                  CharString &path, UErrorCode &errorCode) {
+    static const char hexDigits[] = "0123456789abcdef";
+    uint32_t hash = ustr_hashUCharsN(rules.getBuffer(), rules.length());
+    path.append(cacheDir, errorCode).ensureEndsWithFileSeparator(errorCode);
+    path.append("ucol" U_ICU_VERSION_SHORT "_", errorCode);
+    for(int32_t shift = 28; shift >= 0; shift -= 4) {
+        path.append(hexDigits[(hash >> shift) & 0xf], errorCode);
+    }
+    path.append(".col", errorCode);
+}
+
+/**
+ * Returns the tailoring from the cache file,
+ * or NULL if there is no file or it is not usable for these rules.
+ * Sets a failure code only for memory allocation errors.
+ */
+CollationTailoring *loadTailoring(const char *path, const UnicodeString &rules,
+                                  UErrorCode &errorCode) {
+    const CollationTailoring *root = CollationRoot::getRoot(errorCode);
+    if(U_FAILURE(errorCode)) { return NULL; }
+    LocalUDataMemoryPointer memory(UDataMemory_createNewInstance(&errorCode));
+    if(U_FAILURE(errorCode)) { return NULL; }
+    UDataMemory mapped;
+    UErrorCode mapErrorCode = U_ZERO_ERROR;
+    if(!uprv_mapFile(&mapped, path, &mapErrorCode)) { return NULL; }
+    // Same as in CollationRoot::loadFromFile(): Hand the mapping to the heap instance.
+    memory->pHeader = mapped.pHeader;
+    memory->mapAddr = mapped.mapAddr;
+    memory->map = mapped.map;
+    memory->length = mapped.length;
+
+    // The file is published by renaming a complete temporary file,
+    // but it may still be truncated or damaged (full disk, crash, non-atomic rename),
+    // so every read is checked against the file length.
+    int32_t mapLength = uprv_getMappedFileLength(memory.getAlias());
+    int32_t rulesLength = rules.length();
+    if(mapLength < IX_COUNT * 4 || rulesLength > (mapLength - IX_COUNT * 4) / 2) {
+        return NULL;
+    }
+    // Not mapAddr, which Windows does not set.
+    const int32_t *indexes = reinterpret_cast<const int32_t *>(memory->pHeader);
+    int32_t tailoringOffset = getTailoringOffset(rulesLength);
+    if(!(indexes[IX_MAGIC] == CACHE_MAGIC &&
+            indexes[IX_ICU_VERSION] == getICUVersion() &&
+            indexes[IX_RULES_LENGTH] == rulesLength &&
+            indexes[IX_TAILORING_OFFSET] == tailoringOffset &&
+            tailoringOffset <= mapLength &&
+            0 <= indexes[IX_TAILORING_LENGTH] &&
+            indexes[IX_TAILORING_LENGTH] <= mapLength - tailoringOffset)) {
+        return NULL;
+    }
+    // Different rules may have the same hash.
+    const char16_t *cachedRules = reinterpret_cast<const char16_t *>(indexes + IX_COUNT);
+    if(rulesLength > 0 && uprv_memcmp(cachedRules, rules.getBuffer(), rulesLength * 2) != 0) {
+        return NULL;
+    }
+    LocalPointer<CollationTailoring> t(new CollationTailoring(root->settings));
+    if(t.isNull() || t->isBogus()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    const uint8_t *inBytes = reinterpret_cast<const uint8_t *>(indexes) + tailoringOffset;
+    UErrorCode readErrorCode = U_ZERO_ERROR;
+    CollationDataReader::read(root, inBytes, indexes[IX_TAILORING_LENGTH], *t, readErrorCode);
+    if(readErrorCode == U_MEMORY_ALLOCATION_ERROR) {
+        errorCode = readErrorCode;
+        return NULL;
+    } else if(U_FAILURE(readErrorCode)) {
+        // For example, the root collation data changed.
+        return NULL;
+    }
+    t->rules.setTo(false, cachedRules, rulesLength);
+    t->actualLocale.setToBogus();
+    t->memory = memory.orphan();
+    return t.orphan();
+}
+
+/**
+ * Writes the cache file for the collator's tailoring.
+ * The cache is best-effort: Errors are ignored, and the next call just builds again.
+ */
+void writeTailoring(const char *path, const RuleBasedCollator &coll, const UnicodeString &rules) {
+    UErrorCode errorCode = U_ZERO_ERROR;
+    int32_t length = coll.cloneBinary(NULL, 0, errorCode);
+    if(errorCode != U_BUFFER_OVERFLOW_ERROR) { return; }
+    LocalMemory<uint8_t> binary;
+    if(binary.allocateInsteadAndReset(length) == NULL) { return; }
+    errorCode = U_ZERO_ERROR;
+    length = coll.cloneBinary(binary.getAlias(), length, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+
+    int32_t rulesLength = rules.length();
+    int32_t tailoringOffset = getTailoringOffset(rulesLength);
+    int32_t indexes[IX_COUNT] = {
+        CACHE_MAGIC, getICUVersion(), rulesLength, tailoringOffset, length, 0, 0, 0
+    };
+    static const char padding[16] = { 0 };
+    size_t paddingLength = tailoringOffset - (IX_COUNT * 4 + rulesLength * 2);
+
+    // Concurrent writers, also in other processes, each write their own temporary file
+    // and then atomically rename it to the cache file.
+    CharString tempPath;
+    tempPath.append(path, errorCode).append('.', errorCode);
+    tempPath.appendNumber(static_cast<int32_t>(reinterpret_cast<uintptr_t>(&tempPath)), errorCode);
+    tempPath.append('.', errorCode);
+    tempPath.appendNumber(static_cast<int32_t>(
+        static_cast<int64_t>(uprv_getRawUTCtime()) & 0x7fffffff), errorCode);
+    tempPath.append(".tmp", errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    FILE *f = fopen(tempPath.data(), "wbx");
+    if(f == NULL) { return; }
+    bool ok =
+        fwrite(indexes, 4, IX_COUNT, f) == IX_COUNT &&
+        fwrite(rules.getBuffer(), 2, rulesLength, f) == static_cast<size_t>(rulesLength) &&
+        fwrite(padding, 1, paddingLength, f) == paddingLength &&
+        fwrite(binary.getAlias(), 1, length, f) == static_cast<size_t>(length);
+    ok = fclose(f) == 0 && ok;
+    if(!ok || rename(tempPath.data(), path) != 0) {
+        remove(tempPath.data());
+    }
+}
+
+}  // namespace
+
+#endif  // !UCONFIG_NO_FILE_IO
+
+void
+RuleBasedCollator::internalBuildTailoringWithCache(const UnicodeString &rules,
+                                                   int32_t strength,
+                                                   UColAttributeValue decompositionMode,
+                                                   const char *cacheDir,
+                                                   UParseError *outParseError,
+                                                   UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+#if !UCONFIG_NO_FILE_IO
+    if(cacheDir != NULL && *cacheDir != 0) {
+        CharString path;
+        getCachePath(cacheDir, rules, path, errorCode);
+        CollationTailoring *t = loadTailoring(path.data(), rules, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        if(t == NULL) {
+            internalBuildTailoring(rules, UCOL_DEFAULT, UCOL_DEFAULT, outParseError, NULL, errorCode);
+            if(U_FAILURE(errorCode)) { return; }
+            writeTailoring(path.data(), *this, rules);
+        } else {
+            if(outParseError != NULL) {
+                outParseError->line = 0;
+                outParseError->offset = -1;
+                outParseError->preContext[0] = 0;
+                outParseError->postContext[0] = 0;
+            }
+            adoptTailoring(t, errorCode);
+            if(U_FAILURE(errorCode)) { return; }
+        }
+        // Same as in internalBuildTailoring(): The cache file has the tailoring's
+        // default settings, and the caller's attributes are set on top.
+        if(strength != UCOL_DEFAULT) {
+            setAttribute(UCOL_STRENGTH, (UColAttributeValue)strength, errorCode);
+        }
+        if(decompositionMode != UCOL_DEFAULT) {
+            setAttribute(UCOL_NORMALIZATION_MODE, decompositionMode, errorCode);
+        }
+        return;
+    }
+#endif
+    internalBuildTailoring(rules, strength, decompositionMode, outParseError, NULL, errorCode);
+}
+
+U_NAMESPACE_END
+
+U_NAMESPACE_USE
+
+U_CAPI UCollator * U_EXPORT2
+ucol_openRulesWithCache(const UChar *rules, int32_t rulesLength,
+                        UColAttributeValue normalizationMode, UCollationStrength strength,
+                        const char *cacheDir,
+                        UParseError *parseError, UErrorCode *pErrorCode) {
+    if(U_FAILURE(*pErrorCode)) { return NULL; }
+    if(rules == NULL && rulesLength != 0) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return NULL;
+    }
+    RuleBasedCollator *coll = new RuleBasedCollator();
+    if(coll == NULL) {
+        *pErrorCode = U_MEMORY_ALLOCATION_ERROR;
+        return NULL;
+    }
+    UnicodeString r((UBool)(rulesLength < 0), rules, rulesLength);
+    coll->internalBuildTailoringWithCache(r, strength, normalizationMode, cacheDir,
+                                          parseError, *pErrorCode);
+    if(U_FAILURE(*pErrorCode)) {
+        delete coll;
+        return NULL;
+    }
+    return coll->toUCollator();
+}
+
+#endif  // !UCONFIG_NO_COLLATION
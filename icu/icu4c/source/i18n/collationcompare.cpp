@@ -16,9 +16,13 @@
 #if !UCONFIG_NO_COLLATION
 
 #include "unicode/ucol.h"
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
 #include "cmemory.h"
 #include "collation.h"
 #include "collationcompare.h"
+#include "collationdata.h"
+#include "collationfcd.h"
 #include "collationiterator.h"
 #include "collationsettings.h"
 #include "uassert.h"
@@ -351,6 +355,265 @@ CollationCompare::compareUpToQuaternary(CollationIterator &left, CollationIterat
     return UCOL_EQUAL;
 }
 
+namespace {
+
+/**
+ * Returns the CEs for characters that can be handled by CollationCompare::compareSimpleUTF16().
+ * For any other character, sets bailedOut and returns NO_CE.
+ *
+ * A character is accepted only if neither it nor the following character has lccc!=0.
+ * Such a character is its own FCD segment, and its CEs do not depend on later characters,
+ * so a difference found before bailing out is the same as with a CollationIterator.
+ *
+ * Like the CollationIterator, this buffers the CEs for comparing the secondary
+ * and tertiary levels, but with a fixed capacity.
+ */
+class SimpleCEs {
+public:
+    /** Large enough for the CEs of typical short strings like names. */
+    static const int32_t CAPACITY = 64;
+
+    int64_t getCE(int32_t i) const { return buffer[i]; }
+
+    UBool bailedOut;
+    /** true if the CEs did not all fit into the buffer */
+    UBool overflow;
+
+protected:
+    SimpleCEs(const CollationData *d)
+            : bailedOut(false), overflow(false), data(d), ces(NULL), ce32s(NULL),
+              remaining(0), latinCE1(0), length(0) {}
+
+    int64_t append(int64_t ce) {
+        if(length < CAPACITY) {
+            buffer[length++] = ce;
+        } else {
+            overflow = true;
+        }
+        return ce;
+    }
+
+    int64_t nextExpansionCE() {
+        --remaining;
+        if(ce32s != NULL) {
+            return Collation::ceFromCE32(*ce32s++);
+        } else {
+            return *ces++;
+        }
+    }
+
+    int64_t firstCE(UChar32 c) {
+        const CollationData *d = data;
+        uint32_t ce32 = d->getCE32(c);
+        if(ce32 == Collation::FALLBACK_CE32) {
+            d = data->base;
+            ce32 = d->getCE32(c);
+        }
+        for(;;) {
+            if(!Collation::isSpecialCE32(ce32)) {
+                return Collation::ceFromSimpleCE32(ce32);
+            }
+            switch(Collation::tagFromCE32(ce32)) {
+            case Collation::LONG_PRIMARY_TAG:
+                return Collation::ceFromLongPrimaryCE32(ce32);
+            case Collation::LONG_SECONDARY_TAG:
+                return Collation::ceFromLongSecondaryCE32(ce32);
+            case Collation::LATIN_EXPANSION_TAG:
+                latinCE1 = Collation::latinCE1FromCE32(ce32);
+                ces = &latinCE1;
+                ce32s = NULL;
+                remaining = 1;
+                return Collation::latinCE0FromCE32(ce32);
+            case Collation::EXPANSION32_TAG:
+                ce32s = d->ce32s + Collation::indexFromCE32(ce32);
+                remaining = Collation::lengthFromCE32(ce32) - 1;
+                return Collation::ceFromCE32(*ce32s++);
+            case Collation::EXPANSION_TAG:
+                ces = d->ces + Collation::indexFromCE32(ce32);
+                ce32s = NULL;
+                remaining = Collation::lengthFromCE32(ce32) - 1;
+                return *ces++;
+            case Collation::CONTRACTION_TAG:
+                // Contractions like the root ones for U+0438+U+0306 cannot match
+                // if all of their suffixes start with lccc!=0,
+                // because the next character has lccc==0.
+                if((ce32 & Collation::CONTRACT_NEXT_CCC) == 0) {
+                    return bailOut();
+                }
+                ce32 = CollationData::readCE32(d->contexts + Collation::indexFromCE32(ce32));
+                break;
+            default:
+                return bailOut();
+            }
+        }
+    }
+
+    int64_t bailOut() {
+        bailedOut = true;
+        return Collation::NO_CE;
+    }
+
+    const CollationData *data;
+    const int64_t *ces;
+    const uint32_t *ce32s;
+    int32_t remaining;
+    int64_t latinCE1;
+    int32_t length;
+    int64_t buffer[CAPACITY];
+};
+
+class UTF16SimpleCEs : public SimpleCEs {
+public:
+    UTF16SimpleCEs(const CollationData *d, const UChar *s, int32_t len)
+            : SimpleCEs(d), pos(s), limit(len >= 0 ? s + len : NULL) {}
+
+    int64_t nextCE() {
+        if(remaining > 0) {
+            return append(nextExpansionCE());
+        }
+        if(pos == limit) {
+            return append(Collation::NO_CE);
+        }
+        UChar32 c = *pos++;
+        if(c == 0 && limit == NULL) {
+            limit = --pos;
+            return append(Collation::NO_CE);
+        }
+        if(U16_IS_SURROGATE(c) || CollationFCD::hasLccc(c) ||
+                (pos != limit && CollationFCD::hasLccc(*pos))) {
+            return bailOut();
+        }
+        return append(firstCE(c));
+    }
+
+private:
+    const UChar *pos;
+    const UChar *limit;
+};
+
+template<typename CEs>
+int32_t
+compareSimple(CEs &left, CEs &right, const CollationSettings &settings) {
+    int32_t options = settings.options;
+    if(CollationSettings::getStrength(options) > UCOL_TERTIARY ||
+            (options & (CollationSettings::BACKWARD_SECONDARY | CollationSettings::CASE_LEVEL)) != 0) {
+        return CollationCompare::BAIL_OUT_RESULT;
+    }
+    uint32_t variableTop;
+    if((options & CollationSettings::ALTERNATE_MASK) == 0) {
+        variableTop = 0;
+    } else {
+        // +1 so that we can use "<" and primary ignorables test out early.
+        variableTop = settings.variableTop + 1;
+    }
+
+    // Same as compareUpToQuaternary(), except that we bail out for variable CEs.
+    for(;;) {
+        uint32_t leftPrimary;
+        do {
+            leftPrimary = (uint32_t)(left.nextCE() >> 32);
+        } while(leftPrimary == 0);
+        uint32_t rightPrimary;
+        do {
+            rightPrimary = (uint32_t)(right.nextCE() >> 32);
+        } while(rightPrimary == 0);
+
+        if((leftPrimary < variableTop && leftPrimary > Collation::MERGE_SEPARATOR_PRIMARY) ||
+                (rightPrimary < variableTop && rightPrimary > Collation::MERGE_SEPARATOR_PRIMARY)) {
+            return CollationCompare::BAIL_OUT_RESULT;
+        }
+        if(leftPrimary != rightPrimary) {
+            if(left.bailedOut || right.bailedOut) {
+                return CollationCompare::BAIL_OUT_RESULT;
+            }
+            // Return the primary difference, with script reordering.
+            if(settings.hasReordering()) {
+                leftPrimary = settings.reorder(leftPrimary);
+                rightPrimary = settings.reorder(rightPrimary);
+            }
+            return (leftPrimary < rightPrimary) ? UCOL_LESS : UCOL_GREATER;
+        }
+        if(leftPrimary == Collation::NO_CE_PRIMARY) { break; }
+    }
+    if(left.bailedOut || right.bailedOut) {
+        return CollationCompare::BAIL_OUT_RESULT;
+    }
+    if(CollationSettings::getStrength(options) == UCOL_PRIMARY) { return UCOL_EQUAL; }
+    if(left.overflow || right.overflow) {
+        return CollationCompare::BAIL_OUT_RESULT;
+    }
+
+    // Compare the buffered secondary & tertiary weights.
+    int32_t leftIndex = 0;
+    int32_t rightIndex = 0;
+    for(;;) {
+        uint32_t leftSecondary;
+        do {
+            leftSecondary = ((uint32_t)left.getCE(leftIndex++)) >> 16;
+        } while(leftSecondary == 0);
+        uint32_t rightSecondary;
+        do {
+            rightSecondary = ((uint32_t)right.getCE(rightIndex++)) >> 16;
+        } while(rightSecondary == 0);
+
+        if(leftSecondary != rightSecondary) {
+            return (leftSecondary < rightSecondary) ? UCOL_LESS : UCOL_GREATER;
+        }
+        if(leftSecondary == Collation::NO_CE_WEIGHT16) { break; }
+    }
+    if(CollationSettings::getStrength(options) == UCOL_SECONDARY) { return UCOL_EQUAL; }
+
+    uint32_t tertiaryMask = CollationSettings::getTertiaryMask(options);
+    leftIndex = 0;
+    rightIndex = 0;
+    for(;;) {
+        uint32_t leftLower32, leftTertiary;
+        do {
+            leftLower32 = (uint32_t)left.getCE(leftIndex++);
+            leftTertiary = leftLower32 & tertiaryMask;
+        } while(leftTertiary == 0);
+        uint32_t rightLower32, rightTertiary;
+        do {
+            rightLower32 = (uint32_t)right.getCE(rightIndex++);
+            rightTertiary = rightLower32 & tertiaryMask;
+        } while(rightTertiary == 0);
+
+        if(leftTertiary != rightTertiary) {
+            if(CollationSettings::sortsTertiaryUpperCaseFirst(options)) {
+                // See compareUpToQuaternary().
+                if(leftTertiary > Collation::NO_CE_WEIGHT16) {
+                    if(leftLower32 > 0xffff) {
+                        leftTertiary ^= 0xc000;
+                    } else {
+                        leftTertiary += 0x4000;
+                    }
+                }
+                if(rightTertiary > Collation::NO_CE_WEIGHT16) {
+                    if(rightLower32 > 0xffff) {
+                        rightTertiary ^= 0xc000;
+                    } else {
+                        rightTertiary += 0x4000;
+                    }
+                }
+            }
+            return (leftTertiary < rightTertiary) ? UCOL_LESS : UCOL_GREATER;
+        }
+        if(leftTertiary == Collation::NO_CE_WEIGHT16) { break; }
+    }
+    return UCOL_EQUAL;
+}
+
+}  // namespace
+
+int32_t
+CollationCompare::compareSimpleUTF16(const CollationData *data, const CollationSettings &settings,
+                                     const UChar *left, int32_t leftLength,
+                                     const UChar *right, int32_t rightLength) {
+    UTF16SimpleCEs leftCEs(data, left, leftLength);
+    UTF16SimpleCEs rightCEs(data, right, rightLength);
+    return compareSimple(leftCEs, rightCEs, settings);
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
@@ -22,6 +22,7 @@
 
 U_NAMESPACE_BEGIN
 
+class CollationData;
 class CollationIterator;
 struct CollationSettings;
 
@@ -30,6 +31,26 @@ class U_I18N_API CollationCompare /* not : public UObject because all methods ar
     static UCollationResult compareUpToQuaternary(CollationIterator &left, CollationIterator &right,
                                                   const CollationSettings &settings,
                                                   UErrorCode &errorCode);
+
+    /**
+     * Return value of compareSimpleUTF16()
+     * when the strings need the full CollationIterator.
+     */
+    static const int32_t BAIL_OUT_RESULT = -2;
+
+    /**
+     * Compares two strings up to tertiary strength without a CollationIterator,
+     * if all of their characters are BMP code points that map to
+     * simple CEs, long-primary/secondary CEs or expansions,
+     * and if none of them has lccc!=0.
+     * This covers most of the text in scripts like Greek and Cyrillic
+     * which are not handled by CollationFastLatin.
+     *
+     * @return UCOL_LESS, UCOL_EQUAL, UCOL_GREATER, or BAIL_OUT_RESULT
+     */
+    static int32_t compareSimpleUTF16(const CollationData *data, const CollationSettings &settings,
+                                      const UChar *left, int32_t leftLength,
+                                      const UChar *right, int32_t rightLength);
 };
 
 U_NAMESPACE_END
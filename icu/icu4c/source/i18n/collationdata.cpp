@@ -27,6 +27,22 @@
 
 U_NAMESPACE_BEGIN
 
+void
+CollationData::setUnsafeBackwardSet(const UnicodeSet *set) {
+    unsafeBackwardSet = set;
+    uprv_memset(unsafeBackwardBits, 0, sizeof(unsafeBackwardBits));
+    int32_t count = set->getRangeCount();
+    for(int32_t i = 0; i < count; ++i) {
+        UChar32 start = set->getRangeStart(i);
+        if(start >= UNSAFE_BACKWARD_BITS_LIMIT) { break; }
+        UChar32 end = set->getRangeEnd(i);
+        if(end >= UNSAFE_BACKWARD_BITS_LIMIT) { end = UNSAFE_BACKWARD_BITS_LIMIT - 1; }
+        for(UChar32 c = start; c <= end; ++c) {
+            unsafeBackwardBits[c >> 5] |= (uint32_t)1 << (c & 0x1f);
+        }
+    }
+}
+
 uint32_t
 CollationData::getIndirectCE32(uint32_t ce32) const {
     U_ASSERT(Collation::isSpecialCE32(ce32));
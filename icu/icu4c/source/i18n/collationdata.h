@@ -56,7 +56,7 @@ struct U_I18N_API CollationData : public UMemory {
               numericPrimary(0x12000000),
               ce32sLength(0), cesLength(0), contextsLength(0),
               compressibleBytes(NULL),
-              unsafeBackwardSet(NULL),
+              unsafeBackwardSet(NULL), unsafeBackwardBits(),
               fastLatinTable(NULL), fastLatinTableLength(0),
               numScripts(0), scriptsIndex(NULL), scriptStarts(NULL), scriptStartsLength(0),
               rootElements(NULL), rootElementsLength(0) {}
@@ -75,9 +75,20 @@ struct U_I18N_API CollationData : public UMemory {
     }
 
     UBool isUnsafeBackward(UChar32 c, UBool numeric) const {
-        return unsafeBackwardSet->contains(c) || (numeric && isDigit(c));
+        if(c < UNSAFE_BACKWARD_BITS_LIMIT) {
+            if((unsafeBackwardBits[c >> 5] & ((uint32_t)1 << (c & 0x1f))) != 0) { return true; }
+        } else if(unsafeBackwardSet->contains(c)) {
+            return true;
+        }
+        return numeric && isDigit(c);
     }
 
+    /**
+     * Sets the unsafeBackwardSet, which must be frozen,
+     * and copies its low code points into the unsafeBackwardBits.
+     */
+    void setUnsafeBackwardSet(const UnicodeSet *set);
+
     UBool isCompressibleLeadByte(uint32_t b) const {
         return compressibleBytes[b];
     }
@@ -202,6 +213,12 @@ struct U_I18N_API CollationData : public UMemory {
      * or in backwards CE iteration.
      */
     const UnicodeSet *unsafeBackwardSet;
+    /**
+     * The unsafeBackwardSet as bits for U+0000..UNSAFE_BACKWARD_BITS_LIMIT-1,
+     * for the identical-prefix backup in string comparisons.
+     */
+    static constexpr int32_t UNSAFE_BACKWARD_BITS_LIMIT = 0x800;
+    uint32_t unsafeBackwardBits[UNSAFE_BACKWARD_BITS_LIMIT / 32];
 
     /**
      * Fast Latin table for common-Latin-text string comparisons.
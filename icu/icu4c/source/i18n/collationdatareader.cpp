@@ -323,12 +323,12 @@ CollationDataReader::read(const CollationTailoring *base, const uint8_t *inBytes
             }
         }
         tailoring.unsafeBackwardSet->freeze();
-        data->unsafeBackwardSet = tailoring.unsafeBackwardSet;
+        data->setUnsafeBackwardSet(tailoring.unsafeBackwardSet);
     } else if(data == NULL) {
         // Nothing to do.
     } else if(baseData != NULL) {
         // No tailoring-specific data: Alias the root collator's set.
-        data->unsafeBackwardSet = baseData->unsafeBackwardSet;
+        data->setUnsafeBackwardSet(baseData->unsafeBackwardSet);
     } else {
         errorCode = U_INVALID_FORMAT_ERROR;  // No unsafeBackwardSet.
         return;
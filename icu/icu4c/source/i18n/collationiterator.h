@@ -205,6 +205,14 @@ class U_I18N_API CollationIterator : public UObject {
         cesIndex = ceBuffer.length = 0;
     }
 
+    /**
+     * Makes nextCE() return the buffered CEs again from the start,
+     * for example after fetchCEs().
+     */
+    void rewindCEs() {
+        cesIndex = 0;
+    }
+
     void clearCEsIfNoneRemaining() {
         if(cesIndex == ceBuffer.length) { clearCEs(); }
     }
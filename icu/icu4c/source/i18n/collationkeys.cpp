@@ -668,6 +668,80 @@ CollationKeys::writeSortKeyUpToQuaternary(CollationIterator &iter,
     }
 }
 
+/**
+ * Compares one level's weight sequence with numCommon common weights.
+ * @param index index of the first non-common weight in the sequence, or -1 if there is none
+ * @param weight that first non-common weight
+ * @param count number of weights in the sequence
+ */
+static int32_t
+compareLevelWithCommon(int32_t index, uint32_t weight, int32_t count, int32_t numCommon) {
+    if(index >= 0) {
+        // The first difference is either at this weight,
+        // or at the end of the all-common sequence which sorts lowest.
+        return (index < numCommon && weight < Collation::COMMON_WEIGHT16) ? -1 : 1;
+    } else {
+        return (count < numCommon) ? -1 : (count > numCommon) ? 1 : 0;
+    }
+}
+
+int32_t
+CollationKeys::compareWithCommonWeights(const int64_t *ces, int32_t length,
+                                        const CollationSettings &settings) {
+    int32_t options = settings.options;
+    uint32_t variableTop;
+    if((options & CollationSettings::ALTERNATE_MASK) == 0) {
+        variableTop = 0;
+    } else {
+        // +1 so that we can use "<" and primary ignorables test out early.
+        variableTop = settings.variableTop + 1;
+    }
+    uint32_t tertiaryMask = CollationSettings::getTertiaryMask(options);
+
+    // Each primary CE of the all-common string has one common secondary and tertiary weight.
+    int32_t numPrimaries = 0;
+    int32_t numSecondaries = 0;
+    int32_t numTertiaries = 0;
+    int32_t secIndex = -1;
+    int32_t terIndex = -1;
+    uint32_t firstSecondary = 0;
+    uint32_t firstTertiary = 0;
+    for(int32_t i = 0; i < length; ++i) {
+        int64_t ce = ces[i];
+        uint32_t p = (uint32_t)(ce >> 32);
+        if(p < variableTop && p > Collation::MERGE_SEPARATOR_PRIMARY) {
+            // Shifted to the quaternary level, together with following primary ignorables.
+            while((i + 1) < length && (ces[i + 1] >> 32) == 0) { ++i; }
+            continue;
+        }
+        if(p == Collation::NO_CE_PRIMARY) { break; }
+        if(p != 0) { ++numPrimaries; }
+        uint32_t lower32 = (uint32_t)ce;
+        uint32_t s = lower32 >> 16;
+        if(s != 0) {
+            if(s != Collation::COMMON_WEIGHT16 && secIndex < 0) {
+                secIndex = numSecondaries;
+                firstSecondary = s;
+            }
+            ++numSecondaries;
+        }
+        uint32_t t = lower32 & tertiaryMask;
+        if(t != 0) {
+            if(t != Collation::COMMON_WEIGHT16 && terIndex < 0) {
+                terIndex = numTertiaries;
+                firstTertiary = t;
+            }
+            ++numTertiaries;
+        }
+    }
+
+    int32_t order = compareLevelWithCommon(secIndex, firstSecondary, numSecondaries, numPrimaries);
+    if(order != 0 || CollationSettings::getStrength(options) == UCOL_SECONDARY) {
+        return order;
+    }
+    return compareLevelWithCommon(terIndex, firstTertiary, numTertiaries, numPrimaries);
+}
+
 U_NAMESPACE_END
 
 #endif  // !UCONFIG_NO_COLLATION
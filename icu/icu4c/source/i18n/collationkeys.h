@@ -113,6 +113,22 @@ class U_I18N_API CollationKeys /* not : public UObject because all methods are s
                                            SortKeyByteSink &sink,
                                            Collation::Level minLevel, LevelCallback &callback,
                                            UBool preflight, UErrorCode &errorCode);
+
+    /**
+     * Compares the secondary and (if the strength is at least tertiary) the tertiary
+     * weights of the CEs with those of a string that has the same primary CEs
+     * but only common weights on these levels.
+     * Variable CEs and the primary ignorables that follow them are skipped
+     * as in writeSortKeyUpToQuaternary() when they are shifted.
+     *
+     * Requires strength<=tertiary, no case level, no backward secondary and no upperFirst,
+     * so that these levels are written in order and end-of-level sorts lowest.
+     *
+     * @param ces the CEs of a string, as from CollationIterator::fetchCEs()
+     * @return <0, 0 or >0 like a comparison of the string with the all-common string
+     */
+    static int32_t compareWithCommonWeights(const int64_t *ces, int32_t length,
+                                            const CollationSettings &settings);
 private:
     friend struct CollationDataReader;
 
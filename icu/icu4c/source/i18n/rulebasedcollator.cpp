@@ -50,6 +50,7 @@
 #include "ucol_imp.h"
 #include "uhash.h"
 #include "uitercollationiterator.h"
+#include "usimd.h"
 #include "ustr_imp.h"
 #include "utf16collationiterator.h"
 #include "utf8collationiterator.h"
@@ -989,15 +990,10 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     } else {
         leftLimit = left + leftLength;
         rightLimit = right + rightLength;
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        equalPrefixLength = SIMDUtil::commonPrefixLength(
+            left, right, leftLength < rightLength ? leftLength : rightLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
 
@@ -1047,6 +1043,14 @@ RuleBasedCollator::doCompare(const UChar *left, int32_t leftLength,
     }
 
     if(result == CollationFastLatin::BAIL_OUT_RESULT) {
+        result = CollationCompare::compareSimpleUTF16(data, *settings,
+                                                      left + equalPrefixLength,
+                                                      leftLength >= 0 ? leftLength - equalPrefixLength : -1,
+                                                      right + equalPrefixLength,
+                                                      rightLength >= 0 ? rightLength - equalPrefixLength : -1);
+    }
+
+    if(result == CollationCompare::BAIL_OUT_RESULT) {
         if(settings->dontCheckFCD()) {
             UTF16CollationIterator leftIter(data, numeric,
                                             left, left + equalPrefixLength, leftLimit);
@@ -1102,15 +1106,10 @@ RuleBasedCollator::doCompare(const uint8_t *left, int32_t leftLength,
             ++equalPrefixLength;
         }
     } else {
-        for(;;) {
-            if(equalPrefixLength == leftLength) {
-                if(equalPrefixLength == rightLength) { return UCOL_EQUAL; }
-                break;
-            } else if(equalPrefixLength == rightLength ||
-                      left[equalPrefixLength] != right[equalPrefixLength]) {
-                break;
-            }
-            ++equalPrefixLength;
+        equalPrefixLength = SIMDUtil::commonPrefixLength(
+            left, right, leftLength < rightLength ? leftLength : rightLength);
+        if(equalPrefixLength == leftLength && equalPrefixLength == rightLength) {
+            return UCOL_EQUAL;
         }
     }
     // Back up to the start of a partially-equal code point.
@@ -1335,18 +1334,22 @@ RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
     if(U_FAILURE(errorCode)) { return; }
     const UChar *limit = (length >= 0) ? s + length : NULL;
     UBool numeric = settings->isNumeric();
-    CollationKeys::LevelCallback callback;
     if(settings->dontCheckFCD()) {
         UTF16CollationIterator iter(data, numeric, s, s, limit);
-        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
-                                                  sink, Collation::PRIMARY_LEVEL,
-                                                  callback, true, errorCode);
+        writeSortKey(iter, s, limit, sink, errorCode);
     } else {
         FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
-        CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
-                                                  sink, Collation::PRIMARY_LEVEL,
-                                                  callback, true, errorCode);
+        writeSortKey(iter, s, limit, sink, errorCode);
     }
+}
+
+void
+RuleBasedCollator::writeSortKey(CollationIterator &iter, const UChar *s, const UChar *limit,
+                                SortKeyByteSink &sink, UErrorCode &errorCode) const {
+    CollationKeys::LevelCallback callback;
+    CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                              sink, Collation::PRIMARY_LEVEL,
+                                              callback, true, errorCode);
     if(settings->getStrength() == UCOL_IDENTICAL) {
         writeIdenticalLevel(s, limit, sink, errorCode);
     }
@@ -1354,6 +1357,161 @@ RuleBasedCollator::writeSortKey(const UChar *s, int32_t length,
     sink.Append(&terminator, 1);
 }
 
+int32_t
+RuleBasedCollator::internalGetSortKeys(const UChar *const *sources, const int32_t *sourceLengths,
+                                       int32_t count, uint8_t *dest, int32_t destCapacity,
+                                       int32_t *offsets, UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+            destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        dest = noDest;
+        destCapacity = 0;
+    }
+    // One sink for the whole batch: The keys are written back to back,
+    // and after an overflow the sink keeps counting the needed length.
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), destCapacity);
+    // The settings are the same for all strings, so one iterator is set up front
+    // and pointed at each string in turn.
+    UBool numeric = settings->isNumeric();
+    UBool checkFCD = !settings->dontCheckFCD();
+    static const UChar emptyString[1] = { 0 };
+    UTF16CollationIterator iter(data, numeric, emptyString, emptyString, emptyString);
+    FCDUTF16CollationIterator fcdIter(data, numeric, emptyString, emptyString, emptyString);
+    for(int32_t i = 0; i < count; ++i) {
+        offsets[i] = sink.NumberOfBytesAppended();
+        const UChar *s = sources[i];
+        int32_t length = (sourceLengths != NULL) ? sourceLengths[i] : -1;
+        if(s == NULL) {
+            if(length != 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return 0;
+            }
+            s = emptyString;
+        }
+        const UChar *limit = (length >= 0) ? s + length : NULL;
+        if(checkFCD) {
+            fcdIter.setText(s, limit);
+            writeSortKey(fcdIter, s, limit, sink, errorCode);
+        } else {
+            iter.setText(s, limit);
+            writeSortKey(iter, s, limit, sink, errorCode);
+        }
+        if(U_FAILURE(errorCode)) { return 0; }
+    }
+    int32_t totalLength = sink.NumberOfBytesAppended();
+    offsets[count] = totalLength;
+    if(totalLength > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return totalLength;
+}
+
+namespace {
+
+/**
+ * Remembers where the primary level ends,
+ * and stops writing there if the compact sort key drops the following levels.
+ */
+class CompactLevelCallback : public CollationKeys::LevelCallback {
+public:
+    CompactLevelCallback(const SortKeyByteSink &s, UBool writeBeyondPrimary)
+            : sink(s), writeAll(writeBeyondPrimary), primaryLength(-1) {}
+    virtual ~CompactLevelCallback() {}
+    virtual UBool needToWrite(Collation::Level level) override {
+        if(level == Collation::SECONDARY_LEVEL) {
+            primaryLength = sink.NumberOfBytesAppended();
+            return writeAll;
+        }
+        return true;
+    }
+    int32_t getPrimaryLength() const { return primaryLength; }
+
+private:
+    const SortKeyByteSink &sink;
+    UBool writeAll;
+    int32_t primaryLength;
+};
+
+}  // namespace
+
+int32_t
+RuleBasedCollator::internalGetCompactSortKey(const UChar *s, int32_t length,
+                                             uint8_t *dest, int32_t destCapacity,
+                                             UErrorCode &errorCode) const {
+    if(U_FAILURE(errorCode)) { return 0; }
+    if((s == NULL && length != 0) || destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    uint8_t noDest[1] = { 0 };
+    if(dest == NULL) {
+        dest = noDest;
+        destCapacity = 0;
+    }
+    static const UChar emptyString[1] = { 0 };
+    if(s == NULL) { s = emptyString; }
+    const UChar *limit = (length >= 0) ? s + length : NULL;
+    UBool numeric = settings->isNumeric();
+    int32_t keyLength;
+    if(settings->dontCheckFCD()) {
+        UTF16CollationIterator iter(data, numeric, s, s, limit);
+        keyLength = writeCompactSortKey(iter, s, limit, dest, destCapacity, errorCode);
+    } else {
+        FCDUTF16CollationIterator iter(data, numeric, s, s, limit);
+        keyLength = writeCompactSortKey(iter, s, limit, dest, destCapacity, errorCode);
+    }
+    if(U_FAILURE(errorCode)) { return 0; }
+    if(keyLength > destCapacity) {
+        errorCode = U_BUFFER_OVERFLOW_ERROR;
+    }
+    return keyLength;
+}
+
+int32_t
+RuleBasedCollator::writeCompactSortKey(CollationIterator &iter, const UChar *s, const UChar *limit,
+                                       uint8_t *dest, int32_t destCapacity,
+                                       UErrorCode &errorCode) const {
+    // The compact key is the regular sort key without the terminator byte,
+    // except when the secondary and tertiary levels are written in order and
+    // end-of-level sorts lowest. Then these levels are classified against
+    // a string with the same primary weights but only common weights beyond them:
+    // - equal: P 01, the remaining levels are dropped
+    // - less:  P 00 S 01 T
+    // - greater: P 01 S 01 T (unchanged)
+    // The primary level never contains 00 or 01 bytes, so memcmp() order is preserved.
+    int32_t options = settings->options;
+    int32_t strength = CollationSettings::getStrength(options);
+    int32_t order = 1;
+    if((strength == UCOL_SECONDARY || strength == UCOL_TERTIARY) &&
+            (options & (CollationSettings::CASE_LEVEL | CollationSettings::BACKWARD_SECONDARY |
+                        CollationSettings::UPPER_FIRST)) == 0) {
+        iter.fetchCEs(errorCode);
+        if(U_FAILURE(errorCode)) { return 0; }
+        order = CollationKeys::compareWithCommonWeights(iter.getCEs(), iter.getCEsLength(),
+                                                        *settings);
+        iter.rewindCEs();
+    }
+    FixedSortKeyByteSink sink(reinterpret_cast<char *>(dest), destCapacity);
+    CompactLevelCallback callback(sink, order != 0);
+    CollationKeys::writeSortKeyUpToQuaternary(iter, data->compressibleBytes, *settings,
+                                              sink, Collation::PRIMARY_LEVEL,
+                                              callback, true, errorCode);
+    if(strength == UCOL_IDENTICAL) {
+        writeIdenticalLevel(s, limit, sink, errorCode);
+    }
+    if(order == 0) {
+        sink.Append(Collation::LEVEL_SEPARATOR_BYTE);
+    } else if(order < 0 && callback.getPrimaryLength() < destCapacity) {
+        dest[callback.getPrimaryLength()] = 0;
+    }
+    return sink.NumberOfBytesAppended();
+}
+
 void
 RuleBasedCollator::writeIdenticalLevel(const UChar *s, const UChar *limit,
                                        SortKeyByteSink &sink, UErrorCode &errorCode) const {
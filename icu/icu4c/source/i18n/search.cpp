@@ -32,10 +32,12 @@ SearchIterator::SearchIterator(const SearchIterator &other)
     m_search_->isCanonicalMatch = other.m_search_->isCanonicalMatch;
     m_search_->isOverlap        = other.m_search_->isOverlap;
     m_search_->elementComparisonType = other.m_search_->elementComparisonType;
+    m_search_->useSkipTable     = other.m_search_->useSkipTable;
     m_search_->matchedIndex     = other.m_search_->matchedIndex;
     m_search_->matchedLength    = other.m_search_->matchedLength;
     m_search_->text             = other.m_search_->text;
     m_search_->textLength       = other.m_search_->textLength;
+    m_search_->utf8Text         = NULL;
 }
 
 SearchIterator::~SearchIterator()
@@ -67,6 +69,9 @@ void SearchIterator::setAttribute(USearchAttribute       attribute,
                 m_search_->elementComparisonType = 0;
             }
             break;
+        case USEARCH_SKIP_TABLE :
+            m_search_->useSkipTable = (value == USEARCH_ON ? true : false);
+            break;
         default:
             status = U_ILLEGAL_ARGUMENT_ERROR;
         }
@@ -94,6 +99,8 @@ USearchAttributeValue SearchIterator::getAttribute(
                 return USEARCH_STANDARD_ELEMENT_COMPARISON;
             }
         }
+    case USEARCH_SKIP_TABLE :
+        return (m_search_->useSkipTable == true ? USEARCH_ON : USEARCH_OFF);
     default :
         return USEARCH_DEFAULT;
     }
@@ -187,6 +194,7 @@ bool SearchIterator::operator==(const SearchIterator &that) const
             m_search_->isCanonicalMatch == that.m_search_->isCanonicalMatch &&
             m_search_->isOverlap        == that.m_search_->isOverlap &&
             m_search_->elementComparisonType == that.m_search_->elementComparisonType &&
+            m_search_->useSkipTable     == that.m_search_->useSkipTable &&
             m_search_->matchedIndex     == that.m_search_->matchedIndex &&
             m_search_->matchedLength    == that.m_search_->matchedLength &&
             m_search_->textLength       == that.m_search_->textLength &&
@@ -336,6 +344,7 @@ void SearchIterator::reset()
     m_search_->isOverlap          = false;
     m_search_->isCanonicalMatch   = false;
     m_search_->elementComparisonType = 0;
+    m_search_->useSkipTable       = false;
     m_search_->isForwardSearching = true;
     m_search_->reset              = true;
 }
@@ -349,12 +358,14 @@ SearchIterator::SearchIterator()
     m_search_->isOverlap          = false;
     m_search_->isCanonicalMatch   = false;
     m_search_->elementComparisonType = 0;
+    m_search_->useSkipTable       = false;
     m_search_->isForwardSearching = true;
     m_search_->reset              = true;
     m_search_->matchedIndex       = USEARCH_DONE;
     m_search_->matchedLength      = 0;
     m_search_->text               = NULL;
     m_search_->textLength         = 0;
+    m_search_->utf8Text           = NULL;
     m_breakiterator_              = NULL;
 }
 
@@ -368,12 +379,14 @@ SearchIterator::SearchIterator(const UnicodeString &text,
     m_search_->isOverlap          = false;
     m_search_->isCanonicalMatch   = false;
     m_search_->elementComparisonType = 0;
+    m_search_->useSkipTable       = false;
     m_search_->isForwardSearching = true;
     m_search_->reset              = true;
     m_search_->matchedIndex       = USEARCH_DONE;
     m_search_->matchedLength      = 0;
     m_search_->text               = m_text_.getBuffer();
     m_search_->textLength         = text.length();
+    m_search_->utf8Text           = NULL;
 }
 
 SearchIterator::SearchIterator(CharacterIterator &text, 
@@ -385,6 +398,7 @@ SearchIterator::SearchIterator(CharacterIterator &text,
     m_search_->isOverlap          = false;
     m_search_->isCanonicalMatch   = false;
     m_search_->elementComparisonType = 0;
+    m_search_->useSkipTable       = false;
     m_search_->isForwardSearching = true;
     m_search_->reset              = true;
     m_search_->matchedIndex       = USEARCH_DONE;
@@ -392,6 +406,7 @@ SearchIterator::SearchIterator(CharacterIterator &text,
     text.getText(m_text_);
     m_search_->text               = m_text_.getBuffer();
     m_search_->textLength         = m_text_.length();
+    m_search_->utf8Text           = NULL;
     m_breakiterator_             = breakiter;
 }
 
@@ -406,6 +421,7 @@ SearchIterator & SearchIterator::operator=(const SearchIterator &that)
         m_search_->isCanonicalMatch = that.m_search_->isCanonicalMatch;
         m_search_->isOverlap        = that.m_search_->isOverlap;
         m_search_->elementComparisonType = that.m_search_->elementComparisonType;
+        m_search_->useSkipTable     = that.m_search_->useSkipTable;
         m_search_->matchedIndex     = that.m_search_->matchedIndex;
         m_search_->matchedLength    = that.m_search_->matchedLength;
         m_search_->text             = that.m_search_->text;
@@ -215,6 +215,109 @@ ucol_getSortKey(const    UCollator    *coll,
     return keySize;
 }
 
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources,
+                 const int32_t *sourceLengths,
+                 int32_t count,
+                 uint8_t *dest,
+                 int32_t destCapacity,
+                 int32_t *offsets,
+                 UErrorCode *pErrorCode)
+{
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(coll==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    UTRACE_DATA3(UTRACE_VERBOSE, "coll=%p, count=%d, destCapacity=%d", coll, count, destCapacity);
+
+    int32_t totalLength;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        totalLength = rbc->internalGetSortKeys(sources, sourceLengths, count,
+                                               dest, destCapacity, offsets, *pErrorCode);
+    } else if(count < 0 || (sources == NULL && count > 0) || offsets == NULL ||
+              destCapacity < 0 || (dest == NULL && destCapacity > 0)) {
+        *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        totalLength = 0;
+    } else {
+        // Other Collator subclasses: one key at a time.
+        static const UChar emptyString[1] = { 0 };
+        const Collator *c = Collator::fromUCollator(coll);
+        totalLength = 0;
+        for(int32_t i = 0; i < count; ++i) {
+            offsets[i] = totalLength;
+            const UChar *s = sources[i];
+            int32_t length = (sourceLengths != NULL) ? sourceLengths[i] : -1;
+            if(s == NULL) {
+                if(length != 0) {
+                    *pErrorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                    totalLength = 0;
+                    break;
+                }
+                s = emptyString;
+            }
+            int32_t keyLength = totalLength < destCapacity ?
+                c->getSortKey(s, length, dest + totalLength, destCapacity - totalLength) :
+                c->getSortKey(s, length, NULL, 0);
+            if(keyLength == 0) {
+                *pErrorCode = U_INTERNAL_PROGRAM_ERROR;
+                totalLength = 0;
+                break;
+            }
+            totalLength += keyLength;
+        }
+        if(U_SUCCESS(*pErrorCode)) {
+            offsets[count] = totalLength;
+            if(totalLength > destCapacity) {
+                *pErrorCode = U_BUFFER_OVERFLOW_ERROR;
+            }
+        }
+    }
+
+    UTRACE_EXIT_VALUE_STATUS(totalLength, *pErrorCode);
+    return totalLength;
+}
+
+U_CAPI int32_t U_EXPORT2
+ucol_getCompactSortKey(const UCollator *coll,
+                       const UChar *source,
+                       int32_t sourceLength,
+                       uint8_t *dest,
+                       int32_t destCapacity,
+                       UErrorCode *pErrorCode)
+{
+    if(pErrorCode==NULL || U_FAILURE(*pErrorCode)) {
+        return 0;
+    }
+    if(coll==NULL) {
+        *pErrorCode=U_ILLEGAL_ARGUMENT_ERROR;
+        return 0;
+    }
+    UTRACE_ENTRY(UTRACE_UCOL_GET_SORTKEY);
+    if (UTRACE_LEVEL(UTRACE_VERBOSE)) {
+        UTRACE_DATA3(UTRACE_VERBOSE, "coll=%p, source string = %vh ", coll, source,
+            ((sourceLength==-1 && source!=NULL) ? u_strlen(source) : sourceLength));
+    }
+
+    int32_t keyLength;
+    const RuleBasedCollator *rbc = RuleBasedCollator::rbcFromUCollator(coll);
+    if(rbc != NULL) {
+        keyLength = rbc->internalGetCompactSortKey(source, sourceLength,
+                                                   dest, destCapacity, *pErrorCode);
+    } else {
+        *pErrorCode = U_UNSUPPORTED_ERROR;
+        keyLength = 0;
+    }
+
+    UTRACE_EXIT_VALUE_STATUS(keyLength, *pErrorCode);
+    return keyLength;
+}
+
 U_CAPI int32_t U_EXPORT2
 ucol_nextSortKeyPart(const UCollator *coll,
                      UCharIterator *iter,
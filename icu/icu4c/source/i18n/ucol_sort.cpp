@@ -0,0 +1,281 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+
+// ucol_sort.cpp
+// created: 2026oct17
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_COLLATION
+
+#include "unicode/coll.h"
+#include "unicode/localpointer.h"
+#include "unicode/ucol.h"
+#include "unicode/unistr.h"
+#include "unicode/ustring.h"
+#include "charstr.h"
+#include "cmemory.h"
+#include "cstring.h"
+#include "uarrsort.h"
+#include "uparallel.h"
+
+U_NAMESPACE_USE
+
+namespace {
+
+// Fewer strings per worker are not worth starting a thread.
+constexpr int32_t MIN_STRINGS_PER_THREAD = 1000;
+constexpr int32_t MAX_THREADS = U_PARALLEL_MAX_THREADS;
+
+struct SortItem {
+    const char *key;
+    int32_t index;
+    int32_t keyOffset;  // into the chunk's keys, until they are all written
+};
+
+/**
+ * One worker's contiguous range of input strings.
+ * The worker writes their sort keys and then sorts the range by key.
+ */
+struct SortChunk : public UMemory {
+    const Collator *coll;
+    const void *const *strings;
+    const int32_t *lengths;
+    UBool isUTF8;
+    SortItem *items;
+    int32_t start;
+    int32_t limit;
+    CharString keys;
+    UErrorCode errorCode;
+};
+
+/** Merges the adjacent sorted runs [start, middle[ and [middle, limit[ of src into dest. */
+struct MergeTask {
+    const SortItem *src;
+    SortItem *dest;
+    int32_t start;
+    int32_t middle;
+    int32_t limit;
+};
+
+void appendSortKey(const Collator &coll, const UChar *s, int32_t length,
+                   CharString &keys, UErrorCode &errorCode) {
+    int32_t capacity;
+    // Hint at doubling the buffer so that appending many keys is amortized linear.
+    char *buffer = keys.getAppendBuffer(64, keys.length() + 1024, capacity, errorCode);
+    if(U_FAILURE(errorCode)) { return; }
+    int32_t keyLength = coll.getSortKey(s, length, reinterpret_cast<uint8_t *>(buffer), capacity);
+    if(keyLength > capacity) {
+        buffer = keys.getAppendBuffer(keyLength, keys.length() + keyLength, capacity, errorCode);
+        if(U_FAILURE(errorCode)) { return; }
+        keyLength = coll.getSortKey(s, length, reinterpret_cast<uint8_t *>(buffer), capacity);
+    }
+    if(keyLength == 0) {
+        errorCode = U_INTERNAL_PROGRAM_ERROR;
+        return;
+    }
+    keys.append(buffer, keyLength, errorCode);
+}
+
+void writeSortKeys(SortChunk &chunk) {
+    UErrorCode &errorCode = chunk.errorCode;
+    UnicodeString s16;  // UTF-8 input is converted into this reused buffer
+    for(int32_t i = chunk.start; U_SUCCESS(errorCode) && i < chunk.limit; ++i) {
+        SortItem &item = chunk.items[i];
+        item.index = i;
+        item.keyOffset = chunk.keys.length();
+        int32_t length = (chunk.lengths != NULL) ? chunk.lengths[i] : -1;
+        if(!chunk.isUTF8) {
+            const UChar *s = static_cast<const UChar *>(chunk.strings[i]);
+            if(s == NULL && length != 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+            appendSortKey(*chunk.coll, s, length, chunk.keys, errorCode);
+        } else {
+            const char *s = static_cast<const char *>(chunk.strings[i]);
+            if(s == NULL && length != 0) {
+                errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+                return;
+            }
+            if(length < 0) { length = static_cast<int32_t>(uprv_strlen(s)); }
+            // A UTF-8 string never has more UTF-16 units than bytes.
+            UChar *buffer = s16.getBuffer(length);
+            if(buffer == NULL) {
+                errorCode = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+            int32_t length16;
+            u_strFromUTF8WithSub(buffer, s16.getCapacity(), &length16, s, length,
+                                 0xfffd, NULL, &errorCode);
+            s16.releaseBuffer(U_SUCCESS(errorCode) ? length16 : 0);
+            appendSortKey(*chunk.coll, s16.getBuffer(), s16.length(), chunk.keys, errorCode);
+        }
+    }
+    if(U_FAILURE(errorCode)) { return; }
+    // The keys are complete and their buffer no longer moves.
+    const char *keys = chunk.keys.data();
+    for(int32_t i = chunk.start; i < chunk.limit; ++i) {
+        chunk.items[i].key = keys + chunk.items[i].keyOffset;
+    }
+}
+
+int32_t U_CALLCONV
+compareSortItems(const void * /*context*/, const void *left, const void *right) {
+    const SortItem *l = static_cast<const SortItem *>(left);
+    const SortItem *r = static_cast<const SortItem *>(right);
+    // Sort keys end with the only 00 byte.
+    int32_t result = uprv_strcmp(l->key, r->key);
+    if(result == 0) {
+        // Equal strings stay in input order.
+        result = (l->index < r->index) ? -1 : 1;
+    }
+    return result;
+}
+
+void sortChunk(SortChunk &chunk) {
+    writeSortKeys(chunk);
+    // The index tie-breaker makes the order stable,
+    // so we need not ask for the stable (insertion) sort.
+    uprv_sortArray(chunk.items + chunk.start, chunk.limit - chunk.start, (int32_t)sizeof(SortItem),
+                   compareSortItems, NULL, false, &chunk.errorCode);
+}
+
+void mergeRuns(MergeTask &task) {
+    const SortItem *src = task.src;
+    SortItem *dest = task.dest;
+    int32_t i = task.start;
+    int32_t j = task.middle;
+    int32_t k = task.start;
+    while(i < task.middle && j < task.limit) {
+        // Take from the left run on ties, to keep equal strings in input order.
+        if(uprv_strcmp(src[j].key, src[i].key) < 0) {
+            dest[k++] = src[j++];
+        } else {
+            dest[k++] = src[i++];
+        }
+    }
+    while(i < task.middle) { dest[k++] = src[i++]; }
+    while(j < task.limit) { dest[k++] = src[j++]; }
+}
+
+void sortStrings(const UCollator *coll, const void *const *strings, const int32_t *lengths,
+                 int32_t count, UBool isUTF8, int32_t *order, int32_t numThreads,
+                 UErrorCode &errorCode) {
+    if(U_FAILURE(errorCode)) { return; }
+    if(coll == NULL || count < 0 || (strings == NULL && count > 0) ||
+            (order == NULL && count > 0)) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if(count == 0) { return; }
+    if(numThreads <= 0) {
+        numThreads = uprv_getNumberOfProcessors();
+    }
+    int32_t maxThreads = count / MIN_STRINGS_PER_THREAD;
+    if(maxThreads > MAX_THREADS) { maxThreads = MAX_THREADS; }
+    if(numThreads > maxThreads) { numThreads = maxThreads > 0 ? maxThreads : 1; }
+
+    LocalMemory<SortItem> items;
+    LocalMemory<SortItem> temp;
+    if(items.allocateInsteadAndReset(count) == NULL ||
+            (numThreads > 1 && temp.allocateInsteadAndReset(count) == NULL)) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    LocalArray<SortChunk> chunks(new SortChunk[numThreads]);
+    if(chunks.isNull()) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    // Run boundaries: chunk i covers [bounds[i], bounds[i+1][.
+    LocalMemory<int32_t> bounds;
+    if(bounds.allocateInsteadAndReset(numThreads + 1) == NULL) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    const Collator *c = Collator::fromUCollator(coll);
+    for(int32_t i = 0; i < numThreads; ++i) {
+        SortChunk &chunk = chunks[i];
+        chunk.coll = c;
+        chunk.strings = strings;
+        chunk.lengths = lengths;
+        chunk.isUTF8 = isUTF8;
+        chunk.items = items.getAlias();
+        chunk.start = bounds[i] = (int32_t)(((int64_t)count * i) / numThreads);
+        chunk.limit = (int32_t)(((int64_t)count * (i + 1)) / numThreads);
+        chunk.errorCode = U_ZERO_ERROR;
+    }
+    bounds[numThreads] = count;
+
+    // Write the sort keys once and sort each chunk on its own thread.
+    runInParallel(sortChunk, chunks.getAlias(), numThreads);
+    for(int32_t i = 0; U_SUCCESS(errorCode) && i < numThreads; ++i) {
+        errorCode = chunks[i].errorCode;
+    }
+    if(U_FAILURE(errorCode)) { return; }
+
+    // Merge pairs of sorted runs in parallel until one run remains.
+    SortItem *src = items.getAlias();
+    SortItem *dest = temp.getAlias();
+    MergeTask tasks[MAX_THREADS / 2];
+    int32_t numRuns = numThreads;
+    while(numRuns > 1) {
+        int32_t numTasks = 0;
+        int32_t numMerged = 0;
+        for(int32_t r = 0; r + 1 < numRuns; r += 2) {
+            MergeTask &task = tasks[numTasks++];
+            task.src = src;
+            task.dest = dest;
+            task.start = bounds[r];
+            task.middle = bounds[r + 1];
+            task.limit = bounds[r + 2];
+            bounds[numMerged++] = task.start;
+        }
+        runInParallel(mergeRuns, tasks, numTasks);
+        if((numRuns & 1) != 0) {
+            // Odd run out: copy it over as is.
+            int32_t start = bounds[numRuns - 1];
+            uprv_memcpy(dest + start, src + start, (size_t)(count - start) * sizeof(SortItem));
+            bounds[numMerged++] = start;
+        }
+        bounds[numMerged] = count;
+        numRuns = numMerged;
+        SortItem *t = src;
+        src = dest;
+        dest = t;
+    }
+    for(int32_t i = 0; i < count; ++i) {
+        order[i] = src[i].index;
+    }
+}
+
+}  // namespace
+
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const *strings,
+                 const int32_t *lengths,
+                 int32_t count,
+                 int32_t *order,
+                 int32_t numThreads,
+                 UErrorCode *pErrorCode) {
+    if(pErrorCode == NULL) { return; }
+    sortStrings(coll, reinterpret_cast<const void *const *>(strings), lengths, count,
+                false, order, numThreads, *pErrorCode);
+}
+
+U_CAPI void U_EXPORT2
+ucol_sortStringsUTF8(const UCollator *coll,
+                     const char *const *strings,
+                     const int32_t *lengths,
+                     int32_t count,
+                     int32_t *order,
+                     int32_t numThreads,
+                     UErrorCode *pErrorCode) {
+    if(pErrorCode == NULL) { return; }
+    sortStrings(coll, reinterpret_cast<const void *const *>(strings), lengths, count,
+                true, order, numThreads, *pErrorCode);
+}
+
+#endif  // !UCONFIG_NO_COLLATION
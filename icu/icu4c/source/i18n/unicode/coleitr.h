@@ -305,6 +305,18 @@ class U_I18N_API CollationElementIterator U_FINAL : public UObject {
     inline const UCollationElements *toUCollationElements() const {
         return reinterpret_cast<const UCollationElements *>(this);
     }
+
+    /**
+     * Sets the source to the UTF-8 string, which is neither copied nor converted.
+     * getOffset() and setOffset() then work with UTF-8 byte offsets.
+     * The string must not be modified or deleted while the iterator uses it.
+     * Used by usearch_setTextUTF8().
+     * @param source the UTF-8 string
+     * @param length the length of source in bytes, or -1 if NUL-terminated
+     * @param status the error code status.
+     * @internal
+     */
+    void setUTF8Text(const char *source, int32_t length, UErrorCode &status);
 #endif  // U_HIDE_INTERNAL_API
 
 private:
@@ -360,6 +372,20 @@ class U_I18N_API CollationElementIterator U_FINAL : public UObject {
 
     static int32_t getMaxExpansion(const UHashtable *maxExpansions, int32_t order);
 
+    /** Implements setOffset() for UTF-8 text. */
+    void setUTF8Offset(int32_t newOffset, UErrorCode &status);
+
+    /**
+     * Returns the last offset no greater than newOffset where forward iteration
+     * from safeOffset yields a CE boundary.
+     */
+    int32_t getLastSafeOffset(int32_t safeOffset, int32_t newOffset, UErrorCode &status);
+
+    /** Returns the length of the text in UTF-16 units, or in bytes for UTF-8 text. */
+    inline int32_t getTextLength() const {
+        return text8_ != NULL ? text8Length_ : string_.length();
+    }
+
     // CollationElementIterator private data members ----------------------------
 
     CollationIterator *iter_;  // owned
@@ -378,6 +404,9 @@ class U_I18N_API CollationElementIterator U_FINAL : public UObject {
     UVector32 *offsets_;
 
     UnicodeString string_;
+    /** The UTF-8 text from setUTF8Text(), not owned; NULL when iterating over string_. */
+    const uint8_t *text8_;
+    int32_t text8Length_;
 };
 
 // CollationElementIterator inline method definitions --------------------------
@@ -87,6 +87,7 @@ class StringSearch;
 * @stable ICU 2.0
 */
 class CollationElementIterator;
+class CollationIterator;
 class CollationKey;
 class SortKeyByteSink;
 class UnicodeSet;
@@ -782,6 +783,20 @@ class U_I18N_API RuleBasedCollator U_FINAL : public Collator {
             UParseError *outParseError, UnicodeString *outReason,
             UErrorCode &errorCode);
 
+    /**
+     * Implements ucol_openRulesWithCache().
+     * Like internalBuildTailoring(), but first tries to load the tailoring
+     * from a file in cacheDir, and writes that file after building the tailoring.
+     * @internal
+     */
+    void internalBuildTailoringWithCache(
+            const UnicodeString &rules,
+            int32_t strength,
+            UColAttributeValue decompositionMode,
+            const char *cacheDir,
+            UParseError *outParseError,
+            UErrorCode &errorCode);
+
     /** @internal */
     static inline RuleBasedCollator *rbcFromUCollator(UCollator *uc) {
         return dynamic_cast<RuleBasedCollator *>(fromUCollator(uc));
@@ -791,6 +806,24 @@ class U_I18N_API RuleBasedCollator U_FINAL : public Collator {
         return dynamic_cast<const RuleBasedCollator *>(fromUCollator(uc));
     }
 
+    /**
+     * Implements ucol_getSortKeys().
+     * Writes the sort keys of count strings back to back into dest,
+     * reusing one collation iterator and one sink for the whole batch.
+     * @internal
+     */
+    int32_t internalGetSortKeys(const char16_t *const *sources, const int32_t *sourceLengths,
+                                int32_t count, uint8_t *dest, int32_t destCapacity,
+                                int32_t *offsets, UErrorCode &errorCode) const;
+
+    /**
+     * Implements ucol_getCompactSortKey().
+     * @internal
+     */
+    int32_t internalGetCompactSortKey(const char16_t *s, int32_t length,
+                                      uint8_t *dest, int32_t destCapacity,
+                                      UErrorCode &errorCode) const;
+
     /**
      * Appends the CEs for the string to the vector.
      * @internal for tests & tools
@@ -837,6 +870,13 @@ class U_I18N_API RuleBasedCollator U_FINAL : public Collator {
     void writeSortKey(const char16_t *s, int32_t length,
                       SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
+    void writeSortKey(CollationIterator &iter, const char16_t *s, const char16_t *limit,
+                      SortKeyByteSink &sink, UErrorCode &errorCode) const;
+
+    int32_t writeCompactSortKey(CollationIterator &iter, const char16_t *s, const char16_t *limit,
+                                uint8_t *dest, int32_t destCapacity,
+                                UErrorCode &errorCode) const;
+
     void writeIdenticalLevel(const char16_t *s, const char16_t *limit,
                              SortKeyByteSink &sink, UErrorCode &errorCode) const;
 
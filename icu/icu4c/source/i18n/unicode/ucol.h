@@ -437,6 +437,47 @@ ucol_openRules( const UChar        *rules,
                 UParseError        *parseError,
                 UErrorCode         *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Like ucol_openRules(), but keeps the built tailoring in a file
+ * in the cacheDir directory so that later calls with the same rules,
+ * also in other processes, need not build it again.
+ *
+ * The cache file name is derived from a hash of the rule string.
+ * On a later call, the file is memory-mapped and its data is used in place,
+ * without parsing the rules or copying the tailoring data.
+ * The file is used only if it was written by the same ICU version
+ * with the same root collation data, and for exactly the same rule string;
+ * otherwise the tailoring is built and the file is replaced.
+ * Failure to read or write the cache is not an error.
+ *
+ * The normalizationMode and strength are applied to the collator
+ * after building or loading the tailoring, and do not affect the cache file.
+ *
+ * @param rules A string describing the collation rules.
+ * @param rulesLength The length of rules, or -1 if null-terminated.
+ * @param normalizationMode The normalization mode, as for ucol_openRules().
+ * @param strength The default collation strength, as for ucol_openRules().
+ * @param cacheDir An existing, writable directory for the cache files.
+ *                 If NULL or empty, then this function behaves like ucol_openRules().
+ * @param parseError  A pointer to UParseError to receive information about errors
+ *                    occurred during parsing. Can be NULL.
+ * @param status A pointer to a UErrorCode to receive any errors
+ * @return A pointer to a UCollator, or NULL if an error occurred.
+ * @see ucol_openRules
+ * @see ucol_cloneBinary
+ * @draft ICU 72
+ */
+U_CAPI UCollator* U_EXPORT2
+ucol_openRulesWithCache(const UChar        *rules,
+                        int32_t            rulesLength,
+                        UColAttributeValue normalizationMode,
+                        UCollationStrength strength,
+                        const char         *cacheDir,
+                        UParseError        *parseError,
+                        UErrorCode         *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_DEPRECATED_API
 /** 
  * Open a collator defined by a short form string.
@@ -1023,6 +1064,156 @@ ucol_getSortKey(const    UCollator    *coll,
         uint8_t        *result,
         int32_t        resultLength);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+ * Gets the sort keys for many strings at once.
+ * The keys are written back to back into one caller-provided buffer,
+ * each with its terminating zero byte, in the order of the input strings.
+ * Key i occupies the bytes from offsets[i] up to but not including offsets[i+1].
+ *
+ * Each key is the same as the one from ucol_getSortKey() for the same string.
+ * Compared with calling ucol_getSortKey() in a loop, the collator's settings are
+ * looked up and the collation iterator is set up only once for the whole batch.
+ *
+ * This function supports preflighting: If the total length of the keys exceeds
+ * destCapacity, then the offsets are still set but the buffer contents are undefined,
+ * the total length is returned, and *pErrorCode is set to U_BUFFER_OVERFLOW_ERROR.
+ *
+ * A collator can be shared by threads that each call this function on
+ * their own part of the input, as long as its attributes are not changed concurrently.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param sources Array of count strings.
+ * @param sourceLengths Array of count string lengths; a length can be -1 if that string
+ *                      is NUL-terminated. If sourceLengths is NULL, then all strings
+ *                      are NUL-terminated.
+ * @param count The number of strings.
+ * @param dest Buffer to receive the sort keys. Can be NULL if destCapacity==0.
+ * @param destCapacity The size of dest in bytes.
+ * @param offsets Array of count+1 elements that receives the start offset of each key,
+ *                followed by the total length.
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @return The total length of all sort keys.
+ * @see ucol_getSortKey
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getSortKeys(const UCollator *coll,
+                 const UChar *const *sources,
+                 const int32_t *sourceLengths,
+                 int32_t count,
+                 uint8_t *dest,
+                 int32_t destCapacity,
+                 int32_t *offsets,
+                 UErrorCode *pErrorCode);
+
+/**
+ * Gets a compact sort key for a string, for storage in a database index
+ * or another place where many keys are kept.
+ *
+ * Compact sort keys compare with memcmp() over the length of the shorter key,
+ * and then the shorter key is less (as with std::string or a binary column).
+ * Compact keys of the same collator compare in the same order as their strings,
+ * but they must not be compared with keys from ucol_getSortKey().
+ * A compact key has no terminating zero byte and may contain zero bytes.
+ *
+ * For strength secondary or tertiary without case level, backwards secondary or
+ * upper-first, the secondary and tertiary levels are omitted entirely when they contain
+ * only common weights, which is the case for most lowercase text without accents.
+ * Otherwise the key is the same as from ucol_getSortKey() minus the terminating zero byte.
+ *
+ * This function supports preflighting: If the key length exceeds destCapacity,
+ * then the buffer contents are undefined, the length is returned,
+ * and *pErrorCode is set to U_BUFFER_OVERFLOW_ERROR.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param source The string to transform.
+ * @param sourceLength The length of source, or -1 if source is NUL-terminated.
+ * @param dest Buffer to receive the compact sort key. Can be NULL if destCapacity==0.
+ * @param destCapacity The size of dest in bytes.
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ *                   Set to U_UNSUPPORTED_ERROR if coll is not rule-based.
+ * @return The length of the compact sort key.
+ * @see ucol_getSortKey
+ * @draft ICU 72
+ */
+U_CAPI int32_t U_EXPORT2
+ucol_getCompactSortKey(const UCollator *coll,
+                       const UChar *source,
+                       int32_t sourceLength,
+                       uint8_t *dest,
+                       int32_t destCapacity,
+                       UErrorCode *pErrorCode);
+
+/**
+ * Sorts an array of strings in collation order.
+ * The strings themselves are not moved; instead, order receives the permutation:
+ * order[i] is the index of the string that sorts at position i.
+ * Strings that compare equal stay in input order.
+ *
+ * Each string's sort key is generated once, rather than comparing strings
+ * O(log n) times each with ucol_strcoll().
+ * Generating the keys and sorting are split across up to numThreads threads,
+ * including the calling thread, which share the collator.
+ * Small inputs are sorted with fewer threads.
+ * If a thread cannot be started, then its share of the work is done on the calling thread.
+ * The collator must not be modified while this function runs.
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param strings Array of count strings.
+ * @param lengths Array of count string lengths; a length can be -1 if that string
+ *                is NUL-terminated. If lengths is NULL, then all strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param order Array of count elements that receives the sorted order of string indexes.
+ * @param numThreads The maximum number of threads to use.
+ *                   1 sorts on the calling thread only.
+ *                   0 or negative uses the number of hardware threads.
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @see ucol_getSortKey
+ * @draft ICU 72
+ */
+U_CAPI void U_EXPORT2
+ucol_sortStrings(const UCollator *coll,
+                 const UChar *const *strings,
+                 const int32_t *lengths,
+                 int32_t count,
+                 int32_t *order,
+                 int32_t numThreads,
+                 UErrorCode *pErrorCode);
+
+/**
+ * Sorts an array of UTF-8 strings in collation order.
+ * Same as ucol_sortStrings() except that the strings are in UTF-8.
+ * Ill-formed UTF-8 sorts as if each maximal ill-formed subsequence was U+FFFD,
+ * as in ucol_strcollUTF8().
+ *
+ * @param coll The UCollator containing the collation rules.
+ * @param strings Array of count UTF-8 strings.
+ * @param lengths Array of count string lengths in bytes; a length can be -1 if that string
+ *                is NUL-terminated. If lengths is NULL, then all strings are NUL-terminated.
+ * @param count The number of strings.
+ * @param order Array of count elements that receives the sorted order of string indexes.
+ * @param numThreads The maximum number of threads to use.
+ *                   1 sorts on the calling thread only.
+ *                   0 or negative uses the number of hardware threads.
+ * @param pErrorCode ICU error code in/out parameter.
+ *                   Must fulfill U_SUCCESS before the function call.
+ * @see ucol_sortStrings
+ * @draft ICU 72
+ */
+U_CAPI void U_EXPORT2
+ucol_sortStringsUTF8(const UCollator *coll,
+                     const char *const *strings,
+                     const int32_t *lengths,
+                     int32_t count,
+                     int32_t *order,
+                     int32_t numThreads,
+                     UErrorCode *pErrorCode);
+#endif  /* U_HIDE_DRAFT_API */
+
 
 /** Gets the next count bytes of a sort key. Caller needs
  *  to preserve state array between calls and to provide
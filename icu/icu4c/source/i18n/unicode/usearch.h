@@ -194,12 +194,25 @@ typedef enum {
      */
     USEARCH_ELEMENT_COMPARISON = 2,
 
+#ifndef U_HIDE_DRAFT_API
+    /**
+     * Option to skip ahead over the text with Boyer-Moore-Horspool style
+     * skip tables built from the pattern's collation elements, instead of
+     * trying every position. The matches are the same as without this option;
+     * longer patterns are found faster.
+     * This option has an effect only with USEARCH_STANDARD_ELEMENT_COMPARISON.
+     * The default value will be USEARCH_OFF.
+     * @draft ICU 72
+     */
+    USEARCH_SKIP_TABLE = 3,
+#endif  /* U_HIDE_DRAFT_API */
+
 #ifndef U_HIDE_DEPRECATED_API
     /**
      * One more than the highest normal USearchAttribute value.
      * @deprecated ICU 58 The numeric value may change over time, see ICU ticket #12420.
      */
-    USEARCH_ATTRIBUTE_COUNT = 3
+    USEARCH_ATTRIBUTE_COUNT = 4
 #endif  /* U_HIDE_DEPRECATED_API */
 } USearchAttribute;
 
@@ -213,12 +226,12 @@ typedef enum {
      */
     USEARCH_DEFAULT = -1,
     /**
-     * Value for USEARCH_OVERLAP and USEARCH_CANONICAL_MATCH
+     * Value for USEARCH_OVERLAP, USEARCH_CANONICAL_MATCH and USEARCH_SKIP_TABLE
      * @stable ICU 2.4
      */
     USEARCH_OFF, 
     /**
-     * Value for USEARCH_OVERLAP and USEARCH_CANONICAL_MATCH
+     * Value for USEARCH_OVERLAP, USEARCH_CANONICAL_MATCH and USEARCH_SKIP_TABLE
      * @stable ICU 2.4
      */
     USEARCH_ON,
@@ -569,11 +582,41 @@ U_CAPI void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
                                             int32_t        textlength,
                                             UErrorCode    *status);
 
+#ifndef U_HIDE_DRAFT_API
+/**
+* Set UTF-8 text to be searched, without converting it to UTF-16.
+* Text iteration will hence begin at the start of the text.
+*
+* While the UStringSearch has UTF-8 text, all text offsets, match indexes and
+* match lengths are byte offsets into the UTF-8 text, and usearch_getText()
+* returns NULL. usearch_getMatchedText() returns the matched text as UTF-16,
+* with ill-formed byte sequences replaced by U+FFFD.
+* The search results are the same as for the equivalent UTF-16 text.
+*
+* The UStringSearch retains a pointer to the text string. The caller must not
+* modify or delete the string while using the UStringSearch.
+* Call usearch_setText() to search UTF-16 text again.
+*
+* @param strsrch search iterator data struct
+* @param text new UTF-8 string to look for match
+* @param textlength length of the new string in bytes, -1 for NUL-termination
+* @param status for errors if it occurs. If text is NULL, or textlength is 0
+*               then an U_ILLEGAL_ARGUMENT_ERROR is returned with no change
+*               done to strsrch.
+* @see #usearch_setText
+* @draft ICU 72
+*/
+U_CAPI void U_EXPORT2 usearch_setTextUTF8(      UStringSearch *strsrch,
+                                          const char          *text,
+                                                int32_t        textlength,
+                                                UErrorCode    *status);
+#endif  /* U_HIDE_DRAFT_API */
+
 /**
 * Return the string text to be searched.
 * @param strsrch search iterator data struct
 * @param length returned string text length
-* @return string text 
+* @return string text, or NULL if the text was set with usearch_setTextUTF8()
 * @see #usearch_setText
 * @stable ICU 2.4
 */
@@ -16,10 +16,14 @@
 #include "unicode/usearch.h"
 #include "unicode/ustring.h"
 #include "unicode/uchar.h"
+#include "unicode/utext.h"
 #include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "unicode/coleitr.h"
 #include "normalizer2impl.h"
 #include "usrchimp.h"
 #include "cmemory.h"
+#include "cstring.h"
 #include "ucln_in.h"
 #include "uassert.h"
 #include "ustr_imp.h"
@@ -319,6 +323,43 @@ inline void initializePatternCETable(UStringSearch *strsrch, UErrorCode *status)
     pattern->cesLength = offset;
 }
 
+/**
+* Returns the skip table slot for a processed CE.
+* @param ce processed collation element
+* @return index into the UPattern skip tables
+*/
+static
+inline int32_t getSkipTableIndex(int64_t ce)
+{
+    uint32_t h = (uint32_t)(ce >> 32) ^ (uint32_t)ce;
+    h ^= h >> 16;
+    return (int32_t)((h ^ (h >> 8)) & (SKIP_TABLE_SIZE_ - 1));
+}
+
+/**
+* Builds the Boyer-Moore-Horspool skip tables from the pattern pces.
+* forwardShifts[slot] is how far the pattern may move forward when the text CE
+* aligned with the last pattern CE hashes to slot, backwardShifts[slot] the same
+* for the first pattern CE when searching backwards.
+* Different CEs may share a slot, which then gets the smallest of their shifts.
+* @param pattern pattern with its pces
+*/
+static
+inline void initializeSkipTables(UPattern *pattern)
+{
+    int32_t length = pattern->pcesLength;
+    for (int32_t i = 0; i < SKIP_TABLE_SIZE_; i ++) {
+        pattern->forwardShifts[i]  = length;
+        pattern->backwardShifts[i] = length;
+    }
+    for (int32_t i = 0; i < length - 1; i ++) {
+        pattern->forwardShifts[getSkipTableIndex(pattern->pces[i])] = length - 1 - i;
+    }
+    for (int32_t i = length - 1; i > 0; i --) {
+        pattern->backwardShifts[getSkipTableIndex(pattern->pces[i])] = i;
+    }
+}
+
 /**
 * Initializing the pce table for a pattern.
 * Stores non-ignorable collation keys.
@@ -389,6 +430,7 @@ inline void initializePatternPCETable(UStringSearch *strsrch,
     pcetable[offset]   = 0;
     pattern->pces       = pcetable;
     pattern->pcesLength = offset;
+    initializeSkipTables(pattern);
 }
 
 /**
@@ -445,6 +487,22 @@ inline void initialize(UStringSearch *strsrch, UErrorCode *status)
 }
 
 #if !UCONFIG_NO_BREAK_ITERATION
+// Sets the search text, UTF-16 or UTF-8, on the break iterator.
+// For UTF-8 text, the break iterator boundaries are UTF-8 offsets.
+static void setBreakIteratorText(UBreakIterator *breakiter, const USearch *search,
+                                 UErrorCode *status)
+{
+    if (search->utf8Text != nullptr) {
+        UText ut = UTEXT_INITIALIZER;
+        utext_openUTF8(&ut, search->utf8Text, search->textLength, status);
+        // The break iterator makes a shallow clone of the UText.
+        ubrk_setUText(breakiter, &ut, status);
+        utext_close(&ut);
+    } else {
+        ubrk_setText(breakiter, search->text, search->textLength, status);
+    }
+}
+
 // If the caller provided a character breakiterator we'll return that,
 // otherwise we lazily create the internal break iterator. 
 static UBreakIterator* getBreakIterator(UStringSearch *strsrch, UErrorCode &status)
@@ -464,7 +522,10 @@ static UBreakIterator* getBreakIterator(UStringSearch *strsrch, UErrorCode &stat
     // Need to create the internal break iterator.
     strsrch->search->internalBreakIter = ubrk_open(UBRK_CHARACTER,
         ucol_getLocaleByType(strsrch->collator, ULOC_VALID_LOCALE, &status),
-        strsrch->search->text, strsrch->search->textLength, &status);
+        nullptr, 0, &status);
+    if (U_SUCCESS(status)) {
+        setBreakIteratorText(strsrch->search->internalBreakIter, strsrch->search, &status);
+    }
 
     return strsrch->search->internalBreakIter;
 }
@@ -528,8 +589,14 @@ inline UBool checkIdentical(const UStringSearch *strsrch, int32_t start, int32_t
     // which may not be in FCD it might be faster to just NFD them.
     UErrorCode status = U_ZERO_ERROR;
     UnicodeString t2, p2;
-    strsrch->nfd->normalize(
-        UnicodeString(false, strsrch->search->text + start, end - start), t2, status);
+    if (strsrch->search->utf8Text != nullptr) {
+        strsrch->nfd->normalize(
+            UnicodeString::fromUTF8(StringPiece(strsrch->search->utf8Text + start, end - start)),
+            t2, status);
+    } else {
+        strsrch->nfd->normalize(
+            UnicodeString(false, strsrch->search->text + start, end - start), t2, status);
+    }
     strsrch->nfd->normalize(
         UnicodeString(false, strsrch->pattern.text, strsrch->pattern.textLength), p2, status);
     // return false if NFD failed
@@ -655,6 +722,7 @@ U_CAPI UStringSearch * U_EXPORT2 usearch_openFromCollator(
 
         result->search->text       = text;
         result->search->textLength = textlength;
+        result->search->utf8Text   = nullptr;
 
         result->pattern.text       = pattern;
         result->pattern.textLength = patternlength;
@@ -684,6 +752,7 @@ U_CAPI UStringSearch * U_EXPORT2 usearch_openFromCollator(
         result->search->isOverlap          = false;
         result->search->isCanonicalMatch   = false;
         result->search->elementComparisonType = 0;
+        result->search->useSkipTable       = false;
         result->search->isForwardSearching = true;
         result->search->reset              = true;
 
@@ -802,6 +871,9 @@ U_CAPI void U_EXPORT2 usearch_setAttribute(UStringSearch        *strsrch,
                 strsrch->search->elementComparisonType = 0;
             }
             break;
+        case USEARCH_SKIP_TABLE :
+            strsrch->search->useSkipTable = (value == USEARCH_ON ? true : false);
+            break;
         case USEARCH_ATTRIBUTE_COUNT :
         default:
             *status = U_ILLEGAL_ARGUMENT_ERROR;
@@ -833,6 +905,9 @@ U_CAPI USearchAttributeValue U_EXPORT2 usearch_getAttribute(
                     return USEARCH_STANDARD_ELEMENT_COMPARISON;
                 }
             }
+        case USEARCH_SKIP_TABLE :
+            return (strsrch->search->useSkipTable == true ? USEARCH_ON :
+                                                           USEARCH_OFF);
         case USEARCH_ATTRIBUTE_COUNT :
             return USEARCH_DEFAULT;
         }
@@ -874,6 +949,13 @@ U_CAPI int32_t U_EXPORT2 usearch_getMatchedText(const UStringSearch *strsrch,
     if (resultCapacity < copylength) {
         copylength = resultCapacity;
     }
+    if (strsrch->search->utf8Text != nullptr) {
+        int32_t length16;
+        u_strFromUTF8WithSub(result, resultCapacity, &length16,
+                             strsrch->search->utf8Text + copyindex,
+                             strsrch->search->matchedLength, 0xfffd, nullptr, status);
+        return length16;
+    }
     if (copylength > 0) {
         uprv_memcpy(result, strsrch->search->text + copyindex,
                     copylength * sizeof(UChar));
@@ -900,8 +982,7 @@ U_CAPI void U_EXPORT2 usearch_setBreakIterator(UStringSearch  *strsrch,
     if (U_SUCCESS(*status) && strsrch) {
         strsrch->search->breakIter = breakiter;
         if (breakiter) {
-            ubrk_setText(breakiter, strsrch->search->text,
-                         strsrch->search->textLength, status);
+            setBreakIteratorText(breakiter, strsrch->search, status);
         }
     }
 }
@@ -917,6 +998,23 @@ usearch_getBreakIterator(const UStringSearch *strsrch)
 
 #endif
 
+// Common part of usearch_setText() and usearch_setTextUTF8(),
+// after setting the text fields and the collation element iterator text.
+static void resetForNewText(UStringSearch *strsrch, UErrorCode *status)
+{
+    strsrch->search->matchedIndex  = USEARCH_DONE;
+    strsrch->search->matchedLength = 0;
+    strsrch->search->reset         = true;
+#if !UCONFIG_NO_BREAK_ITERATION
+    if (strsrch->search->breakIter != nullptr) {
+        setBreakIteratorText(strsrch->search->breakIter, strsrch->search, status);
+    }
+    if (strsrch->search->internalBreakIter != nullptr) {
+        setBreakIteratorText(strsrch->search->internalBreakIter, strsrch->search, status);
+    }
+#endif
+}
+
 U_CAPI void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
                                       const UChar         *text,
                                             int32_t        textlength,
@@ -933,19 +1031,33 @@ U_CAPI void U_EXPORT2 usearch_setText(      UStringSearch *strsrch,
             }
             strsrch->search->text       = text;
             strsrch->search->textLength = textlength;
+            strsrch->search->utf8Text   = nullptr;
             ucol_setText(strsrch->textIter, text, textlength, status);
-            strsrch->search->matchedIndex  = USEARCH_DONE;
-            strsrch->search->matchedLength = 0;
-            strsrch->search->reset         = true;
-#if !UCONFIG_NO_BREAK_ITERATION
-            if (strsrch->search->breakIter != nullptr) {
-                ubrk_setText(strsrch->search->breakIter, text,
-                             textlength, status);
-            }
-            if (strsrch->search->internalBreakIter != nullptr) {
-                ubrk_setText(strsrch->search->internalBreakIter, text, textlength, status);
+            resetForNewText(strsrch, status);
+        }
+    }
+}
+
+U_CAPI void U_EXPORT2 usearch_setTextUTF8(      UStringSearch *strsrch,
+                                          const char          *text,
+                                                int32_t        textlength,
+                                                UErrorCode    *status)
+{
+    if (U_SUCCESS(*status)) {
+        if (strsrch == nullptr || text == nullptr || textlength < -1 ||
+            textlength == 0) {
+            *status = U_ILLEGAL_ARGUMENT_ERROR;
+        }
+        else {
+            if (textlength == -1) {
+                textlength = static_cast<int32_t>(uprv_strlen(text));
             }
-#endif
+            strsrch->search->text       = nullptr;
+            strsrch->search->textLength = textlength;
+            strsrch->search->utf8Text   = text;
+            CollationElementIterator::fromUCollationElements(strsrch->textIter)->
+                setUTF8Text(text, textlength, *status);
+            resetForNewText(strsrch, status);
         }
     }
 }
@@ -954,6 +1066,10 @@ U_CAPI const UChar * U_EXPORT2 usearch_getText(const UStringSearch *strsrch,
                                                      int32_t       *length)
 {
     if (strsrch) {
+        if (strsrch->search->utf8Text != nullptr) {
+            *length = 0;
+            return nullptr;
+        }
         *length = strsrch->search->textLength;
         return strsrch->search->text;
     }
@@ -995,10 +1111,19 @@ U_CAPI void U_EXPORT2 usearch_setCollator(      UStringSearch *strsrch,
                                                                 UCOL_SHIFTED;
             // if status is a failure, ucol_getVariableTop returns 0
             strsrch->variableTop = ucol_getVariableTop(collator, status);
-            strsrch->textIter = ucol_openElements(collator,
-                                      strsrch->search->text,
-                                      strsrch->search->textLength,
-                                      status);
+            if (strsrch->search->utf8Text != nullptr) {
+                strsrch->textIter = ucol_openElements(collator, nullptr, 0, status);
+                if (U_SUCCESS(*status)) {
+                    CollationElementIterator::fromUCollationElements(strsrch->textIter)->
+                        setUTF8Text(strsrch->search->utf8Text, strsrch->search->textLength,
+                                    *status);
+                }
+            } else {
+                strsrch->textIter = ucol_openElements(collator,
+                                          strsrch->search->text,
+                                          strsrch->search->textLength,
+                                          status);
+            }
             strsrch->utilIter = ucol_openElements(
                     collator, strsrch->pattern.text, strsrch->pattern.textLength, status);
             // initialize() _after_ setting the iterators for the new collator.
@@ -1177,6 +1302,9 @@ U_CAPI int32_t U_EXPORT2 usearch_next(UStringSearch *strsrch,
                 if (search->matchedIndex == USEARCH_DONE) {
                     search->matchedIndex = offset;
                 }
+                else if (search->utf8Text != nullptr) { // moves by codepoints
+                    U8_FWD_1(search->utf8Text, search->matchedIndex, textlength);
+                }
                 else { // moves by codepoints
                     U16_FWD_1(search->text, search->matchedIndex, textlength);
                 }
@@ -1192,7 +1320,13 @@ U_CAPI int32_t U_EXPORT2 usearch_next(UStringSearch *strsrch,
                 if (search->matchedLength > 0) {
                     // if matchlength is 0 we are at the start of the iteration
                     if (search->isOverlap) {
-                        ucol_setOffset(strsrch->textIter, offset + 1, status);
+                        if (search->utf8Text != nullptr) {
+                            // Do not restart inside the first character of the last match.
+                            U8_FWD_1(search->utf8Text, offset, textlength);
+                        } else {
+                            ++offset;
+                        }
+                        ucol_setOffset(strsrch->textIter, offset, status);
                     }
                     else {
                         ucol_setOffset(strsrch->textIter,
@@ -1279,7 +1413,11 @@ U_CAPI int32_t U_EXPORT2 usearch_previous(UStringSearch *strsrch,
                     // status checked below
                 }
                 else { // move by codepoints
-                    U16_BACK_1(search->text, 0, search->matchedIndex);
+                    if (search->utf8Text != nullptr) {
+                        U8_BACK_1(reinterpret_cast<const uint8_t *>(search->utf8Text), 0, search->matchedIndex);
+                    } else {
+                        U16_BACK_1(search->text, 0, search->matchedIndex);
+                    }
                     setColEIterOffset(strsrch->textIter, search->matchedIndex, *status);
                     // status checked below
                     search->matchedLength = 0;
@@ -1354,14 +1492,20 @@ U_CAPI void U_EXPORT2 usearch_reset(UStringSearch *strsrch)
         if (!sameCollAttribute) {
             initialize(strsrch, &status);
         }
-        ucol_setText(strsrch->textIter, strsrch->search->text,
-                              strsrch->search->textLength,
-                              &status);
+        if (strsrch->search->utf8Text != nullptr) {
+            CollationElementIterator::fromUCollationElements(strsrch->textIter)->
+                setUTF8Text(strsrch->search->utf8Text, strsrch->search->textLength, status);
+        } else {
+            ucol_setText(strsrch->textIter, strsrch->search->text,
+                                  strsrch->search->textLength,
+                                  &status);
+        }
         strsrch->search->matchedLength      = 0;
         strsrch->search->matchedIndex       = USEARCH_DONE;
         strsrch->search->isOverlap          = false;
         strsrch->search->isCanonicalMatch   = false;
         strsrch->search->elementComparisonType = 0;
+        strsrch->search->useSkipTable       = false;
         strsrch->search->isForwardSearching = true;
         strsrch->search->reset              = true;
     }
@@ -1405,6 +1549,8 @@ struct CEIBuffer {
                ~CEIBuffer();
    const CEI   *get(int32_t index);
    const CEI   *getPrevious(int32_t index);
+   int32_t      skipForward(const UPattern &pattern, int32_t targetIx);
+   int32_t      skipBackward(const UPattern &pattern, int32_t targetIx);
 };
 
 
@@ -1537,6 +1683,53 @@ const CEI *CEIBuffer::getPrevious(int32_t index) {
     return &buf[i];
 }
 
+// Boyer-Moore-Horspool over the CEs fetched with get():
+//   Returns the first index no less than targetIx where the target CE that lines up with
+//   the last pattern CE equals that CE, or -1 if there is none before the end of input.
+//   Only the target CEs that line up with the last pattern CE are compared;
+//   the others are still fetched, in sequence.
+//
+int32_t CEIBuffer::skipForward(const UPattern &pattern, int32_t targetIx) {
+    int32_t lastPatIx = pattern.pcesLength - 1;
+    int64_t lastPatCE = pattern.pces[lastPatIx];
+    for (;;) {
+        int32_t index = targetIx + lastPatIx;
+        while (limitIx < index) {
+            get(limitIx);
+        }
+        int64_t ce = get(index)->ce;
+        if (ce == lastPatCE) {
+            return targetIx;
+        }
+        if (ce == UCOL_PROCESSED_NULLORDER) {
+            return -1;
+        }
+        targetIx += pattern.forwardShifts[getSkipTableIndex(ce)];
+    }
+}
+
+// Same as skipForward() for getPrevious() and usearch_searchBackwards(),
+//   where the first pattern CE lines up with the target CE at targetIx + pcesLength - 1.
+//
+int32_t CEIBuffer::skipBackward(const UPattern &pattern, int32_t targetIx) {
+    int32_t lastPatIx = pattern.pcesLength - 1;
+    int64_t firstPatCE = pattern.pces[0];
+    for (;;) {
+        int32_t index = targetIx + lastPatIx;
+        while (limitIx < index) {
+            getPrevious(limitIx);
+        }
+        int64_t ce = getPrevious(index)->ce;
+        if (ce == firstPatCE) {
+            return targetIx;
+        }
+        if (ce == UCOL_PROCESSED_NULLORDER) {
+            return -1;
+        }
+        targetIx += pattern.backwardShifts[getSkipTableIndex(ce)];
+    }
+}
+
 }
 
 U_NAMESPACE_END
@@ -1749,7 +1942,11 @@ namespace {
 UChar32 codePointAt(const USearch &search, int32_t index) {
     if (index < search.textLength) {
         UChar32 c;
-        U16_NEXT(search.text, index, search.textLength, c);
+        if (search.utf8Text != nullptr) {
+            U8_NEXT_OR_FFFD(search.utf8Text, index, search.textLength, c);
+        } else {
+            U16_NEXT(search.text, index, search.textLength, c);
+        }
         return c;
     }
     return U_SENTINEL;
@@ -1758,7 +1955,11 @@ UChar32 codePointAt(const USearch &search, int32_t index) {
 UChar32 codePointBefore(const USearch &search, int32_t index) {
     if (0 < index) {
         UChar32 c;
-        U16_PREV(search.text, 0, index, c);
+        if (search.utf8Text != nullptr) {
+            U8_PREV_OR_FFFD(reinterpret_cast<const uint8_t *>(search.utf8Text), 0, index, c);
+        } else {
+            U16_PREV(search.text, 0, index, c);
+        }
         return c;
     }
     return U_SENTINEL;
@@ -1822,6 +2023,12 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     int32_t  minLimit;
     int32_t  maxLimit;
 
+    // The skip tables are only valid for exact CE comparison,
+    // and a one-CE pattern cannot skip anything.
+    UBool    useSkipTable = strsrch->search->useSkipTable &&
+                            strsrch->search->elementComparisonType == 0 &&
+                            strsrch->pattern.pcesLength > 1;
+
 
 
     // Outer loop moves over match starting positions in the
@@ -1841,6 +2048,16 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
     for(targetIx=0; ; targetIx++)
     {
         found = true;
+        if (useSkipTable) {
+            // Move on to the next position where the last pattern CE matches.
+            // The positions skipped over cannot match in CE space.
+            targetIx = ceb.skipForward(strsrch->pattern, targetIx);
+            if (targetIx < 0) {
+                // No match at all, we have run off the end of the target text.
+                found = false;
+                break;
+            }
+        }
         //  Inner loop checks for a match beginning at each
         //  position from the outer loop.
         int32_t targetIxOffset = 0;
@@ -1979,7 +2196,8 @@ U_CAPI UBool U_EXPORT2 usearch_search(UStringSearch  *strsrch,
         //   tests in any case)
         // * the match limit is a normalization boundary
         UBool allowMidclusterMatch = false;
-        if (strsrch->search->text != nullptr && strsrch->search->textLength > maxLimit) {
+        if ((strsrch->search->text != nullptr || strsrch->search->utf8Text != nullptr) &&
+                strsrch->search->textLength > maxLimit) {
             allowMidclusterMatch =
                     strsrch->search->breakIter == nullptr &&
                     nextCEI != nullptr && (((nextCEI->ce) >> 32) & 0xFFFF0000UL) != 0 &&
@@ -2168,6 +2386,11 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
     int32_t  minLimit;
     int32_t  maxLimit;
 
+    // Same as in usearch_search().
+    UBool    useSkipTable = strsrch->search->useSkipTable &&
+                            strsrch->search->elementComparisonType == 0 &&
+                            strsrch->pattern.pcesLength > 1;
+
 
 
     // Outer loop moves over match starting positions in the
@@ -2179,6 +2402,14 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
     for(targetIx = limitIx; ; targetIx += 1)
     {
         found = true;
+        if (useSkipTable) {
+            // Move on to the next position where the first pattern CE matches.
+            targetIx = ceb.skipBackward(strsrch->pattern, targetIx);
+            if (targetIx < 0) {
+                found = false;
+                break;
+            }
+        }
         // For targetIx > limitIx, this ceb.getPrevious gets a CE that is as far back in the ring buffer
         // (compared to the last CE fetched for the previous targetIx value) as we need to go
         // for this targetIx value, so if it is non-nullptr then other ceb.getPrevious calls should be OK.
@@ -2284,7 +2515,8 @@ U_CAPI UBool U_EXPORT2 usearch_searchBackwards(UStringSearch  *strsrch,
             //   tests in any case)
             // * the match limit is a normalization boundary
             UBool allowMidclusterMatch = false;
-            if (strsrch->search->text != nullptr && strsrch->search->textLength > maxLimit) {
+            if ((strsrch->search->text != nullptr || strsrch->search->utf8Text != nullptr) &&
+                    strsrch->search->textLength > maxLimit) {
                 allowMidclusterMatch =
                         strsrch->search->breakIter == nullptr &&
                         nextCEI != nullptr && (((nextCEI->ce) >> 32) & 0xFFFF0000UL) != 0 &&
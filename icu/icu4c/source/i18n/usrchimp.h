@@ -127,14 +127,20 @@ class UCollationPCE : public UMemory {
 U_NAMESPACE_END
 
 #define INITIAL_ARRAY_SIZE_       256
+// number of slots in the hashed skip tables; must be a power of 2
+#define SKIP_TABLE_SIZE_          256
 
 struct USearch {
     // required since collation element iterator does not have a getText API
     const UChar              *text;
           int32_t             textLength; // exact length
+    // UTF-8 text from usearch_setTextUTF8(), or nullptr.
+    // If set, then text is nullptr, and textLength and all offsets count bytes.
+    const char               *utf8Text;
           UBool               isOverlap;
           UBool               isCanonicalMatch;
           int16_t             elementComparisonType;
+          UBool               useSkipTable;
           UBreakIterator     *internalBreakIter;  // internal character breakiterator, lazily created.
           UBreakIterator     *breakIter;          // caller provided character breakiterator
     // value USEARCH_DONE is the default value
@@ -159,6 +165,10 @@ struct UPattern {
           int64_t             pcesBuffer[INITIAL_ARRAY_SIZE_];
           UBool               hasPrefixAccents;
           UBool               hasSuffixAccents;
+          // Boyer-Moore-Horspool shifts indexed by hashed processed CE,
+          // for USEARCH_SKIP_TABLE; built together with pces.
+          int32_t             forwardShifts[SKIP_TABLE_SIZE_];
+          int32_t             backwardShifts[SKIP_TABLE_SIZE_];
 };
 
 struct UStringSearch {
@@ -95,6 +95,14 @@ class U_I18N_API FCDUTF16CollationIterator : public UTF16CollationIterator {
 
     virtual ~FCDUTF16CollationIterator();
 
+    void setText(const UChar *s, const UChar *lim) {
+        UTF16CollationIterator::setText(s, lim);
+        rawStart = segmentStart = s;
+        segmentLimit = NULL;
+        rawLimit = lim;
+        checkDir = 1;
+    }
+
     virtual bool operator==(const CollationIterator &other) const override;
 
     virtual void resetToOffset(int32_t newOffset) override;
@@ -38,8 +38,15 @@ class U_I18N_API UTF8CollationIterator : public CollationIterator {
             : CollationIterator(d, numeric),
               u8(s), pos(p), length(len) {}
 
+    /** The copy shares the text with the original. */
+    UTF8CollationIterator(const UTF8CollationIterator &other)
+            : CollationIterator(other),
+              u8(other.u8), pos(other.pos), length(other.length) {}
+
     virtual ~UTF8CollationIterator();
 
+    virtual bool operator==(const CollationIterator &other) const override;
+
     virtual void resetToOffset(int32_t newOffset) override;
 
     virtual int32_t getOffset() const override;
@@ -85,8 +92,16 @@ class U_I18N_API FCDUTF8CollationIterator : public UTF8CollationIterator {
               state(CHECK_FWD), start(p),
               nfcImpl(data->nfcImpl) {}
 
+    /** The copy shares the text with the original. */
+    FCDUTF8CollationIterator(const FCDUTF8CollationIterator &other)
+            : UTF8CollationIterator(other),
+              state(other.state), start(other.start), limit(other.limit),
+              nfcImpl(other.nfcImpl), normalized(other.normalized) {}
+
     virtual ~FCDUTF8CollationIterator();
 
+    virtual bool operator==(const CollationIterator &other) const override;
+
     virtual void resetToOffset(int32_t newOffset) override;
 
     virtual int32_t getOffset() const override;
@@ -35,6 +35,7 @@
 #include "cmemory.h"
 #include "cstring.h"
 #include "ucol_imp.h"
+#include "ustr_imp.h"
 
 static void TestAttribute(void);
 static void TestDefault(void);
@@ -93,6 +94,10 @@ void addCollAPITest(TestNode** root)
     addTest(root, &TestGetKeywordValuesForLocale, "tscoll/capitst/TestGetKeywordValuesForLocale");
     addTest(root, &TestStrcollNull, "tscoll/capitst/TestStrcollNull");
     addTest(root, &TestLocaleIDWithUnderscoreAndExtension, "tscoll/capitst/TestLocaleIDWithUnderscoreAndExtension");
+    addTest(root, &TestGetSortKeys, "tscoll/capitst/TestGetSortKeys");
+    addTest(root, &TestGetCompactSortKey, "tscoll/capitst/TestGetCompactSortKey");
+    addTest(root, &TestSortStrings, "tscoll/capitst/TestSortStrings");
+    addTest(root, &TestOpenRulesWithCache, "tscoll/capitst/TestOpenRulesWithCache");
 }
 
 void TestGetSetAttr(void) {
@@ -2700,4 +2705,346 @@ static void TestLocaleIDWithUnderscoreAndExtension(void) {
     ucol_close(c2);
 }
 
+static void TestGetSortKeys(void) {
+    static const UChar *const sources[] = {
+        u"abc", u"", u"\u00C4rger", u"a\u0308rger", u"\u00E4rger", u"x\U0001D15E\u0327\u0301y", u"12 apples"
+    };
+    static const int32_t lengths[] = { 3, 0, -1, 6, -1, -1, 9 };
+    const int32_t count = UPRV_LENGTHOF(sources);
+    static const UColAttributeValue strengths[] = { UCOL_PRIMARY, UCOL_TERTIARY, UCOL_IDENTICAL };
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("de", &status);
+    uint8_t keys[1000];
+    int32_t offsets[UPRV_LENGTHOF(sources) + 1];
+    int32_t s, i;
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(de) failed: %s\n", myErrorName(status));
+        return;
+    }
+    ucol_setAttribute(coll, UCOL_NUMERIC_COLLATION, UCOL_ON, &status);
+    for (s = 0; s < UPRV_LENGTHOF(strengths); ++s) {
+        int32_t totalLength, preflightLength;
+        ucol_setStrength(coll, strengths[s]);
+        totalLength = ucol_getSortKeys(coll, sources, lengths, count,
+                                       keys, UPRV_LENGTHOF(keys), offsets, &status);
+        if (!assertSuccess("ucol_getSortKeys", &status)) {
+            break;
+        }
+        assertIntEquals("ucol_getSortKeys total length", totalLength, offsets[count]);
+        for (i = 0; i < count; ++i) {
+            uint8_t key[200];
+            int32_t keyLength = ucol_getSortKey(coll, sources[i], lengths[i], key, UPRV_LENGTHOF(key));
+            if (keyLength != offsets[i + 1] - offsets[i] ||
+                    uprv_memcmp(key, keys + offsets[i], keyLength) != 0) {
+                log_err("ucol_getSortKeys() key %d at strength %d differs from ucol_getSortKey()\n",
+                        (int)i, (int)strengths[s]);
+            }
+        }
+
+        /* preflighting */
+        preflightLength = ucol_getSortKeys(coll, sources, lengths, count, NULL, 0, offsets, &status);
+        assertIntEquals("preflight status", U_BUFFER_OVERFLOW_ERROR, status);
+        assertIntEquals("preflight length", totalLength, preflightLength);
+        status = U_ZERO_ERROR;
+        preflightLength = ucol_getSortKeys(coll, sources, lengths, count, keys, 5, offsets, &status);
+        assertIntEquals("short buffer status", U_BUFFER_OVERFLOW_ERROR, status);
+        assertIntEquals("short buffer length", totalLength, preflightLength);
+        status = U_ZERO_ERROR;
+    }
+
+    /* All NUL-terminated. */
+    ucol_setStrength(coll, UCOL_TERTIARY);
+    if (ucol_getSortKeys(coll, sources, NULL, count, keys, UPRV_LENGTHOF(keys), offsets, &status) !=
+            ucol_getSortKeys(coll, sources, lengths, count, keys, UPRV_LENGTHOF(keys), offsets, &status)) {
+        log_err("ucol_getSortKeys(sourceLengths=NULL) differs from explicit lengths\n");
+    }
+    assertSuccess("ucol_getSortKeys(sourceLengths=NULL)", &status);
+
+    ucol_getSortKeys(coll, sources, lengths, count, keys, UPRV_LENGTHOF(keys), NULL, &status);
+    assertIntEquals("offsets=NULL", U_ILLEGAL_ARGUMENT_ERROR, status);
+    ucol_close(coll);
+}
+
+static int32_t compareCompactKeys(const uint8_t *left, int32_t leftLength,
+                                  const uint8_t *right, int32_t rightLength) {
+    int32_t result = uprv_memcmp(left, right, leftLength < rightLength ? leftLength : rightLength);
+    if (result == 0) {
+        result = leftLength - rightLength;
+    }
+    return result < 0 ? -1 : result > 0 ? 1 : 0;
+}
+
+static void TestGetCompactSortKey(void) {
+    static const UChar *const sources[] = {
+        u"", u"a", u"ab", u"abc", u"Abc", u"ABC", u"\u00E0bc", u"abc\u0301", u"\u0301",
+        u"a b", u"a-b", u"ab-", u"a\u00ADb", u"\u017Fs", u"ss", u"\u00DF", u"co-op", u"coop",
+        u"\u03B1\u03B2\u03B3", u"\u0391\u03B2\u03B3", u"\u0430\u0431", u"\u0439\u0430",
+        u"a1", u"a01", u"a\uFFFEb", u"\uFF41b", u"\u24D0b"
+    };
+    static const struct {
+        UColAttribute attr;
+        UColAttributeValue value;
+    } options[] = {
+        { UCOL_STRENGTH, UCOL_TERTIARY },
+        { UCOL_STRENGTH, UCOL_PRIMARY },
+        { UCOL_STRENGTH, UCOL_SECONDARY },
+        { UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED },
+        { UCOL_STRENGTH, UCOL_TERTIARY },
+        { UCOL_CASE_FIRST, UCOL_LOWER_FIRST },
+        { UCOL_CASE_FIRST, UCOL_UPPER_FIRST },
+        { UCOL_CASE_LEVEL, UCOL_ON },
+        { UCOL_CASE_LEVEL, UCOL_OFF },
+        { UCOL_FRENCH_COLLATION, UCOL_ON },
+        { UCOL_STRENGTH, UCOL_QUATERNARY },
+        { UCOL_STRENGTH, UCOL_IDENTICAL }
+    };
+    const int32_t count = UPRV_LENGTHOF(sources);
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("en", &status);
+    uint8_t keys[UPRV_LENGTHOF(sources)][200];
+    int32_t lengths[UPRV_LENGTHOF(sources)];
+    int32_t o, i, j;
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(en) failed: %s\n", myErrorName(status));
+        return;
+    }
+    for (o = 0; o < UPRV_LENGTHOF(options); ++o) {
+        ucol_setAttribute(coll, options[o].attr, options[o].value, &status);
+        for (i = 0; i < count; ++i) {
+            lengths[i] = ucol_getCompactSortKey(coll, sources[i], -1,
+                                                keys[i], UPRV_LENGTHOF(keys[i]), &status);
+        }
+        if (!assertSuccess("ucol_getCompactSortKey", &status)) {
+            break;
+        }
+        for (i = 0; i < count; ++i) {
+            for (j = 0; j < count; ++j) {
+                int32_t expected = ucol_strcoll(coll, sources[i], -1, sources[j], -1);
+                int32_t actual = compareCompactKeys(keys[i], lengths[i], keys[j], lengths[j]);
+                if (actual != expected) {
+                    log_err("compact key order %d != ucol_strcoll() %d for strings %d and %d "
+                            "after option %d\n", (int)actual, (int)expected, (int)i, (int)j, (int)o);
+                }
+            }
+        }
+    }
+
+    /* Lowercase text without accents needs only the primary level and one byte. */
+    ucol_setAttribute(coll, UCOL_STRENGTH, UCOL_TERTIARY, &status);
+    ucol_setAttribute(coll, UCOL_ALTERNATE_HANDLING, UCOL_NON_IGNORABLE, &status);
+    ucol_setAttribute(coll, UCOL_CASE_FIRST, UCOL_OFF, &status);
+    ucol_setAttribute(coll, UCOL_FRENCH_COLLATION, UCOL_OFF, &status);
+    {
+        uint8_t key[200];
+        int32_t keyLength = ucol_getSortKey(coll, u"abc", -1, key, UPRV_LENGTHOF(key));
+        int32_t compactLength = ucol_getCompactSortKey(coll, u"abc", -1, keys[0], 200, &status);
+        assertSuccess("ucol_getCompactSortKey(abc)", &status);
+        assertTrue("compact key is shorter", compactLength < keyLength);
+        assertIntEquals("compact key ends after the primary level separator", 1, keys[0][compactLength - 1]);
+
+        /* preflighting */
+        assertIntEquals("preflight length", compactLength,
+                        ucol_getCompactSortKey(coll, u"abc", 3, NULL, 0, &status));
+        assertIntEquals("preflight status", U_BUFFER_OVERFLOW_ERROR, status);
+        status = U_ZERO_ERROR;
+        assertIntEquals("short buffer length", compactLength,
+                        ucol_getCompactSortKey(coll, u"abc", 3, key, 2, &status));
+        assertIntEquals("short buffer status", U_BUFFER_OVERFLOW_ERROR, status);
+        status = U_ZERO_ERROR;
+        ucol_getCompactSortKey(coll, NULL, 3, key, UPRV_LENGTHOF(key), &status);
+        assertIntEquals("NULL source", U_ILLEGAL_ARGUMENT_ERROR, status);
+    }
+    ucol_close(coll);
+}
+
+static void TestSortStrings(void) {
+    enum { COUNT = 5000 };
+    static const UChar *const words[] = {
+        u"cote", u"cot\u00E9", u"c\u00F4te", u"c\u00F4t\u00E9", u"Cote", u"co-op", u"coop",
+        u"\u00C4rger", u"\u00E4rger", u"a\u0308rger", u"\u0421\u0435\u0440\u0433\u0435\u0439",
+        u"\u4E00", u"x\U0001D15E", u"12", u"9", u""
+    };
+    static const int32_t threadCounts[] = { 1, 3, 0 };
+    UErrorCode status = U_ZERO_ERROR;
+    UCollator *coll = ucol_open("fr", &status);
+    const UChar **strings = NULL;
+    char **strings8 = NULL;
+    UChar *text = NULL;
+    char *text8 = NULL;
+    int32_t *order = NULL;
+    int32_t *order8 = NULL;
+    int32_t i, t;
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_open(fr) failed: %s\n", myErrorName(status));
+        return;
+    }
+    /* Each string is a word plus a number suffix, with many duplicates. */
+    strings = (const UChar **)uprv_malloc(COUNT * sizeof(UChar *));
+    strings8 = (char **)uprv_malloc(COUNT * sizeof(char *));
+    text = (UChar *)uprv_malloc(COUNT * 20 * sizeof(UChar));
+    text8 = (char *)uprv_malloc(COUNT * 40);
+    order = (int32_t *)uprv_malloc(COUNT * sizeof(int32_t));
+    order8 = (int32_t *)uprv_malloc(COUNT * sizeof(int32_t));
+    if (strings == NULL || strings8 == NULL || text == NULL || text8 == NULL ||
+            order == NULL || order8 == NULL) {
+        log_err("out of memory\n");
+        goto cleanup;
+    }
+    for (i = 0; i < COUNT; ++i) {
+        UChar *s = text + i * 20;
+        int32_t length;
+        u_strcpy(s, words[i % UPRV_LENGTHOF(words)]);
+        length = u_strlen(s);
+        s[length++] = (UChar)(u'0' + (i * 7) % 3);
+        s[length] = 0;
+        strings[i] = s;
+        strings8[i] = text8 + i * 40;
+        u_strToUTF8(strings8[i], 40, NULL, s, -1, &status);
+    }
+    if (!assertSuccess("u_strToUTF8", &status)) {
+        goto cleanup;
+    }
+    for (t = 0; t < UPRV_LENGTHOF(threadCounts); ++t) {
+        ucol_sortStrings(coll, strings, NULL, COUNT, order, threadCounts[t], &status);
+        ucol_sortStringsUTF8(coll, (const char *const *)strings8, NULL, COUNT, order8,
+                             threadCounts[t], &status);
+        if (!assertSuccess("ucol_sortStrings", &status)) {
+            break;
+        }
+        for (i = 0; i < COUNT; ++i) {
+            if (order[i] != order8[i]) {
+                log_err("ucol_sortStringsUTF8() order[%d] differs from ucol_sortStrings() "
+                        "with %d threads\n", (int)i, (int)threadCounts[t]);
+                break;
+            }
+        }
+        for (i = 1; i < COUNT; ++i) {
+            UCollationResult result = ucol_strcoll(coll, strings[order[i - 1]], -1,
+                                                   strings[order[i]], -1);
+            if (result == UCOL_GREATER || (result == UCOL_EQUAL && order[i - 1] > order[i])) {
+                log_err("ucol_sortStrings() with %d threads: order[%d]=%d and order[%d]=%d "
+                        "are out of order\n", (int)threadCounts[t],
+                        (int)(i - 1), (int)order[i - 1], (int)i, (int)order[i]);
+                break;
+            }
+        }
+    }
+
+    ucol_sortStrings(coll, strings, NULL, COUNT, NULL, 1, &status);
+    assertIntEquals("order=NULL", U_ILLEGAL_ARGUMENT_ERROR, status);
+
+cleanup:
+    uprv_free(strings);
+    uprv_free(strings8);
+    uprv_free(text);
+    uprv_free(text8);
+    uprv_free(order);
+    uprv_free(order8);
+    ucol_close(coll);
+}
+
+static void TestOpenRulesWithCache(void) {
+    static const UChar rules[] = u"&a<<<\u00E4<b &c<ch &[before 1]d<\u0111 [caseFirst upper]";
+    static const UChar badRules[] = u"&a<";
+    static const UChar *const words[] = {
+        u"a", u"A", u"\u00E4", u"b", u"c", u"ch", u"cx", u"d", u"\u0111", u"cz", u"ab", u"\u00C4b"
+    };
+    const char *cacheDir = ctest_dataOutDir();
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parseError;
+    UCollator *expected = ucol_openRules(rules, -1, UCOL_DEFAULT, UCOL_PRIMARY, NULL, &status);
+    char path[1000];
+    FILE *file;
+    int32_t pass, i, j, fileLength;
+    if (U_FAILURE(status)) {
+        log_err_status(status, "ucol_openRules() failed: %s\n", myErrorName(status));
+        return;
+    }
+    /* The first pass may build the tailoring and write the cache file, the second one reads it. */
+    for (pass = 0; pass < 3; ++pass) {
+        UCollator *coll = ucol_openRulesWithCache(rules, -1, UCOL_DEFAULT, UCOL_PRIMARY,
+                                                  pass < 2 ? cacheDir : NULL, &parseError, &status);
+        int32_t rulesLength;
+        const UChar *collRules;
+        if (!assertSuccess("ucol_openRulesWithCache", &status)) {
+            break;
+        }
+        assertIntEquals("parseError.offset", -1, parseError.offset);
+        collRules = ucol_getRules(coll, &rulesLength);
+        if (rulesLength != u_strlen(rules) || u_memcmp(collRules, rules, rulesLength) != 0) {
+            log_err("pass %d: ucol_getRules() differs from the rules\n", (int)pass);
+        }
+        assertIntEquals("strength", UCOL_PRIMARY, ucol_getStrength(coll));
+        for (i = 0; i < UPRV_LENGTHOF(words); ++i) {
+            for (j = 0; j < UPRV_LENGTHOF(words); ++j) {
+                UCollationResult result = ucol_strcoll(coll, words[i], -1, words[j], -1);
+                if (result != ucol_strcoll(expected, words[i], -1, words[j], -1)) {
+                    log_err("pass %d: ucol_strcoll(words[%d], words[%d]) differs from "
+                            "the ucol_openRules() collator\n", (int)pass, (int)i, (int)j);
+                }
+            }
+        }
+        ucol_close(coll);
+    }
+
+    /* A truncated cache file is not read beyond its end, and the tailoring is built again. */
+    sprintf(path, "%sucol" U_ICU_VERSION_SHORT "_%08x.col",
+            cacheDir, (unsigned int)ustr_hashUCharsN(rules, u_strlen(rules)));
+    file = fopen(path, "rb");
+    if (file == NULL) {
+        log_err("unable to read the cache file %s\n", path);
+    } else {
+        int32_t truncatedLengths[5];
+        char *contents;
+        fseek(file, 0, SEEK_END);
+        fileLength = (int32_t)ftell(file);
+        fseek(file, 0, SEEK_SET);
+        contents = (char *)uprv_malloc(fileLength);
+        if (contents == NULL || (int32_t)fread(contents, 1, fileLength, file) != fileLength) {
+            log_err("unable to read the cache file %s\n", path);
+            fileLength = 0;
+        }
+        fclose(file);
+        truncatedLengths[0] = 4;  /* inside the indexes */
+        truncatedLengths[1] = 32 + 2;  /* inside the rules */
+        truncatedLengths[2] = fileLength / 2;  /* inside the tailoring */
+        truncatedLengths[3] = fileLength - 1;
+        truncatedLengths[4] = fileLength;  /* complete again */
+        for (i = 0; fileLength > 0 && i < UPRV_LENGTHOF(truncatedLengths); ++i) {
+            UCollator *coll;
+            file = fopen(path, "wb");
+            if (file == NULL ||
+                    (int32_t)fwrite(contents, 1, truncatedLengths[i], file) != truncatedLengths[i]) {
+                log_err("unable to write the cache file %s\n", path);
+            }
+            if (file != NULL) {
+                fclose(file);
+            }
+            coll = ucol_openRulesWithCache(rules, -1, UCOL_DEFAULT, UCOL_PRIMARY,
+                                           cacheDir, &parseError, &status);
+            if (!assertSuccess("ucol_openRulesWithCache(truncated cache file)", &status)) {
+                break;
+            }
+            for (j = 1; j < UPRV_LENGTHOF(words); ++j) {
+                if (ucol_strcoll(coll, words[j - 1], -1, words[j], -1) !=
+                        ucol_strcoll(expected, words[j - 1], -1, words[j], -1)) {
+                    log_err("cache file truncated to %d bytes: ucol_strcoll(words[%d], words[%d]) "
+                            "differs from the ucol_openRules() collator\n",
+                            (int)truncatedLengths[i], (int)(j - 1), (int)j);
+                }
+            }
+            ucol_close(coll);
+        }
+        uprv_free(contents);
+    }
+
+    /* Rule syntax errors are reported as with ucol_openRules(). */
+    status = U_ZERO_ERROR;
+    ucol_close(ucol_openRulesWithCache(badRules, -1, UCOL_DEFAULT, UCOL_DEFAULT,
+                                       cacheDir, &parseError, &status));
+    assertIntEquals("bad rules", U_INVALID_FORMAT_ERROR, status);
+    assertIntEquals("bad rules parseError.offset", 2, parseError.offset);
+    ucol_close(expected);
+}
+
 #endif /* #if !UCONFIG_NO_COLLATION */
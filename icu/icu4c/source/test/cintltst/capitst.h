@@ -147,6 +147,26 @@
      */
     static void TestLocaleIDWithUnderscoreAndExtension(void);
 
+    /**
+     * Test ucol_getSortKeys() against ucol_getSortKey()
+     */
+    static void TestGetSortKeys(void);
+
+    /**
+     * Test that ucol_getCompactSortKey() keys compare like ucol_strcoll()
+     */
+    static void TestGetCompactSortKey(void);
+
+    /**
+     * Test ucol_sortStrings() and ucol_sortStringsUTF8() on several threads
+     */
+    static void TestSortStrings(void);
+
+    /**
+     * Test that ucol_openRulesWithCache() collators match ucol_openRules() ones
+     */
+    static void TestOpenRulesWithCache(void);
+
 #endif /* #if !UCONFIG_NO_COLLATION */
 
 #endif
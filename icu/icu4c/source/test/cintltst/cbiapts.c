@@ -25,16 +25,19 @@
 #if !UCONFIG_NO_BREAK_ITERATION
 
 #include <stdbool.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include "unicode/uloc.h"
 #include "unicode/ubrk.h"
+#include "unicode/ugrapheme.h"
 #include "unicode/ustring.h"
 #include "unicode/ucnv.h"
 #include "unicode/utext.h"
 #include "cintltst.h"
 #include "cbiapts.h"
 #include "cmemory.h"
+#include "ustr_imp.h"
 
 #define TEST_ASSERT_SUCCESS(status) UPRV_BLOCK_MACRO_BEGIN { \
     if (U_FAILURE(status)) { \
@@ -60,6 +63,11 @@ static void TestBreakIteratorTailoring(void);
 static void TestBreakIteratorRefresh(void);
 static void TestBug11665(void);
 static void TestBreakIteratorSuppressions(void);
+static void TestBreakIteratorGetBoundaries(void);
+static void TestBreakIteratorGetAllBoundaries(void);
+static void TestBreakIteratorUpdateBoundaries(void);
+static void TestBreakIteratorRulesWithCache(void);
+static void TestGraphemeClusters(void);
 
 void addBrkIterAPITest(TestNode** root);
 
@@ -77,6 +85,11 @@ void addBrkIterAPITest(TestNode** root)
     addTest(root, &TestBreakIteratorTailoring, "tstxtbd/cbiapts/TestBreakIteratorTailoring");
     addTest(root, &TestBreakIteratorRefresh, "tstxtbd/cbiapts/TestBreakIteratorRefresh");
     addTest(root, &TestBug11665, "tstxtbd/cbiapts/TestBug11665");
+    addTest(root, &TestBreakIteratorGetBoundaries, "tstxtbd/cbiapts/TestBreakIteratorGetBoundaries");
+    addTest(root, &TestBreakIteratorGetAllBoundaries, "tstxtbd/cbiapts/TestBreakIteratorGetAllBoundaries");
+    addTest(root, &TestBreakIteratorUpdateBoundaries, "tstxtbd/cbiapts/TestBreakIteratorUpdateBoundaries");
+    addTest(root, &TestBreakIteratorRulesWithCache, "tstxtbd/cbiapts/TestBreakIteratorRulesWithCache");
+    addTest(root, &TestGraphemeClusters, "tstxtbd/cbiapts/TestGraphemeClusters");
 #if !UCONFIG_NO_FILTERED_BREAK_ITERATION
     addTest(root, &TestBreakIteratorSuppressions, "tstxtbd/cbiapts/TestBreakIteratorSuppressions");
 #endif
@@ -1026,6 +1039,312 @@ static void TestBreakIteratorRefresh(void) {
 }
 
 
+/*
+ *  TestBreakIteratorGetBoundaries()   Test ubrk_getBoundaries() against ubrk_next().
+ */
+static void TestBreakIteratorGetBoundaries(void) {
+    static const UChar testStr[] = u"Hello, world! 32.3 feet? \u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07 end.";
+    UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *bi;
+    int32_t expected[50];
+    int32_t expectedStatuses[50];
+    int32_t expectedLength = 0;
+    int32_t boundaries[50];
+    int32_t statuses[50];
+    int32_t index = 0;
+    int32_t length;
+    int32_t pos;
+
+    bi = ubrk_open(UBRK_WORD, "en_US", testStr, -1, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("FAIL : in ubrk_open() - %s\n", u_errorName(status));
+        return;
+    }
+    for (pos = ubrk_next(bi); pos != UBRK_DONE; pos = ubrk_next(bi)) {
+        expected[expectedLength] = pos;
+        expectedStatuses[expectedLength++] = ubrk_getRuleStatus(bi);
+    }
+
+    ubrk_first(bi);
+    while ((length = ubrk_getBoundaries(bi, boundaries, statuses, 3, &status)) > 0) {
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(length <= 3 && index + length <= expectedLength);
+        if (index + length > expectedLength) {
+            break;
+        }
+        for (pos = 0; pos < length; ++pos, ++index) {
+            TEST_ASSERT(boundaries[pos] == expected[index]);
+            TEST_ASSERT(statuses[pos] == expectedStatuses[index]);
+        }
+        TEST_ASSERT(ubrk_current(bi) == boundaries[length - 1]);
+    }
+    TEST_ASSERT(index == expectedLength);
+
+    ubrk_first(bi);
+    length = ubrk_getBoundaries(bi, boundaries, NULL, UPRV_LENGTHOF(boundaries), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(length == expectedLength);
+    TEST_ASSERT(memcmp(boundaries, expected, length * 4) == 0);
+    TEST_ASSERT(ubrk_next(bi) == UBRK_DONE);
+
+    ubrk_getBoundaries(bi, NULL, NULL, 1, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    ubrk_close(bi);
+}
+
+
+/*
+ *  TestBreakIteratorGetAllBoundaries()   Test ubrk_getAllBoundaries() against ubrk_next().
+ */
+static void TestBreakIteratorGetAllBoundaries(void) {
+    static const UChar sentence[] = u"The quick brown fox, \u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07, 32.3 feet. ";
+    enum { TEXT_LENGTH = 40000 };
+    UChar *text = (UChar *)malloc(TEXT_LENGTH * sizeof(UChar));
+    int32_t *expected = (int32_t *)malloc(TEXT_LENGTH * sizeof(int32_t));
+    int32_t *boundaries = (int32_t *)malloc(TEXT_LENGTH * sizeof(int32_t));
+    UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *bi;
+    UText *ut;
+    int32_t expectedLength = 0;
+    int32_t length;
+    int32_t pos;
+
+    for (pos = 0; pos < TEXT_LENGTH; ++pos) {
+        text[pos] = sentence[pos % (UPRV_LENGTHOF(sentence) - 1)];
+    }
+    bi = ubrk_open(UBRK_WORD, "en_US", text, TEXT_LENGTH, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("FAIL : in ubrk_open() - %s\n", u_errorName(status));
+        free(text);
+        free(expected);
+        free(boundaries);
+        return;
+    }
+    for (pos = ubrk_next(bi); pos != UBRK_DONE; pos = ubrk_next(bi)) {
+        expected[expectedLength++] = pos;
+    }
+
+    ut = utext_openUChars(NULL, text, TEXT_LENGTH, &status);
+    TEST_ASSERT_SUCCESS(status);
+    length = ubrk_getAllBoundaries(bi, ut, boundaries, NULL, TEXT_LENGTH, 2, &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(length == expectedLength);
+    TEST_ASSERT(memcmp(boundaries, expected, expectedLength * 4) == 0);
+
+    length = ubrk_getAllBoundaries(bi, ut, NULL, NULL, 0, 2, &status);
+    TEST_ASSERT(status == U_BUFFER_OVERFLOW_ERROR);
+    TEST_ASSERT(length == expectedLength);
+
+    utext_close(ut);
+    ubrk_close(bi);
+    free(text);
+    free(expected);
+    free(boundaries);
+}
+
+
+/*
+ *  TestBreakIteratorUpdateBoundaries()   Test ubrk_updateBoundaries() against ubrk_next().
+ */
+static void TestBreakIteratorUpdateBoundaries(void) {
+    static const UChar oldText[] = u"The quick brown fox, \u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07 jumps.";
+    static const UChar newText[] = u"The slow brown fox, \u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07 jumps.";
+    int32_t boundaries[30];
+    int32_t statuses[30];
+    int32_t expected[30];
+    int32_t expectedStatuses[30];
+    UErrorCode status = U_ZERO_ERROR;
+    UBreakIterator *bi;
+    int32_t expectedLength = 0;
+    int32_t length;
+    int32_t pos;
+
+    bi = ubrk_open(UBRK_WORD, "en_US", newText, -1, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("FAIL : in ubrk_open() - %s\n", u_errorName(status));
+        return;
+    }
+    for (pos = ubrk_next(bi); pos != UBRK_DONE; pos = ubrk_next(bi)) {
+        expected[expectedLength] = pos;
+        expectedStatuses[expectedLength++] = ubrk_getRuleStatus(bi);
+    }
+
+    ubrk_setText(bi, oldText, -1, &status);
+    length = ubrk_getBoundaries(bi, boundaries, statuses, UPRV_LENGTHOF(boundaries), &status);
+    TEST_ASSERT_SUCCESS(status);
+    /* Replace "quick" [4, 9[ with "slow" [4, 8[. */
+    ubrk_setText(bi, newText, -1, &status);
+    length = ubrk_updateBoundaries(bi, 4, 9, 8, boundaries, statuses, length,
+                                   UPRV_LENGTHOF(boundaries), &status);
+    TEST_ASSERT_SUCCESS(status);
+    TEST_ASSERT(length == expectedLength);
+    TEST_ASSERT(memcmp(boundaries, expected, expectedLength * 4) == 0);
+    TEST_ASSERT(memcmp(statuses, expectedStatuses, expectedLength * 4) == 0);
+
+    /* The old boundaries do not end at the end of the old text. */
+    ubrk_updateBoundaries(bi, 4, 9, 8, boundaries, NULL, length - 1,
+                          UPRV_LENGTHOF(boundaries), &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    ubrk_close(bi);
+}
+
+
+static void TestBreakIteratorRulesWithCache(void) {
+    static const UChar rules[] = u"[\\p{L}]+ {200};\n[\\p{N}]+ {100};\n. {0};";
+    static const UChar badRules[] = u"[\\p{L}]+ {200};\nabc);";
+    static const UChar text[] = u"abc 123 de4";
+    static const int32_t expected[] = { 3, 4, 7, 8, 10, 11 };
+    static const int32_t expectedStatuses[] = { 200, 0, 100, 0, 200, 100 };
+    const char *cacheDir = ctest_dataOutDir();
+    UErrorCode status = U_ZERO_ERROR;
+    UParseError parseErr;
+    char path[1000];
+    FILE *file;
+    int32_t pass, i, j, fileLength;
+
+    /* The first pass may compile the rules and write the cache file, the second one reads it. */
+    for (pass = 0; pass < 3; ++pass) {
+        UBreakIterator *bi;
+        int32_t boundaries[10];
+        int32_t statuses[10];
+        int32_t length;
+        if (pass == 1) {
+            /* Open more other rules than the process cache holds, so that the rules are evicted. */
+            for (i = 0; i < 40; ++i) {
+                char otherRules[32];
+                UChar uOtherRules[32];
+                sprintf(otherRules, "[abc]+ {%d};", (int)i);
+                u_uastrcpy(uOtherRules, otherRules);
+                ubrk_close(ubrk_openRules(uOtherRules, -1, NULL, 0, &parseErr, &status));
+            }
+            if (!assertSuccess("ubrk_openRules", &status)) {
+                return;
+            }
+        }
+        bi = ubrk_openRulesWithCache(rules, -1, text, -1, pass < 2 ? cacheDir : NULL,
+                                     &parseErr, &status);
+        if (U_FAILURE(status)) {
+            log_err_status(status, "pass %d: ubrk_openRulesWithCache() failed: %s\n",
+                           (int)pass, u_errorName(status));
+            return;
+        }
+        assertIntEquals("parseErr.line", 0, parseErr.line);
+        length = ubrk_getBoundaries(bi, boundaries, statuses, UPRV_LENGTHOF(boundaries), &status);
+        TEST_ASSERT_SUCCESS(status);
+        TEST_ASSERT(length == UPRV_LENGTHOF(expected));
+        TEST_ASSERT(memcmp(boundaries, expected, sizeof(expected)) == 0);
+        TEST_ASSERT(memcmp(statuses, expectedStatuses, sizeof(expectedStatuses)) == 0);
+        ubrk_close(bi);
+    }
+
+    /* A truncated cache file is not read beyond its end, and the rules are compiled again. */
+    sprintf(path, "%subrk" U_ICU_VERSION_SHORT "_%08x.brk",
+            cacheDir, (unsigned int)ustr_hashUCharsN(rules, u_strlen(rules)));
+    file = fopen(path, "rb");
+    if (file == NULL) {
+        log_err("unable to read the cache file %s\n", path);
+    } else {
+        int32_t truncatedLengths[5];
+        char *contents;
+        fseek(file, 0, SEEK_END);
+        fileLength = (int32_t)ftell(file);
+        fseek(file, 0, SEEK_SET);
+        contents = (char *)uprv_malloc(fileLength);
+        if (contents == NULL || (int32_t)fread(contents, 1, fileLength, file) != fileLength) {
+            log_err("unable to read the cache file %s\n", path);
+            fileLength = 0;
+        }
+        fclose(file);
+        truncatedLengths[0] = 4;  /* inside the indexes */
+        truncatedLengths[1] = 32 + 2;  /* inside the rules */
+        truncatedLengths[2] = fileLength / 2;  /* inside the compiled data */
+        truncatedLengths[3] = fileLength - 1;
+        truncatedLengths[4] = fileLength;  /* complete again */
+        for (i = 0; fileLength > 0 && i < UPRV_LENGTHOF(truncatedLengths); ++i) {
+            UBreakIterator *bi;
+            int32_t boundaries[10];
+            int32_t length;
+            file = fopen(path, "wb");
+            if (file == NULL ||
+                    (int32_t)fwrite(contents, 1, truncatedLengths[i], file) != truncatedLengths[i]) {
+                log_err("unable to write the cache file %s\n", path);
+            }
+            if (file != NULL) {
+                fclose(file);
+            }
+            /* Evict the rules from the process cache, so that the file is read. */
+            for (j = 0; j < 40; ++j) {
+                char otherRules[32];
+                UChar uOtherRules[32];
+                sprintf(otherRules, "[abc]+ {%d};", (int)j);
+                u_uastrcpy(uOtherRules, otherRules);
+                ubrk_close(ubrk_openRules(uOtherRules, -1, NULL, 0, &parseErr, &status));
+            }
+            bi = ubrk_openRulesWithCache(rules, -1, text, -1, cacheDir, &parseErr, &status);
+            if (U_FAILURE(status)) {
+                log_err_status(status, "cache file truncated to %d bytes: "
+                               "ubrk_openRulesWithCache() failed: %s\n",
+                               (int)truncatedLengths[i], u_errorName(status));
+                break;
+            }
+            length = ubrk_getBoundaries(bi, boundaries, NULL, UPRV_LENGTHOF(boundaries), &status);
+            TEST_ASSERT_SUCCESS(status);
+            TEST_ASSERT(length == UPRV_LENGTHOF(expected));
+            TEST_ASSERT(memcmp(boundaries, expected, sizeof(expected)) == 0);
+            ubrk_close(bi);
+        }
+        uprv_free(contents);
+    }
+
+    /* Rule syntax errors are reported as with ubrk_openRules(). */
+    status = U_ZERO_ERROR;
+    ubrk_close(ubrk_openRulesWithCache(badRules, -1, NULL, 0, cacheDir, &parseErr, &status));
+    TEST_ASSERT(U_FAILURE(status));
+    assertIntEquals("bad rules parseErr.line", 2, parseErr.line);
+}
+
+
+static void TestGraphemeClusters(void) {
+    /* a, e+acute, CR LF, flag of Germany, Devanagari ksha (conjunct), man+skin tone ZWJ woman */
+    static const UChar text[] =
+        u"aé\r\n\U0001F1E9\U0001F1EAक्ष\U0001F468\U0001F3FB‍\U0001F469";
+    static const int32_t expected[] = { 1, 3, 5, 9, 12, 19 };
+    static const char text8[] =
+        "ae\xcc\x81\r\n\xf0\x9f\x87\xa9\xf0\x9f\x87\xaa\xe0\xa4\x95\xe0\xa5\x8d\xe0\xa4\xb7"
+        "\xf0\x9f\x91\xa8\xf0\x9f\x8f\xbb\xe2\x80\x8d\xf0\x9f\x91\xa9";
+    static const int32_t expected8[] = { 1, 4, 6, 14, 23, 38 };
+    UErrorCode status = U_ZERO_ERROR;
+    int32_t i, start, start8;
+
+    for (i = 0, start = 0, start8 = 0; i < UPRV_LENGTHOF(expected); ++i) {
+        start = ugrapheme_next(text, start, -1, &status);
+        start8 = ugrapheme_nextUTF8(text8, start8, -1, &status);
+        TEST_ASSERT_SUCCESS(status);
+        assertIntEquals("ugrapheme_next", expected[i], start);
+        assertIntEquals("ugrapheme_nextUTF8", expected8[i], start8);
+    }
+    assertIntEquals("ugrapheme_next at end", u_strlen(text), ugrapheme_next(text, start, -1, &status));
+    assertIntEquals("ugrapheme_count", 6, ugrapheme_count(text, -1, &status));
+    assertIntEquals("ugrapheme_countUTF8", 6, ugrapheme_countUTF8(text8, -1, &status));
+    assertIntEquals("ugrapheme_count prefix", 3, ugrapheme_count(text, 5, &status));
+    assertIntEquals("ugrapheme_truncate", 9, ugrapheme_truncate(text, -1, 4, &status));
+    assertIntEquals("ugrapheme_truncateUTF8", 14, ugrapheme_truncateUTF8(text8, -1, 4, &status));
+    assertIntEquals("ugrapheme_truncate 0", 0, ugrapheme_truncate(text, -1, 0, &status));
+    assertIntEquals("ugrapheme_truncate all", 19, ugrapheme_truncate(text, -1, 100, &status));
+    assertIntEquals("ugrapheme_count empty", 0, ugrapheme_count(NULL, 0, &status));
+    TEST_ASSERT_SUCCESS(status);
+
+    ugrapheme_next(text, 20, -1, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    status = U_ZERO_ERROR;
+    ugrapheme_countUTF8(NULL, 5, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+    status = U_ZERO_ERROR;
+    ugrapheme_truncate(text, -1, -1, &status);
+    TEST_ASSERT(status == U_ILLEGAL_ARGUMENT_ERROR);
+}
+
+
 static void TestBug11665(void) {
     // The problem was with the incorrect breaking of Japanese text beginning
     // with Katakana characters when no prior Japanese or Chinese text had been
@@ -58,6 +58,9 @@ cnv_open(const char *name, UErrorCode *pErrorCode) {
 
 static void ListNames(void);
 static void TestFlushCache(void);
+static void TestCacheMemoryLimit(void);
+static void TestConverterPool(void);
+static void TestConverterPoolCallbacks(void);
 static void TestDuplicateAlias(void);
 static void TestCCSID(void);
 static void TestJ932(void);
@@ -75,6 +78,8 @@ static void TestEBCDICSwapLFNL(void);
 static void TestConvertEx(void);
 static void TestConvertExFromUTF8(void);
 static void TestConvertExFromUTF8_C5F0(void);
+static void TestConvertExToUTF8(void);
+static void TestLatin1Bulk(void);
 static void TestConvertAlgorithmic(void);
        void TestDefaultConverterError(void);    /* defined in cctest.c */
        void TestDefaultConverterSet(void);    /* defined in cctest.c */
@@ -94,6 +99,9 @@ void addTestConvert(TestNode** root)
     addTest(root, &ListNames,                   "tsconv/ccapitst/ListNames");
     addTest(root, &TestConvert,                 "tsconv/ccapitst/TestConvert");
     addTest(root, &TestFlushCache,              "tsconv/ccapitst/TestFlushCache"); 
+    addTest(root, &TestCacheMemoryLimit,        "tsconv/ccapitst/TestCacheMemoryLimit");
+    addTest(root, &TestConverterPool,           "tsconv/ccapitst/TestConverterPool");
+    addTest(root, &TestConverterPoolCallbacks,  "tsconv/ccapitst/TestConverterPoolCallbacks");
     addTest(root, &TestAlias,                   "tsconv/ccapitst/TestAlias"); 
     addTest(root, &TestDuplicateAlias,          "tsconv/ccapitst/TestDuplicateAlias"); 
     addTest(root, &TestConvertSafeClone,        "tsconv/ccapitst/TestConvertSafeClone");
@@ -111,6 +119,8 @@ void addTestConvert(TestNode** root)
     addTest(root, &TestConvertEx,               "tsconv/ccapitst/TestConvertEx");
     addTest(root, &TestConvertExFromUTF8,       "tsconv/ccapitst/TestConvertExFromUTF8");
     addTest(root, &TestConvertExFromUTF8_C5F0,  "tsconv/ccapitst/TestConvertExFromUTF8_C5F0");
+    addTest(root, &TestConvertExToUTF8,         "tsconv/ccapitst/TestConvertExToUTF8");
+    addTest(root, &TestLatin1Bulk,              "tsconv/ccapitst/TestLatin1Bulk");
     addTest(root, &TestConvertAlgorithmic,      "tsconv/ccapitst/TestConvertAlgorithmic");
     addTest(root, &TestDefaultConverterError,   "tsconv/ccapitst/TestDefaultConverterError");
     addTest(root, &TestDefaultConverterSet,     "tsconv/ccapitst/TestDefaultConverterSet");
@@ -1143,6 +1153,179 @@ static void TestFlushCache(void) {
 #endif
 }
 
+/* Returns the cache memory usage for the data of one converter. */
+static int32_t getConverterCacheMemoryUsage(const char *name) {
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t before, usage;
+    ucnv_flushCache();
+    before=ucnv_getCacheMemoryUsage();
+    ucnv_close(ucnv_open(name, &errorCode));
+    usage=ucnv_getCacheMemoryUsage()-before;
+    ucnv_flushCache();
+    return U_SUCCESS(errorCode) ? usage : -1;
+}
+
+static void TestCacheMemoryLimit(void) {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    /* SBCS, EBCDIC_STATEFUL and MBCS tables of different sizes, without base tables */
+    static const char *const names[]={ "ibm-1047", "ibm-1390", "ibm-943_P15A-2003" };
+    int32_t sizes[UPRV_LENGTHOF(names)];
+    UErrorCode errorCode=U_ZERO_ERROR;
+    UConverter *cnv;
+    int32_t i, usage;
+
+    ucnv_setCacheMemoryLimit(-1);
+    for(i=0; i<UPRV_LENGTHOF(names); ++i) {
+        sizes[i]=getConverterCacheMemoryUsage(names[i]);
+        if(sizes[i]<=0) {
+            log_data_err("unable to load %s or it is not cached, usage %d\n", names[i], (int)sizes[i]);
+            return;
+        }
+    }
+    usage=ucnv_getCacheMemoryUsage();
+
+    /* Without a limit, unused data stays cached. */
+    for(i=0; i<UPRV_LENGTHOF(names); ++i) {
+        ucnv_close(ucnv_open(names[i], &errorCode));
+    }
+    if(ucnv_getCacheMemoryUsage()!=usage+sizes[0]+sizes[1]+sizes[2]) {
+        log_err("without a limit, the cache uses %d bytes, expected %d\n",
+                (int)ucnv_getCacheMemoryUsage(), (int)(usage+sizes[0]+sizes[1]+sizes[2]));
+    }
+
+    /* Setting a limit unloads the least recently used data. */
+    ucnv_setCacheMemoryLimit(usage+sizes[1]+sizes[2]);
+    if(ucnv_getCacheMemoryUsage()!=usage+sizes[1]+sizes[2]) {
+        log_err("with a limit for the last two converters, the cache uses %d bytes, expected %d\n",
+                (int)ucnv_getCacheMemoryUsage(), (int)(usage+sizes[1]+sizes[2]));
+    }
+
+    /* Reusing cached data makes it the most recently used. */
+    ucnv_close(ucnv_open(names[1], &errorCode));
+    ucnv_close(ucnv_open(names[0], &errorCode));
+    if(ucnv_getCacheMemoryUsage()!=usage+sizes[0]+sizes[1]) {
+        log_err("after reopening %s and %s, the cache uses %d bytes, expected %d\n",
+                names[1], names[0], (int)ucnv_getCacheMemoryUsage(), (int)(usage+sizes[0]+sizes[1]));
+    }
+
+    /* Data of open converters is not unloaded, even above the limit. */
+    ucnv_setCacheMemoryLimit(0);
+    cnv=ucnv_open(names[2], &errorCode);
+    if(ucnv_getCacheMemoryUsage()!=usage+sizes[2]) {
+        log_err("with an open converter and no cache, the cache uses %d bytes, expected %d\n",
+                (int)ucnv_getCacheMemoryUsage(), (int)(usage+sizes[2]));
+    }
+    ucnv_close(cnv);
+    if(ucnv_getCacheMemoryUsage()!=usage) {
+        log_err("with no cache, the cache uses %d bytes, expected %d\n",
+                (int)ucnv_getCacheMemoryUsage(), (int)usage);
+    }
+
+    /* Unloading an extension-only converter also unloads its unused base table. */
+    ucnv_close(ucnv_open("ibm-943_P130-1999", &errorCode));
+    if(ucnv_getCacheMemoryUsage()!=usage) {
+        log_err("with no cache, after ibm-943_P130-1999 the cache uses %d bytes, expected %d\n",
+                (int)ucnv_getCacheMemoryUsage(), (int)usage);
+    }
+    if(U_FAILURE(errorCode)) {
+        log_err("opening converters failed - %s\n", u_errorName(errorCode));
+    }
+
+    ucnv_setCacheMemoryLimit(-1);
+#endif
+}
+
+static void TestConverterPool(void) {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const char truncated[] = { 0x41, (char)0x82 };
+    UErrorCode err = U_ZERO_ERROR;
+    UConverter *cnv, *cnv2;
+    UConverterToUCallback toUAction;
+    const void *toUContext;
+    UChar buffer[8], *target;
+    const char *source;
+    char subChars[8];
+    int8_t subCharsLength;
+    int32_t flushCount, usage;
+
+    ucnv_flushCache();
+
+    /* A recycled converter is reused for any alias of its name, and it is reset. */
+    cnv = ucnv_openPooled("Shift_JIS", &err);
+    if (U_FAILURE(err)) {
+        log_data_err("ucnv_openPooled(Shift_JIS) failed - %s\n", u_errorName(err));
+        return;
+    }
+    ucnv_setToUCallBack(cnv, UCNV_TO_U_CALLBACK_STOP, NULL, NULL, NULL, &err);
+    source = truncated;
+    target = buffer;
+    ucnv_toUnicode(cnv, &target, buffer + UPRV_LENGTHOF(buffer),
+                   &source, truncated + UPRV_LENGTHOF(truncated), NULL, false, &err);
+    if (U_FAILURE(err) || ucnv_toUCountPending(cnv, &err) != 1) {
+        log_err("ucnv_toUnicode(truncated Shift_JIS) did not leave 1 byte pending - %s\n", u_errorName(err));
+    }
+    ucnv_recycle(cnv);
+
+    cnv2 = ucnv_openPooled("ibm-943_P15A-2003", &err);
+    if (U_FAILURE(err)) {
+        log_err("ucnv_openPooled(ibm-943_P15A-2003) failed - %s\n", u_errorName(err));
+        return;
+    }
+    if (cnv2 != cnv) {
+        log_err("ucnv_openPooled(ibm-943_P15A-2003) did not reuse the recycled Shift_JIS converter\n");
+    }
+    if (ucnv_toUCountPending(cnv2, &err) != 0) {
+        log_err("the pooled converter was not reset\n");
+    }
+    ucnv_getToUCallBack(cnv2, &toUAction, &toUContext);
+    if (toUAction != UCNV_TO_U_CALLBACK_SUBSTITUTE || toUContext != NULL) {
+        log_err("the pooled converter does not have the default callback\n");
+    }
+
+    /* A converter with non-default substitution characters is closed rather than pooled. */
+    ucnv_setSubstChars(cnv2, "?", 1, &err);
+    ucnv_recycle(cnv2);
+    cnv = ucnv_openPooled("Shift_JIS", &err);
+    subCharsLength = (int8_t)sizeof(subChars);
+    ucnv_getSubstChars(cnv, subChars, &subCharsLength, &err);
+    if (U_FAILURE(err) || subCharsLength != 2 || subChars[0] != (char)0xfc || subChars[1] != (char)0xfc) {
+        log_err("the pooled converter does not have the default substitution characters - %s\n",
+                u_errorName(err));
+    }
+    ucnv_recycle(cnv);
+
+    /* ucnv_flushCache() closes the pooled converters so that their shared data can be unloaded. */
+    if ((flushCount = ucnv_flushCache()) != 1) {
+        log_err("ucnv_flushCache() with a pooled converter unloaded %d converters, expected 1\n", flushCount);
+    }
+
+    /*
+     * Names with options are not pooled but work.
+     * Without a cache, closing rather than pooling the converter also unloads its data.
+     */
+    ucnv_setCacheMemoryLimit(0);
+    usage = ucnv_getCacheMemoryUsage();
+    cnv = ucnv_openPooled("ibm-1047,swaplfnl", &err);
+    if (U_FAILURE(err) || uprv_strcmp(ucnv_getName(cnv, &err), "ibm-1047_P100-1995,swaplfnl") != 0) {
+        log_err("ucnv_openPooled(ibm-1047,swaplfnl) failed - %s\n", u_errorName(err));
+    }
+    ucnv_recycle(cnv);
+    if (ucnv_getCacheMemoryUsage() != usage) {
+        log_err("ucnv_recycle(ibm-1047,swaplfnl) pooled the converter\n");
+    }
+    ucnv_setCacheMemoryLimit(-1);
+    ucnv_recycle(NULL);
+
+    cnv = ucnv_openPooled("no-such-charset", &err);
+    if (cnv != NULL || err != U_FILE_ACCESS_ERROR) {
+        log_err("ucnv_openPooled(no-such-charset) returned %s, expected U_FILE_ACCESS_ERROR\n",
+                u_errorName(err));
+    }
+    ucnv_close(cnv);
+    ucnv_flushCache();
+#endif
+}
+
 /**
  * Test the converter alias API, specifically the fuzzy matching of
  * alias names and the alias table integrity.  Make sure each
@@ -1668,6 +1851,30 @@ containsAnyOtherByte(uint8_t *p, int32_t length, uint8_t b) {
     return false;
 }
 
+static void TestConverterPoolCallbacks()
+{
+    UErrorCode err = U_ZERO_ERROR;
+    TSCCContext from, to;
+    UConverter *cnv;
+
+    /* ucnv_recycle() lets the callbacks release their contexts, like ucnv_close(). */
+    cnv = ucnv_openPooled("iso-8859-3", &err);
+    if(U_FAILURE(err)) {
+        log_data_err("Err opening iso-8859-3, %s\n", u_errorName(err));
+        return;
+    }
+    TSCC_init(&from);
+    TSCC_init(&to);
+    ucnv_setFromUCallBack(cnv, TSCC_fromU, &from, NULL, NULL, &err);
+    ucnv_setToUCallBack(cnv, TSCC_toU, &to, NULL, NULL, &err);
+    ucnv_recycle(cnv);
+    if(!from.wasClosed || !to.wasClosed) {
+        log_err("FAIL! ucnv_recycle() did not close the callback contexts, from: %s, to: %s\n",
+                from.wasClosed ? "closed" : "open", to.wasClosed ? "closed" : "open");
+    }
+    ucnv_flushCache();
+}
+
 static void TestConvertSafeClone()
 {
     /* one 'regular' & all the 'private stateful' converters */
@@ -2913,6 +3120,263 @@ static void TestConvertExFromUTF8_C5F0() {
     ucnv_close(utf8Cnv);
 }
 
+/*
+ * Test direct conversion from MBCS charsets to UTF-8,
+ * including SI/SO-stateful and extension-table converters,
+ * against conversion via UTF-16.
+ */
+static void TestConvertExToUTF8() {
+#if !UCONFIG_NO_LEGACY_CONVERSION
+    static const char *const converterNames[]={
+        "shift-jis",
+        "gbk",
+        "big5",
+        "gb18030",
+        "ibm-939",
+        "ibm-33722_P120-1999",
+        "ibm-1390"
+    };
+    /* ASCII, Han, Katakana, Hangul, supplementary, and a private use character */
+    static const UChar text[]={
+        0x61, 0x62, 0x4e00, 0x4e8c, 0x30a2, 0x20, 0xac00, 0x31, 0xd840, 0xdc0b,
+        0x3000, 0xe000, 0x7a, 0x9ad8, 0x20ac, 0xff71, 0x0a
+    };
+    /* illegal and truncated sequences in many of these charsets */
+    static const char badBytes[]={ (char)0x81, 0x20, 0x0e, (char)0xff, 0x0f, (char)0x8f };
+
+    char src[200], expect[400];
+    UChar utf16[200];
+    int32_t srcLength, utf16Length, expectLength;
+    UConverter *utf8Cnv, *cnv;
+    UErrorCode errorCode;
+    int32_t i;
+
+    errorCode=U_ZERO_ERROR;
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open UTF-8 converter - %s\n", u_errorName(errorCode));
+        return;
+    }
+
+    for(i=0; i<UPRV_LENGTHOF(converterNames); ++i) {
+        errorCode=U_ZERO_ERROR;
+        cnv=ucnv_open(converterNames[i], &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_data_err("unable to open %s converter - %s\n", converterNames[i], u_errorName(errorCode));
+            continue;
+        }
+
+        /* the text, twice, then bad bytes */
+        srcLength=ucnv_fromUChars(cnv, src, 80, text, UPRV_LENGTHOF(text), &errorCode);
+        srcLength+=ucnv_fromUChars(cnv, src+srcLength, 80, text, UPRV_LENGTHOF(text), &errorCode);
+        uprv_memcpy(src+srcLength, badBytes, sizeof(badBytes));
+        srcLength+=(int32_t)sizeof(badBytes);
+
+        /* expected result via UTF-16 */
+        utf16Length=ucnv_toUChars(cnv, utf16, UPRV_LENGTHOF(utf16), src, srcLength, &errorCode);
+        u_strToUTF8(expect, (int32_t)sizeof(expect), &expectLength, utf16, utf16Length, &errorCode);
+        if(U_FAILURE(errorCode)) {
+            log_err("unable to prepare %s test data - %s\n", converterNames[i], u_errorName(errorCode));
+            ucnv_close(cnv);
+            continue;
+        }
+
+        convertExMultiStreaming(cnv, utf8Cnv,
+                                src, srcLength,
+                                expect, expectLength,
+                                converterNames[i],
+                                U_ZERO_ERROR);
+
+        /* with fallbacks */
+        ucnv_setFallback(cnv, true);
+        utf16Length=ucnv_toUChars(cnv, utf16, UPRV_LENGTHOF(utf16), src, srcLength, &errorCode);
+        u_strToUTF8(expect, (int32_t)sizeof(expect), &expectLength, utf16, utf16Length, &errorCode);
+        convertExMultiStreaming(cnv, utf8Cnv,
+                                src, srcLength,
+                                expect, expectLength,
+                                converterNames[i],
+                                U_ZERO_ERROR);
+        ucnv_close(cnv);
+    }
+    ucnv_close(utf8Cnv);
+#endif
+}
+
+/*
+ * Latin-1 and US-ASCII convert runs of characters in bulk.
+ * Test with ASCII runs of many lengths, so that non-ASCII characters,
+ * unmappable characters and buffer ends fall in different places
+ * relative to the bulk blocks.
+ */
+static void TestLatin1Bulk() {
+    char latin1[300], ascii[300], bytes[300], expect[600];
+    UChar utf16[300], out[300], *target;
+    const UChar *uSource;
+    const char *source;
+    char *bytesTarget;
+    int32_t offsets[300];
+    UConverter *latin1Cnv, *asciiCnv, *utf8Cnv;
+    UErrorCode errorCode=U_ZERO_ERROR;
+    int32_t i, length, expectLength;
+
+    /* ASCII runs of increasing lengths, separated by non-ASCII bytes */
+    for(i=0, length=1; i<UPRV_LENGTHOF(latin1); ++length) {
+        int32_t runLength=length;
+        while(runLength-->0 && i<UPRV_LENGTHOF(latin1)) {
+            ascii[i]=latin1[i]=(char)(0x20+i%0x5f);
+            ++i;
+        }
+        if(i<UPRV_LENGTHOF(latin1)) {
+            latin1[i]=(char)(0x80+i%0x80);
+            ascii[i]='-';
+            ++i;
+        }
+    }
+    for(i=0; i<UPRV_LENGTHOF(latin1); ++i) {
+        utf16[i]=(uint8_t)latin1[i];
+    }
+
+    latin1Cnv=ucnv_open("ISO-8859-1", &errorCode);
+    asciiCnv=ucnv_open("US-ASCII", &errorCode);
+    utf8Cnv=ucnv_open("UTF-8", &errorCode);
+    if(U_FAILURE(errorCode)) {
+        log_data_err("unable to open the converters - %s\n", u_errorName(errorCode));
+        ucnv_close(latin1Cnv);
+        ucnv_close(asciiCnv);
+        return;
+    }
+
+    /* to UTF-16, with offsets */
+    source=latin1;
+    target=out;
+    ucnv_toUnicode(latin1Cnv, &target, out+UPRV_LENGTHOF(out),
+                   &source, latin1+UPRV_LENGTHOF(latin1), offsets, true, &errorCode);
+    if(U_FAILURE(errorCode) || target!=out+UPRV_LENGTHOF(out) ||
+            0!=u_memcmp(out, utf16, UPRV_LENGTHOF(out))) {
+        log_err("ISO-8859-1 toUnicode is wrong - %s\n", u_errorName(errorCode));
+    }
+    for(i=0; i<UPRV_LENGTHOF(out); ++i) {
+        if(offsets[i]!=i) {
+            log_err("ISO-8859-1 toUnicode offsets[%d]=%d\n", (int)i, (int)offsets[i]);
+            break;
+        }
+    }
+
+    source=ascii;
+    target=out;
+    ucnv_toUnicode(asciiCnv, &target, out+UPRV_LENGTHOF(out),
+                   &source, ascii+UPRV_LENGTHOF(ascii), offsets, true, &errorCode);
+    if(U_FAILURE(errorCode) || target!=out+UPRV_LENGTHOF(out)) {
+        log_err("US-ASCII toUnicode failed - %s\n", u_errorName(errorCode));
+    }
+    for(i=0; i<UPRV_LENGTHOF(out); ++i) {
+        if(out[i]!=(uint8_t)ascii[i] || offsets[i]!=i) {
+            log_err("US-ASCII toUnicode is wrong at %d\n", (int)i);
+            break;
+        }
+    }
+
+    /* from UTF-16, with offsets */
+    uSource=utf16;
+    bytesTarget=bytes;
+    ucnv_fromUnicode(latin1Cnv, &bytesTarget, bytes+UPRV_LENGTHOF(bytes),
+                     &uSource, utf16+UPRV_LENGTHOF(utf16), offsets, true, &errorCode);
+    if(U_FAILURE(errorCode) || bytesTarget!=bytes+UPRV_LENGTHOF(bytes) ||
+            0!=uprv_memcmp(bytes, latin1, UPRV_LENGTHOF(bytes))) {
+        log_err("ISO-8859-1 fromUnicode is wrong - %s\n", u_errorName(errorCode));
+    }
+    for(i=0; i<UPRV_LENGTHOF(bytes); ++i) {
+        if(offsets[i]!=i) {
+            log_err("ISO-8859-1 fromUnicode offsets[%d]=%d\n", (int)i, (int)offsets[i]);
+            break;
+        }
+    }
+
+    /* an unmappable character stops the conversion right before it */
+    ucnv_setFromUCallBack(latin1Cnv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    ucnv_setFromUCallBack(asciiCnv, UCNV_FROM_U_CALLBACK_STOP, NULL, NULL, NULL, &errorCode);
+    for(i=0; i<40; ++i) {
+        UChar saved=utf16[i];
+        UErrorCode stopErrorCode=U_ZERO_ERROR;
+        utf16[i]=(UChar)(0x100+i);
+        uSource=utf16;
+        bytesTarget=bytes;
+        ucnv_resetFromUnicode(latin1Cnv);
+        ucnv_fromUnicode(latin1Cnv, &bytesTarget, bytes+UPRV_LENGTHOF(bytes),
+                         &uSource, utf16+UPRV_LENGTHOF(utf16), NULL, true, &stopErrorCode);
+        if(stopErrorCode!=U_INVALID_CHAR_FOUND || (bytesTarget-bytes)!=i || (uSource-utf16)!=i+1) {
+            log_err("ISO-8859-1 fromUnicode with U+%04x at %d: %s, %d bytes\n",
+                    utf16[i], (int)i, u_errorName(stopErrorCode), (int)(bytesTarget-bytes));
+        }
+        utf16[i]=saved;
+
+        stopErrorCode=U_ZERO_ERROR;
+        uSource=utf16+i;
+        bytesTarget=bytes;
+        ucnv_resetFromUnicode(asciiCnv);
+        ucnv_fromUnicode(asciiCnv, &bytesTarget, bytes+UPRV_LENGTHOF(bytes),
+                         &uSource, utf16+UPRV_LENGTHOF(utf16), NULL, true, &stopErrorCode);
+        length=0;
+        while(utf16[i+length]<0x80) {
+            ++length;
+        }
+        if(stopErrorCode!=U_INVALID_CHAR_FOUND || (bytesTarget-bytes)!=length) {
+            log_err("US-ASCII fromUnicode from %d: %s, %d bytes, expected %d\n",
+                    (int)i, u_errorName(stopErrorCode), (int)(bytesTarget-bytes), (int)length);
+        }
+    }
+
+    /* to and from UTF-8, also with target overflows inside characters */
+    u_strToUTF8(expect, (int32_t)sizeof(expect), &expectLength, utf16, UPRV_LENGTHOF(utf16), &errorCode);
+    convertExMultiStreaming(latin1Cnv, utf8Cnv, latin1, UPRV_LENGTHOF(latin1),
+                            expect, expectLength, "ISO-8859-1 to UTF-8", U_ZERO_ERROR);
+    convertExMultiStreaming(utf8Cnv, latin1Cnv, expect, expectLength,
+                            latin1, UPRV_LENGTHOF(latin1), "UTF-8 to ISO-8859-1", U_ZERO_ERROR);
+    convertExMultiStreaming(asciiCnv, utf8Cnv, ascii, UPRV_LENGTHOF(ascii),
+                            ascii, UPRV_LENGTHOF(ascii), "US-ASCII to UTF-8", U_ZERO_ERROR);
+    convertExMultiStreaming(utf8Cnv, asciiCnv, ascii, UPRV_LENGTHOF(ascii),
+                            ascii, UPRV_LENGTHOF(ascii), "UTF-8 to US-ASCII", U_ZERO_ERROR);
+
+    /* an illegal byte in US-ASCII input becomes U+FFFD */
+    uprv_memcpy(bytes, ascii, UPRV_LENGTHOF(ascii));
+    bytes[150]=(char)0xe4;
+    uprv_memcpy(expect, ascii, 150);
+    expect[150]=(char)0xef;
+    expect[151]=(char)0xbf;
+    expect[152]=(char)0xbd;
+    uprv_memcpy(expect+153, ascii+151, UPRV_LENGTHOF(ascii)-151);
+    convertExMultiStreaming(asciiCnv, utf8Cnv, bytes, UPRV_LENGTHOF(ascii),
+                            expect, UPRV_LENGTHOF(ascii)+2, "US-ASCII with 0xe4 to UTF-8", U_ZERO_ERROR);
+
+    /* a lead surrogate pending in the UTF-8 converter becomes U+FFFD before the text */
+    for(i=0; i<2; ++i) {
+        static const UChar lead[1]={ 0xd800 };
+        static const char abc[3]={ 0x61, 0x62, 0x63 };
+        static const char fffdABC[6]={ (char)0xef, (char)0xbf, (char)0xbd, 0x61, 0x62, 0x63 };
+        UConverter *cnv= i==0 ? latin1Cnv : asciiCnv;
+        UChar pivot[8], *pivotSource=pivot, *pivotTarget=pivot;
+        ucnv_reset(cnv);
+        ucnv_reset(utf8Cnv);
+        uSource=lead;
+        bytesTarget=bytes;
+        ucnv_fromUnicode(utf8Cnv, &bytesTarget, bytes+UPRV_LENGTHOF(bytes),
+                         &uSource, lead+1, NULL, false, &errorCode);
+        source=abc;
+        bytesTarget=bytes;
+        ucnv_convertEx(utf8Cnv, cnv, &bytesTarget, bytes+UPRV_LENGTHOF(bytes),
+                       &source, abc+3, pivot, &pivotSource, &pivotTarget, pivot+UPRV_LENGTHOF(pivot),
+                       false, true, &errorCode);
+        if(U_FAILURE(errorCode) || (bytesTarget-bytes)!=6 || 0!=uprv_memcmp(bytes, fffdABC, 6)) {
+            log_err("%s to UTF-8 with a pending lead surrogate: %s, %d bytes\n",
+                    ucnv_getName(cnv, &errorCode), u_errorName(errorCode), (int)(bytesTarget-bytes));
+        }
+    }
+
+    ucnv_close(latin1Cnv);
+    ucnv_close(asciiCnv);
+    ucnv_close(utf8Cnv);
+}
+
 static void
 TestConvertAlgorithmic() {
 #if !UCONFIG_NO_LEGACY_CONVERSION
@@ -39,6 +39,7 @@ static void Test_strFromUTF32_surrogates(void);
 static void Test_UChar_UTF8_API(void);
 static void Test_FromUTF8(void);
 static void Test_FromUTF8Lenient(void);
+static void Test_UTF8_ASCIIRuns(void);
 static void Test_UChar_WCHART_API(void);
 static void Test_widestrs(void);
 static void Test_WCHART_LongString(void);
@@ -56,6 +57,7 @@ addUCharTransformTest(TestNode** root)
    addTest(root, &Test_UChar_UTF8_API, "custrtrn/Test_UChar_UTF8_API");
    addTest(root, &Test_FromUTF8, "custrtrn/Test_FromUTF8");
    addTest(root, &Test_FromUTF8Lenient, "custrtrn/Test_FromUTF8Lenient");
+   addTest(root, &Test_UTF8_ASCIIRuns, "custrtrn/Test_UTF8_ASCIIRuns");
    addTest(root, &Test_UChar_WCHART_API,  "custrtrn/Test_UChar_WCHART_API");
    addTest(root, &Test_widestrs,  "custrtrn/Test_widestrs");
 #if !UCONFIG_NO_FILE_IO && !UCONFIG_NO_LEGACY_CONVERSION
@@ -1164,6 +1166,89 @@ static const uint16_t src16WithNulls[] = {
     0x0054, 0x0000 */
 
 };
+/*
+ * ASCII runs are converted in bulk.
+ * Test runs of lengths around the vector width, between multi-byte sequences
+ * and ill-formed input, with exact, short and no destination capacity.
+ */
+static void
+Test_UTF8_ASCIIRuns(void) {
+    static const int32_t runLengths[]={ 0, 1, 7, 15, 16, 17, 31, 32, 33, 100 };
+    static const UChar32 separators[]={ 0xe9, 0x4e2d, 0x1f600, -1 };  /* -1: ill-formed */
+    UChar in16[3000], expect16[3000], dest16[3000];
+    char in8[6000], expect8[6000], dest8[6000];
+    int32_t length16=0, expectLength16=0, length8=0, expectLength8=0;
+    int32_t expectSubs=0;
+    int32_t i, j, k, capacity, destLength, numSubstitutions;
+    UErrorCode errorCode;
+    UBool isError=false;
+
+    for(i=0; i<UPRV_LENGTHOF(runLengths); ++i) {
+        for(j=0; j<UPRV_LENGTHOF(separators); ++j) {
+            for(k=0; k<runLengths[i]; ++k) {
+                char c=(char)(0x20+(k+j)%0x5f);
+                in16[length16++]=expect16[expectLength16++]=(UChar)c;
+                in8[length8++]=expect8[expectLength8++]=c;
+            }
+            if(separators[j]>=0) {
+                U16_APPEND_UNSAFE(in16, length16, separators[j]);
+                U16_APPEND_UNSAFE(expect16, expectLength16, separators[j]);
+                U8_APPEND_UNSAFE(in8, length8, separators[j]);
+                U8_APPEND_UNSAFE(expect8, expectLength8, separators[j]);
+            } else {
+                /* an unpaired surrogate and an ill-formed byte, both substituted with U+FFFD */
+                in16[length16++]=0xdc00;
+                U8_APPEND_UNSAFE(expect8, expectLength8, 0xfffd);
+                in8[length8++]=(char)0xff;
+                expect16[expectLength16++]=0xfffd;
+                ++expectSubs;
+            }
+        }
+    }
+
+    /* capacity: exact, one short, preflight */
+    for(i=0; i<3; ++i) {
+        capacity= i==0 ? expectLength8 : i==1 ? expectLength8-1 : 0;
+        errorCode=U_ZERO_ERROR;
+        u_strToUTF8WithSub(capacity>0 ? dest8 : NULL, capacity, &destLength,
+                           in16, length16, 0xfffd, &numSubstitutions, &errorCode);
+        if( destLength!=expectLength8 || numSubstitutions!=expectSubs ||
+            (i==0 ? (errorCode!=U_STRING_NOT_TERMINATED_WARNING ||
+                     0!=memcmp(dest8, expect8, expectLength8)) :
+                    errorCode!=U_BUFFER_OVERFLOW_ERROR)
+        ) {
+            log_err("error: u_strToUTF8WithSub(ASCII runs, capacity %ld) wrong result - %s\n",
+                    (long)capacity, u_errorName(errorCode));
+            isError=true;
+        }
+
+        capacity= i==0 ? expectLength16 : i==1 ? expectLength16-1 : 0;
+        errorCode=U_ZERO_ERROR;
+        u_strFromUTF8WithSub(capacity>0 ? dest16 : NULL, capacity, &destLength,
+                             in8, length8, 0xfffd, &numSubstitutions, &errorCode);
+        if( destLength!=expectLength16 || numSubstitutions!=expectSubs ||
+            (i==0 ? (errorCode!=U_STRING_NOT_TERMINATED_WARNING ||
+                     0!=u_memcmp(dest16, expect16, expectLength16)) :
+                    errorCode!=U_BUFFER_OVERFLOW_ERROR)
+        ) {
+            log_err("error: u_strFromUTF8WithSub(ASCII runs, capacity %ld) wrong result - %s\n",
+                    (long)capacity, u_errorName(errorCode));
+            isError=true;
+        }
+    }
+
+    /* without substitution, the ill-formed input is an error */
+    errorCode=U_ZERO_ERROR;
+    u_strFromUTF8(dest16, UPRV_LENGTHOF(dest16), &destLength, in8, length8, &errorCode);
+    if(errorCode!=U_INVALID_CHAR_FOUND) {
+        log_err("error: u_strFromUTF8(ASCII runs, ill-formed) - %s\n", u_errorName(errorCode));
+        isError=true;
+    }
+    if(!isError) {
+        log_verbose("u_strToUTF8WithSub() and u_strFromUTF8WithSub() with ASCII runs OK\n");
+    }
+}
+
 static void Test_UChar_WCHART_API(void){
 #if (defined(U_WCHAR_IS_UTF16) || defined(U_WCHAR_IS_UTF32)) || (!UCONFIG_NO_CONVERSION && !UCONFIG_NO_LEGACY_CONVERSION)
     UErrorCode err = U_ZERO_ERROR;
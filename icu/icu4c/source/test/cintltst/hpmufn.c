@@ -15,7 +15,10 @@
 #include "unicode/uclean.h"
 #include "unicode/uchar.h"
 #include "unicode/ures.h"
+#include "unicode/ubrk.h"
+#include "unicode/utext.h"
 #include "cintltst.h"
+#include "cmemory.h"
 #include "unicode/utrace.h"
 #include <stdlib.h>
 #include <string.h>
@@ -30,6 +33,9 @@ typedef union {
 } ctest_AlignedMemory;
 
 static void TestHeapFunctions(void);
+#if !UCONFIG_NO_BREAK_ITERATION
+static void TestBreakIteratorAllocations(void);
+#endif
 
 void addHeapMutexTest(TestNode **root);
 
@@ -38,6 +44,9 @@ void
 addHeapMutexTest(TestNode** root)
 {
     addTest(root, &TestHeapFunctions,       "hpmufn/TestHeapFunctions"  );
+#if !UCONFIG_NO_BREAK_ITERATION
+    addTest(root, &TestBreakIteratorAllocations, "hpmufn/TestBreakIteratorAllocations");
+#endif
 }
 
 static int32_t gMutexFailures = 0;
@@ -116,8 +125,9 @@ static void * U_CALLCONV myMemRealloc(const void *context, void *mem, size_t siz
     }
     retPtr = realloc(p, size+sizeof(ctest_AlignedMemory));
     if (retPtr != NULL) {
-        p += sizeof(ctest_AlignedMemory);
+        retPtr += sizeof(ctest_AlignedMemory);
     }
+    gBlockCount ++;
     return retPtr;
 }
 
@@ -199,4 +209,56 @@ static void TestHeapFunctions() {
     ctest_resetICU();
 }
 
+#if !UCONFIG_NO_BREAK_ITERATION
+/*
+ * A line break iterator that is reused for UTF-8 text should not allocate memory
+ * once it has seen similar text: Neither in ubrk_setUText() nor while iterating,
+ * including in the dictionary break engines.
+ */
+static void TestBreakIteratorAllocations() {
+    static const char *const texts[] = {
+        "Hello, world. Line breaking (with numbers 123.45) in UTF-8.",
+        /* Thai, with dictionary-based breaks */
+        "\xe0\xb8\xaa\xe0\xb8\xa7\xe0\xb8\xb1\xe0\xb8\xaa\xe0\xb8\x94\xe0\xb8\xb5\xe0\xb8\x84\xe0\xb8\xa3\xe0\xb8\xb1\xe0\xb8\x9a "
+        "\xe0\xb8\x9c\xe0\xb8\xa1\xe0\xb8\x8a\xe0\xb8\xb7\xe0\xb9\x88\xe0\xb8\xad\xe0\xb8\x97\xe0\xb8\x94\xe0\xb8\xaa\xe0\xb8\xad\xe0\xb8\x9a",
+        /* Japanese, alternating between Han, Hiragana and Katakana */
+        "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e\xe3\x81\xae\xe3\x83\x86\xe3\x82\xad\xe3\x82\xb9\xe3\x83\x88\xe3\x82\x92"
+        "\xe5\x88\x86\xe5\x89\xb2\xe3\x81\x97\xe3\x81\xbe\xe3\x81\x99\xe3\x80\x82 mixed \xe6\x96\x87\xe5\xad\x97"
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    char *icuDataDir = safeGetICUDataDirectory();
+    UBreakIterator *bi;
+    UText *ut = NULL;
+    int32_t pass, i;
 
+    ctest_resetICU();
+    u_cleanup();
+    u_setMemoryFunctions(&gContext, myMemAlloc, myMemRealloc, myMemFree, &status);
+    TEST_STATUS(status, U_ZERO_ERROR);
+    u_setDataDirectory(icuDataDir);
+
+    bi = ubrk_open(UBRK_LINE, "ja@lw=phrase", NULL, 0, &status);
+    if (U_FAILURE(status)) {
+        log_data_err("ubrk_open(UBRK_LINE) failed: %s\n", u_errorName(status));
+    } else {
+        /* The first pass loads data and grows the buffers. */
+        for (pass = 0; pass < 2 && U_SUCCESS(status); ++pass) {
+            gBlockCount = 0;
+            for (i = 0; i < UPRV_LENGTHOF(texts); ++i) {
+                ut = utext_openUTF8(ut, texts[i], -1, &status);
+                ubrk_setUText(bi, ut, &status);
+                while (ubrk_next(bi) != UBRK_DONE) {}
+            }
+            TEST_STATUS(status, U_ZERO_ERROR);
+        }
+        if (gBlockCount != 0) {
+            log_err("Reused line break iterator allocated memory %d times.\n", gBlockCount);
+        }
+    }
+    utext_close(ut);
+    ubrk_close(bi);
+    free(icuDataDir);
+
+    ctest_resetICU();
+}
+#endif
@@ -853,6 +853,42 @@ static void TestNewConvertWithBufferSizes(int32_t outsize, int32_t insize )
 
     }
 
+    log_verbose("Test ASCII runs for UTF8\n");
+    {
+        /* ASCII runs longer than one vector, between multi-byte sequences */
+        static const UChar asciiRuns[]={
+            0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039,
+            0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006a,
+            0x00e9, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049,
+            0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 0x0050, 0x0051, 0x0052, 0x4e2d,
+            0xd83d, 0xde00, 0x0078, 0x0079, 0x007a
+        };
+        static const uint8_t expectedUTF8ASCIIRuns[]={
+            0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x61, 0x62,
+            0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0xc3, 0xa9, 0x41, 0x42,
+            0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e,
+            0x4f, 0x50, 0x51, 0x52, 0xe4, 0xb8, 0xad, 0xf0, 0x9f, 0x98, 0x80, 0x78,
+            0x79, 0x7a
+        };
+        static const int32_t toUTF8ASCIIRunsOffs[]={
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+            16, 17, 18, 19, 20, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+            31, 32, 33, 34, 35, 36, 37, 38, 39, 39, 39, 40, 40, 40, 40, 42,
+            43, 44
+        };
+        static const int32_t fmUTF8ASCIIRunsOffs[]={
+            0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+            16, 17, 18, 19, 20, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32,
+            33, 34, 35, 36, 37, 38, 39, 40, 43, 43, 47, 48, 49
+        };
+        testConvertFromU(asciiRuns, UPRV_LENGTHOF(asciiRuns),
+                         expectedUTF8ASCIIRuns, sizeof(expectedUTF8ASCIIRuns), "UTF8",
+                         toUTF8ASCIIRunsOffs, false);
+        testConvertToU(expectedUTF8ASCIIRuns, sizeof(expectedUTF8ASCIIRuns),
+                       asciiRuns, UPRV_LENGTHOF(asciiRuns), "UTF8",
+                       fmUTF8ASCIIRunsOffs, false);
+    }
+
 #if !UCONFIG_NO_LEGACY_CONVERSION && defined(U_ENABLE_GENERIC_ISO_2022)
     /*ISO-2022*/
     testConvertFromU(sampleText, UPRV_LENGTHOF(sampleText),
@@ -658,6 +658,37 @@ static UBool assertEqualWithAttribute(const SearchData            search,
     return true;
 }
 
+static UBool assertEqualWithSkipTable(const SearchData            search,
+                                            USearchAttributeValue overlap)
+{
+    UErrorCode      status      = U_ZERO_ERROR;
+    UChar           pattern[32];
+    UChar           text[128];
+    UCollator      *collator = getCollator(search.collator);
+    UBreakIterator *breaker  = getBreakIterator(search.breaker);
+    UStringSearch  *strsrch; 
+    UBool           result;
+    
+    CHECK_BREAK_BOOL(search.breaker);
+    u_unescape(search.text, text, 128);
+    u_unescape(search.pattern, pattern, 32);
+    ucol_setStrength(collator, search.strength);
+    strsrch = usearch_openFromCollator(pattern, -1, text, -1, collator, 
+                                       breaker, &status);
+    usearch_setAttribute(strsrch, USEARCH_SKIP_TABLE, USEARCH_ON, &status);
+    usearch_setAttribute(strsrch, USEARCH_OVERLAP, overlap, &status);
+    
+    if (U_FAILURE(status)) {
+        log_err("Error opening string search %s\n", u_errorName(status));
+        return false;
+    }   
+    
+    result = assertEqualWithUStringSearch(strsrch, search);
+    ucol_setStrength(collator, UCOL_TERTIARY);
+    usearch_close(strsrch);
+    return result;
+}
+
 static void TestBasic(void) 
 {
     int count = 0;
@@ -3055,6 +3086,214 @@ static void TestIndicPrefixMatch(void)
     close();
 }
 
+/* Returns the UTF-8 length of the first length16 code units of s. */
+static int32_t getUTF8Offset(const UChar *s, int32_t length16) {
+    int32_t length8 = 0;
+    UErrorCode status = U_ZERO_ERROR;
+    u_strToUTF8(NULL, 0, &length8, s, length16, &status);
+    return length8;
+}
+
+static void TestSearchUTF8(void)
+{
+    static const struct {
+        const char *locale;
+        UCollationStrength strength;
+        UBool overlap;
+        const char *pattern;
+        const char *text;
+    } cases[] = {
+        { "en", UCOL_TERTIARY, false, "fox", "the quick brown fox jumps over the lazy fox" },
+        { "en", UCOL_PRIMARY, false, "resume", "R\\u00E9sum\\u00E9, resume, re\\u0301sume\\u0301, RESUME" },
+        { "en", UCOL_SECONDARY, false, "\\u00E5", "a\\u030A A\\u030A \\u00E5 \\u212B a\\u0301\\u030A \\u00E5" },
+        { "en", UCOL_TERTIARY, true, "aa", "aaaa \\u00E4\\u00E4aa" },
+        { "de", UCOL_PRIMARY, true, "\\u00DF", "Stra\\u00DFe STRASSE stra\\u00DFe" },
+        { "ja", UCOL_TERTIARY, false, "\\u3042", "\\u3042\\u3044\\u3046 \\U0002070E\\u3042 \\u3042\\u3099" },
+        { "th", UCOL_PRIMARY, false, "\\u0E01", "\\u0E40\\u0E01\\u0E01\\u0E01\\u0E33 \\u0E01" },
+        { "root", UCOL_TERTIARY, false, "\\U0001F600", "x\\U0001F600y\\U0001F600\\U0001F600" }
+    };
+    int32_t i;
+    for (i = 0; i < UPRV_LENGTHOF(cases); ++i) {
+        UErrorCode status = U_ZERO_ERROR;
+        UChar pattern[64], text[128], matched[64], matched8[64];
+        char text8[256];
+        int32_t patternLength = u_unescape(cases[i].pattern, pattern, UPRV_LENGTHOF(pattern));
+        int32_t textLength = u_unescape(cases[i].text, text, UPRV_LENGTHOF(text));
+        int32_t text8Length, length;
+        UStringSearch *search16, *search8;
+        int32_t pass;
+        u_strToUTF8(text8, UPRV_LENGTHOF(text8), &text8Length, text, textLength, &status);
+        search16 = usearch_open(pattern, patternLength, text, textLength,
+                                cases[i].locale, NULL, &status);
+        search8 = usearch_open(pattern, patternLength, text, textLength,
+                               cases[i].locale, NULL, &status);
+        if (U_FAILURE(status)) {
+            log_err_status(status, "case %d: usearch_open failed - %s\n", i, u_errorName(status));
+            usearch_close(search16);
+            usearch_close(search8);
+            continue;
+        }
+        ucol_setStrength(usearch_getCollator(search16), cases[i].strength);
+        ucol_setStrength(usearch_getCollator(search8), cases[i].strength);
+        usearch_reset(search16);
+        usearch_setAttribute(search16, USEARCH_OVERLAP, cases[i].overlap ? USEARCH_ON : USEARCH_OFF, &status);
+        usearch_setAttribute(search8, USEARCH_OVERLAP, cases[i].overlap ? USEARCH_ON : USEARCH_OFF, &status);
+        usearch_setTextUTF8(search8, text8, -1, &status);
+        if (usearch_getText(search8, &length) != NULL || length != 0) {
+            log_err("case %d: usearch_getText() should return NULL for UTF-8 text\n", i);
+        }
+        /* Pass 0 searches forward, pass 1 backward, both UTF-16 and UTF-8 in lockstep. */
+        for (pass = 0; pass < 2 && U_SUCCESS(status); ++pass) {
+            int32_t count = 0;
+            for (;;) {
+                int32_t index16, index8, expected8;
+                if (pass == 0) {
+                    index16 = count == 0 ? usearch_first(search16, &status) : usearch_next(search16, &status);
+                    index8 = count == 0 ? usearch_first(search8, &status) : usearch_next(search8, &status);
+                } else {
+                    index16 = count == 0 ? usearch_last(search16, &status) : usearch_previous(search16, &status);
+                    index8 = count == 0 ? usearch_last(search8, &status) : usearch_previous(search8, &status);
+                }
+                if (U_FAILURE(status)) {
+                    log_err("case %d pass %d: search failed - %s\n", i, pass, u_errorName(status));
+                    break;
+                }
+                expected8 = index16 == USEARCH_DONE ? USEARCH_DONE : getUTF8Offset(text, index16);
+                if (index8 != expected8) {
+                    log_err("case %d pass %d match %d: UTF-8 match at %d, expected %d\n",
+                            i, pass, count, index8, expected8);
+                    break;
+                }
+                if (index16 == USEARCH_DONE) {
+                    if (count == 0) {
+                        log_err("case %d pass %d: no matches\n", i, pass);
+                    }
+                    break;
+                }
+                length = getUTF8Offset(text, index16 + usearch_getMatchedLength(search16)) - expected8;
+                if (usearch_getMatchedLength(search8) != length) {
+                    log_err("case %d pass %d match %d: UTF-8 match length %d, expected %d\n",
+                            i, pass, count, usearch_getMatchedLength(search8), length);
+                }
+                length = usearch_getMatchedText(search16, matched, UPRV_LENGTHOF(matched), &status);
+                if (usearch_getMatchedText(search8, matched8, UPRV_LENGTHOF(matched8), &status) != length ||
+                        u_strcmp(matched, matched8) != 0) {
+                    log_err("case %d pass %d match %d: wrong UTF-8 matched text\n", i, pass, count);
+                }
+                ++count;
+            }
+        }
+        usearch_close(search16);
+        usearch_close(search8);
+    }
+}
+
+static void TestSkipTable(void)
+{
+    static const SearchData *const exact[] = {
+        BASIC, STRENGTH, NONOVERLAP, COMPOSITEBOUNDARIES, SUPPLEMENTARY, INDICPREFIXMATCH
+    };
+    static const char *const words[] = {
+        "lorem", "ipsum", "dolor", "d\\u00F6lor", "sit", "amet", "Amet", "ame\\u0301t",
+        "\\u00E6", "ae", "\\U0001D400", "-", " ", "dolor sit amet"
+    };
+    UErrorCode status = U_ZERO_ERROR;
+    UChar pattern[32];
+    UChar text[4096];
+    int32_t textLength = 0;
+    int32_t i, count;
+    uint32_t random = 1;
+    UStringSearch *linear, *skipping;
+    UCollationStrength strength;
+
+    open(&status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "Unable to open static collators %s\n", u_errorName(status));
+        return;
+    }
+    /* Same matches as for the data-driven tests without skip tables. */
+    for (i = 0; i < UPRV_LENGTHOF(exact); ++i) {
+        for (count = 0; exact[i][count].text != NULL; ++count) {
+            if (!assertEqualWithSkipTable(exact[i][count], USEARCH_OFF)) {
+                log_err("Error at test set %d number %d\n", i, count);
+            }
+        }
+    }
+    for (count = 0; OVERLAP[count].text != NULL; ++count) {
+        if (!assertEqualWithSkipTable(OVERLAP[count], USEARCH_ON)) {
+            log_err("Error at overlap test number %d\n", count);
+        }
+    }
+    close();
+
+    /* Same matches as a linear search over a longer text, forward and backward. */
+    while (textLength < UPRV_LENGTHOF(text) - 32) {
+        random = random * 1103515245 + 12345;
+        i = (int32_t)((random >> 16) % UPRV_LENGTHOF(words));
+        textLength += u_unescape(words[i], text + textLength, UPRV_LENGTHOF(text) - textLength);
+        text[textLength++] = (random & 0x100) ? 0x20 : 0x2c;
+    }
+    u_unescape("dolor sit ame", pattern, UPRV_LENGTHOF(pattern));
+    linear = usearch_open(pattern, -1, text, textLength, "en", NULL, &status);
+    skipping = usearch_open(pattern, -1, text, textLength, "en", NULL, &status);
+    if (U_FAILURE(status)) {
+        log_err_status(status, "Error opening string search %s\n", u_errorName(status));
+        usearch_close(linear);
+        usearch_close(skipping);
+        return;
+    }
+    if (usearch_getAttribute(skipping, USEARCH_SKIP_TABLE) != USEARCH_OFF) {
+        log_err("USEARCH_SKIP_TABLE should be off by default\n");
+    }
+    usearch_setAttribute(skipping, USEARCH_SKIP_TABLE, USEARCH_ON, &status);
+    if (usearch_getAttribute(skipping, USEARCH_SKIP_TABLE) != USEARCH_ON) {
+        log_err("USEARCH_SKIP_TABLE should be on\n");
+    }
+    for (strength = UCOL_PRIMARY; strength <= UCOL_TERTIARY; ++strength) {
+        int32_t matches = 0;
+        ucol_setStrength(usearch_getCollator(linear), strength);
+        ucol_setStrength(usearch_getCollator(skipping), strength);
+        usearch_reset(linear);
+        usearch_reset(skipping);
+        usearch_setAttribute(skipping, USEARCH_SKIP_TABLE, USEARCH_ON, &status);
+        for (i = usearch_first(linear, &status); ; i = usearch_next(linear, &status)) {
+            int32_t j = matches == 0 ? usearch_first(skipping, &status) : usearch_next(skipping, &status);
+            if (U_FAILURE(status) || i != j ||
+                    usearch_getMatchedLength(linear) != usearch_getMatchedLength(skipping)) {
+                log_err("strength %d forward match %d: %d with skip table, %d without - %s\n",
+                        strength, matches, j, i, u_errorName(status));
+                break;
+            }
+            if (i == USEARCH_DONE) {
+                break;
+            }
+            ++matches;
+        }
+        log_verbose("strength %d: %d matches\n", strength, matches);
+        if (matches == 0) {
+            log_err("strength %d: no matches\n", strength);
+        }
+        for (i = usearch_last(linear, &status), count = 0; ; i = usearch_previous(linear, &status)) {
+            int32_t j = count == 0 ? usearch_last(skipping, &status) : usearch_previous(skipping, &status);
+            if (U_FAILURE(status) || i != j ||
+                    usearch_getMatchedLength(linear) != usearch_getMatchedLength(skipping)) {
+                log_err("strength %d backward match %d: %d with skip table, %d without - %s\n",
+                        strength, count, j, i, u_errorName(status));
+                break;
+            }
+            if (i == USEARCH_DONE) {
+                break;
+            }
+            ++count;
+        }
+        if (count != matches) {
+            log_err("strength %d: %d matches backward, %d forward\n", strength, count, matches);
+        }
+    }
+    usearch_close(linear);
+    usearch_close(skipping);
+}
+
 /**
 * addSearchTest
 */
@@ -3107,6 +3346,7 @@ void addSearchTest(TestNode** root)
                                "tscoll/usrchtst/TestSupplementaryCanonical");
     addTest(root, &TestContractionCanonical, 
                                  "tscoll/usrchtst/TestContractionCanonical");
+    addTest(root, &TestSkipTable, "tscoll/usrchtst/TestSkipTable");
     addTest(root, &TestEnd, "tscoll/usrchtst/TestEnd");
     addTest(root, &TestNumeric, "tscoll/usrchtst/TestNumeric");
     addTest(root, &TestDiacriticMatch, "tscoll/usrchtst/TestDiacriticMatch");
@@ -3119,6 +3359,7 @@ void addSearchTest(TestNode** root)
     addTest(root, &TestMatchFollowedByIgnorables, "tscoll/usrchtst/TestMatchFollowedByIgnorables");
     addTest(root, &TestIndicPrefixMatch, "tscoll/usrchtst/TestIndicPrefixMatch");
     addTest(root, &TestUInt16Overflow, "tscoll/usrchtst/TestUInt16Overflow");
+    addTest(root, &TestSearchUTF8, "tscoll/usrchtst/TestSearchUTF8");
 }
 
 #endif /* #if !UCONFIG_NO_COLLATION */
@@ -2299,6 +2299,27 @@ void CollationAPITest::TestSubclass()
     if(col1.compare(a.getBuffer(), a.length(), b.getBuffer(), b.length()) != result) {
       errln("Collator doesn't give default result");
     }
+
+    // ucol_getSortKeys() on a non-RuleBasedCollator
+    const UChar *sources[2] = { abc.getBuffer(), bcd.getBuffer() };
+    int32_t lengths[2] = { 3, 3 };
+    uint8_t keys[20];
+    int32_t offsets[3];
+    status = U_ZERO_ERROR;
+    int32_t keysLength = ucol_getSortKeys(col1.toUCollator(), sources, lengths, 2,
+                                          keys, UPRV_LENGTHOF(keys), offsets, &status);
+    if(U_FAILURE(status) || keysLength != 6 || offsets[1] != 3 || offsets[2] != 6 ||
+            uprv_memcmp(keys, "abcbcd", 6) != 0) {
+        errln("TestCollator ucol_getSortKeys() failed - %s", u_errorName(status));
+    }
+    sources[1] = NULL;
+    status = U_ZERO_ERROR;
+    ucol_getSortKeys(col1.toUCollator(), sources, lengths, 2,
+                     keys, UPRV_LENGTHOF(keys), offsets, &status);
+    if(status != U_ILLEGAL_ARGUMENT_ERROR) {
+        errln("TestCollator ucol_getSortKeys(NULL source with length 3) should fail - %s",
+              u_errorName(status));
+    }
 }
 
 void CollationAPITest::TestNULLCharTailoring()
@@ -32,12 +32,14 @@
 #include "charstr.h"
 #include "cmemory.h"
 #include "collation.h"
+#include "collationcompare.h"
 #include "collationdata.h"
 #include "collationfcd.h"
 #include "collationiterator.h"
 #include "collationroot.h"
 #include "collationrootelements.h"
 #include "collationruleparser.h"
+#include "collationsettings.h"
 #include "collationweights.h"
 #include "cstring.h"
 #include "intltest.h"
@@ -80,6 +82,8 @@ class CollationTest : public IntlTest {
     void TestDataDriven();
     void TestLongLocale();
     void TestBuilderContextsOverflow();
+    void TestCompareSimple();
+    void TestLongEqualPrefix();
 
 private:
     void checkFCD(const char *name, CollationIterator &ci, CodePointIterator &cpi);
@@ -152,6 +156,8 @@ void CollationTest::runIndexedTest(int32_t index, UBool exec, const char *&name,
     TESTCASE_AUTO(TestDataDriven);
     TESTCASE_AUTO(TestLongLocale);
     TESTCASE_AUTO(TestBuilderContextsOverflow);
+    TESTCASE_AUTO(TestCompareSimple);
+    TESTCASE_AUTO(TestLongEqualPrefix);
     TESTCASE_AUTO_END;
 }
 
@@ -1907,4 +1913,152 @@ void CollationTest::TestBuilderContextsOverflow() {
     }
 }
 
+void CollationTest::TestCompareSimple() {
+    IcuTestErrorCode errorCode(*this, "TestCompareSimple");
+    // Greek & Cyrillic text, with expansions (\u0439, \u0451), digits, spaces,
+    // combining marks and other characters which need the CollationIterator.
+    static const char16_t *strings[] = {
+        u"", u"\u0430", u"\u0410", u"\u0430\u0431", u"\u0410\u0431",
+        u"\u0418\u0432\u0430\u043D\u043E\u0432", u"\u0438\u0432\u0430\u043D\u043E\u0432",
+        u"\u0421\u0435\u0440\u0433\u0435\u0439", u"\u0421\u0435\u0440\u0433\u0435\u0438",
+        u"\u0421\u0435\u0440\u0433\u0435\u0438\u0306", u"\u0421\u0435\u0440\u0433\u0435\u0439 2",
+        u"\u0421\u0435\u0440\u0433\u0435\u0439 10", u"\u0421\u0435\u0440\u0433\u0435\u0439-10",
+        u"\u0424\u0451\u0434\u043E\u0440", u"\u0424\u0435\u0434\u043E\u0440",
+        u"\u0424\u0435\u0308\u0434\u043E\u0440", u"\u0424\u0401\u0434\u043E\u0440",
+        u"\u0391\u03B8\u03AE\u03BD\u03B1", u"\u0391\u03B8\u03B7\u0301\u03BD\u03B1",
+        u"\u03B1\u03B8\u03B7\u03BD\u03B1", u"\u0391\u0398\u0397\u039D\u0391",
+        u"\u1F00\u03B8\u03B7\u03BD\u1FB3", u"\u03B1\u0313\u03B8\u03B7\u03BD\u03B1\u0345",
+        u"\u0430b", u"ab", u"\u0430\u4E00", u"\u0430\uAC00", u"\u0430\U0001D400",
+        u"\u0430\u00A0\u0431"
+    };
+    static const struct {
+        UColAttribute attr;
+        UColAttributeValue value;
+    } options[] = {
+        { UCOL_STRENGTH, UCOL_DEFAULT },
+        { UCOL_STRENGTH, UCOL_PRIMARY },
+        { UCOL_STRENGTH, UCOL_SECONDARY },
+        { UCOL_STRENGTH, UCOL_QUATERNARY },
+        { UCOL_CASE_FIRST, UCOL_UPPER_FIRST },
+        { UCOL_CASE_FIRST, UCOL_LOWER_FIRST },
+        { UCOL_CASE_LEVEL, UCOL_ON },
+        { UCOL_ALTERNATE_HANDLING, UCOL_SHIFTED },
+        { UCOL_FRENCH_COLLATION, UCOL_ON },
+        { UCOL_NUMERIC_COLLATION, UCOL_ON }
+    };
+    static const int32_t reorderCodes[] = { USCRIPT_CYRILLIC, USCRIPT_GREEK };
+
+    setRootCollator(errorCode);
+    if(errorCode.isFailure()) {
+        errorCode.reset();
+        return;
+    }
+    RuleBasedCollator *rbc = dynamic_cast<RuleBasedCollator *>(coll);
+    if(rbc == NULL) {
+        errln("the root collator is not a RuleBasedCollator");
+        return;
+    }
+
+    // A plain Cyrillic comparison must not need the CollationIterator.
+    const CollationData *data = CollationRoot::getData(errorCode);
+    const CollationSettings *settings = CollationRoot::getSettings(errorCode);
+    if(errorCode.errDataIfFailureAndReset("CollationRoot::getData()")) {
+        return;
+    }
+    UnicodeString a(strings[5]), b(strings[7]);
+    if(CollationCompare::compareSimpleUTF16(data, *settings, a.getBuffer(), a.length(),
+                                            b.getBuffer(), b.length()) != UCOL_LESS) {
+        errln("CollationCompare::compareSimpleUTF16(Cyrillic) did not return UCOL_LESS");
+    }
+
+    for(int32_t reorder = 0; reorder <= 1; ++reorder) {
+        for(int32_t o = 0; o < UPRV_LENGTHOF(options); ++o) {
+            LocalPointer<Collator> c(coll->clone());
+            if(reorder) {
+                c->setReorderCodes(reorderCodes, UPRV_LENGTHOF(reorderCodes), errorCode);
+            }
+            c->setAttribute(options[o].attr, options[o].value, errorCode);
+            if(errorCode.errIfFailureAndReset("setAttribute() failed")) {
+                return;
+            }
+            for(int32_t i = 0; i < UPRV_LENGTHOF(strings); ++i) {
+                UnicodeString si(strings[i]);
+                CollationKey ki;
+                c->getCollationKey(si, ki, errorCode);
+                std::string si8;
+                si.toUTF8String(si8);
+                for(int32_t j = 0; j < UPRV_LENGTHOF(strings); ++j) {
+                    UnicodeString sj(strings[j]);
+                    CollationKey kj;
+                    c->getCollationKey(sj, kj, errorCode);
+                    std::string sj8;
+                    sj.toUTF8String(sj8);
+                    UCollationResult expected = ki.compareTo(kj, errorCode);
+                    UCollationResult actual = c->compare(si, sj, errorCode);
+                    UCollationResult actual8 = c->compareUTF8(si8, sj8, errorCode);
+                    if(errorCode.errIfFailureAndReset("compare() failed")) {
+                        return;
+                    }
+                    if(actual != expected || actual8 != expected) {
+                        errln(UnicodeString(u"compare(") + si + u", " + sj +
+                              u") differs from the sort key order with option " + o +
+                              u" reorder " + reorder + u": " + actual + u"/" + actual8 +
+                              u" vs. " + expected);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void CollationTest::TestLongEqualPrefix() {
+    IcuTestErrorCode errorCode(*this, "TestLongEqualPrefix");
+    // Pairs of suffixes that start with unsafe-backward characters,
+    // so that the comparison must back up into the identical prefix:
+    // a contraction, combining marks below and above U+0800, and numeric digits.
+    static const char16_t *suffixes[][2] = {
+        { u"ch", u"cz" },
+        { u"ch", u"c" },
+        { u"a\u0308", u"a\u0301" },
+        { u"\u00E4", u"a\u0308b" },
+        { u"\u0915\u093C", u"\u0915\u093F" },
+        { u"12", u"9" },
+        { u"\U00010400", u"\U00010428" }
+    };
+    RuleBasedCollator c(u"&c<ch", errorCode);
+    if(errorCode.errDataIfFailureAndReset("RuleBasedCollator(&c<ch)")) {
+        return;
+    }
+    c.setAttribute(UCOL_NUMERIC_COLLATION, UCOL_ON, errorCode);
+    // Prefix lengths around the vector widths.
+    UnicodeString prefix;
+    for(int32_t length = 0; length <= 40; ++length) {
+        for(int32_t i = 0; i < UPRV_LENGTHOF(suffixes); ++i) {
+            UnicodeString a = prefix + suffixes[i][0];
+            UnicodeString b = prefix + suffixes[i][1];
+            CollationKey ka, kb;
+            c.getCollationKey(a, ka, errorCode);
+            c.getCollationKey(b, kb, errorCode);
+            UCollationResult expected = ka.compareTo(kb, errorCode);
+            std::string a8, b8;
+            a.toUTF8String(a8);
+            b.toUTF8String(b8);
+            UCollationResult actual = c.compare(a, b, errorCode);
+            UCollationResult actualNUL = c.compare(a.getTerminatedBuffer(), -1,
+                                                   b.getTerminatedBuffer(), -1, errorCode);
+            UCollationResult actual8 = c.compareUTF8(a8, b8, errorCode);
+            if(errorCode.errIfFailureAndReset("compare()")) {
+                return;
+            }
+            if(expected == UCOL_EQUAL ||
+                    actual != expected || actualNUL != expected || actual8 != expected) {
+                errln(UnicodeString(u"compare(") + a + u", " + b +
+                      u") differs from the sort key order: " + actual + u"/" + actualNUL +
+                      u"/" + actual8 + u" vs. " + expected);
+            }
+        }
+        prefix.append((char16_t)(u'a' + length % 26));
+    }
+}
+
 #endif  // !UCONFIG_NO_COLLATION
@@ -10,6 +10,8 @@
 
 #if !UCONFIG_NO_COLLATION
 
+#include <string>
+
 #include "unicode/coll.h"
 #include "unicode/tblcoll.h"
 #include "unicode/unistr.h"
@@ -18,6 +20,7 @@
 #include "unicode/schriter.h"
 #include "unicode/chariter.h"
 #include "unicode/uchar.h"
+#include "unicode/utf8.h"
 #include "cmemory.h"
 
 static UErrorCode status = U_ZERO_ERROR;
@@ -651,6 +654,78 @@ UnicodeString &CollationIteratorTest::orderString(CollationElementIterator &iter
     return target;
 }
 
+/**
+ * Test for setUTF8Text(): Same CEs as for the UTF-16 text, with UTF-8 offsets.
+ */
+void CollationIteratorTest::TestSetUTF8Text()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    // Non-ASCII, a supplementary code point, a contraction in Thai,
+    // and text that is not FCD.
+    UnicodeString text(
+        u"R\u00E9sum\u00E9 \U0001F600 \u0E40\u0E01\u0E33 a\u0301\u0327 \u0F73 ch");
+    std::string text8;
+    text.toUTF8String(text8);
+    for (int32_t normalization = 0; normalization <= 1; ++normalization) {
+        LocalPointer<RuleBasedCollator> coll(en_us->clone());
+        coll->setAttribute(UCOL_NORMALIZATION_MODE, normalization ? UCOL_ON : UCOL_OFF, status);
+        LocalPointer<CollationElementIterator> iter16(coll->createCollationElementIterator(text));
+        LocalPointer<CollationElementIterator> iter8(coll->createCollationElementIterator(UnicodeString()));
+        if (!assertSuccess("create iterators", status)) { return; }
+        iter8->setUTF8Text(text8.data(), (int32_t)text8.length(), status);
+        assertSuccess("setUTF8Text", status);
+        // Forward and backward, with each offset mapped to UTF-8.
+        for (int32_t backward = 0; backward <= 1; ++backward) {
+            int32_t count = 0;
+            int32_t order16, order8;
+            iter16->reset();
+            iter8->reset();
+            do {
+                order16 = backward ? iter16->previous(status) : iter16->next(status);
+                order8 = backward ? iter8->previous(status) : iter8->next(status);
+                std::string prefix8;
+                text.tempSubString(0, iter16->getOffset()).toUTF8String(prefix8);
+                if (order8 != order16 || iter8->getOffset() != (int32_t)prefix8.length()) {
+                    errln("norm %d backward %d CE %d: UTF-8 0x%X at %d != UTF-16 0x%X at %d",
+                          normalization, backward, count,
+                          order8, iter8->getOffset(), order16, (int32_t)prefix8.length());
+                    break;
+                }
+                ++count;
+            } while (order16 != CollationElementIterator::NULLORDER);
+        }
+        // setOffset() at each code point boundary, and inside the supplementary code point.
+        int32_t offset16 = 0;
+        for (int32_t offset8 = 0; offset8 <= (int32_t)text8.length(); ++offset8) {
+            if (offset8 < (int32_t)text8.length() && U8_IS_TRAIL(text8[offset8])) {
+                continue;
+            }
+            iter16->setOffset(offset16, status);
+            iter8->setOffset(offset8, status);
+            std::string prefix8;
+            text.tempSubString(0, iter16->getOffset()).toUTF8String(prefix8);
+            if (iter8->getOffset() != (int32_t)prefix8.length() ||
+                    iter8->next(status) != iter16->next(status)) {
+                errln("norm %d setOffset(%d): different from UTF-16", normalization, offset8);
+            }
+            if (offset8 < (int32_t)text8.length()) {
+                offset16 += U16_LENGTH(text.char32At(offset16));
+            }
+        }
+        int32_t supplementary8 = (int32_t)text8.find("\xF0");
+        iter8->setOffset(supplementary8 + 2, status);
+        assertEquals("setOffset() inside a character", supplementary8, iter8->getOffset());
+        assertSuccess("setOffset", status);
+
+        // A copy iterates over the same UTF-8 text.
+        iter8->reset();
+        iter8->next(status);
+        CollationElementIterator copy(*iter8);
+        assertTrue("copy == original", copy == *iter8);
+        assertEqual(copy, *iter8);
+    }
+}
+
 void CollationIteratorTest::assertEqual(CollationElementIterator &i1, CollationElementIterator &i2)
 {
     int32_t c1, c2, count = 0;
@@ -691,6 +766,7 @@ void CollationIteratorTest::runIndexedTest(int32_t index, UBool exec, const char
           case  6: name = "TestAssignment";    if (exec) TestAssignment(/* par */);    break;
           case  7: name = "TestConstructors";  if (exec) TestConstructors(/* par */); break;
           case  8: name = "TestStrengthOrder"; if (exec) TestStrengthOrder(/* par */); break;
+          case  9: name = "TestSetUTF8Text";   if (exec) TestSetUTF8Text(); break;
           default: name = ""; break;
       }
     } else {
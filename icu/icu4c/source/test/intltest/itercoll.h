@@ -84,6 +84,11 @@ class CollationIteratorTest: public IntlTestCollator
     * Testing the strength order functionality
     */
     void TestStrengthOrder();
+
+    /**
+    * Testing iteration over UTF-8 text
+    */
+    void TestSetUTF8Text();
     
     //------------------------------------------------------------------------
     // Internal utilities
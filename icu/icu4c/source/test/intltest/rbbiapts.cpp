@@ -27,6 +27,7 @@
 #include "cmemory.h"
 #if !UCONFIG_NO_BREAK_ITERATION
 #include "unicode/filteredbrk.h"
+#include <algorithm>
 #include <stdio.h> // for snprintf
 #endif
 /**
@@ -1409,6 +1410,405 @@ void RBBIAPITest::TestFilteredBreakIteratorBuilder() {
 #endif
 }
 
+void RBBIAPITest::TestFillBoundaries() {
+    // Word boundaries in mixed text, with Thai and Japanese for the dictionary break engines,
+    //   and line and character boundaries.
+    UnicodeString text(
+        u"Hello, world! The quick (\"brown\") fox can't jump 32.3 feet, right? "
+        u"\u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22 "
+        u"\u65E5\u672C\u8A9E\u306E\u6587\u7AE0\u3092\u5206\u5272\u3057\u307E\u3059\u3002 "
+        u"\U0001F468\u200D\U0001F469\u200D\U0001F467 e\u0301 end.");
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> iters[3] = {
+        LocalPointer<BreakIterator>(BreakIterator::createWordInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createLineInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createCharacterInstance(Locale::getEnglish(), status))
+    };
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d Failure creating break iterators - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    static const int32_t capacities[] = { 1, 2, 3, 7, 1000 };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(iters); ++i) {
+        RuleBasedBreakIterator *bi = dynamic_cast<RuleBasedBreakIterator *>(iters[i].getAlias());
+        assertTrue(WHERE, bi != nullptr);
+        if (bi == nullptr) {
+            continue;
+        }
+        // The expected results, from next().
+        bi->setText(text);
+        int32_t expected[200];
+        int32_t expectedStatuses[200];
+        int32_t expectedLength = 0;
+        for (int32_t pos = bi->next(); pos != BreakIterator::DONE; pos = bi->next()) {
+            expected[expectedLength] = pos;
+            expectedStatuses[expectedLength++] = bi->getRuleStatus();
+        }
+
+        for (int32_t capacity : capacities) {
+            for (int32_t startIndex = 0; startIndex < 3; ++startIndex) {
+                // Start from the beginning of the text, and from boundaries that are
+                // in the break cache after next(), with and without a fresh setText().
+                bi->setText(text);
+                bi->first();
+                for (int32_t j = 0; j < startIndex; ++j) {
+                    bi->next();
+                }
+                int32_t boundaries[1000];
+                int32_t statuses[1000];
+                int32_t index = startIndex;
+                int32_t length;
+                while ((length = bi->fillBoundaries(boundaries, statuses, capacity, status)) > 0) {
+                    if (!assertSuccess(WHERE, status) ||
+                            !assertTrue(WHERE, length <= capacity && index + length <= expectedLength)) {
+                        return;
+                    }
+                    for (int32_t j = 0; j < length; ++j, ++index) {
+                        if (boundaries[j] != expected[index] || statuses[j] != expectedStatuses[index]) {
+                            errln("%s:%d iterator %d capacity %d boundary #%d: expected %d status %d, got %d status %d",
+                                  __FILE__, __LINE__, i, capacity, index,
+                                  expected[index], expectedStatuses[index], boundaries[j], statuses[j]);
+                            return;
+                        }
+                    }
+                    // The iterator is left at the last boundary.
+                    assertEquals(WHERE, boundaries[length - 1], bi->current());
+                    assertEquals(WHERE, statuses[length - 1], bi->getRuleStatus());
+                }
+                assertEquals(WHERE, expectedLength, index);
+                assertEquals(WHERE, BreakIterator::DONE, bi->next());
+            }
+        }
+
+        // Mixing fillBoundaries() with regular iteration.
+        bi->setText(text);
+        int32_t boundaries[4];
+        assertEquals(WHERE, 4, bi->fillBoundaries(boundaries, nullptr, 4, status));
+        assertEquals(WHERE, expected[4], bi->next());
+        assertEquals(WHERE, expected[2], bi->preceding(expected[3]));
+        assertEquals(WHERE, 1, bi->fillBoundaries(boundaries, nullptr, 1, status));
+        assertEquals(WHERE, expected[3], boundaries[0]);
+        assertEquals(WHERE, expected[expectedLength - 1], bi->last());
+        assertEquals(WHERE, 0, bi->fillBoundaries(boundaries, nullptr, 4, status));
+        assertEquals(WHERE, 0, bi->fillBoundaries(nullptr, nullptr, 0, status));
+        assertSuccess(WHERE, status);
+
+        bi->fillBoundaries(nullptr, nullptr, 4, status);
+        assertEquals(WHERE, U_ILLEGAL_ARGUMENT_ERROR, status);
+        status = U_ZERO_ERROR;
+    }
+}
+
+void RBBIAPITest::TestGetAllBoundaries() {
+    // A text that is long enough for several threads, with runs of Thai text
+    // that the chunk boundaries may fall into.
+    static const char16_t *pieces[] = {
+        u"Hello, world! ", u"The quick (\"brown\") fox can't jump 32.3 feet, right? ",
+        u"\u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22",
+        u"\u0E2A\u0E27\u0E31\u0E2A\u0E14\u0E35\u0E04\u0E23\u0E31\u0E1A",
+        u" ", u"Mr. Smith went to Washington. ", u"\n", u"e\u0301\U0001F468\u200D\U0001F469 ", u"1,000.5% "
+    };
+    UnicodeString text;
+    uint32_t seed = 1;
+    while (text.length() < 150000) {
+        seed = seed * 1103515245 + 12345;
+        text.append(pieces[(seed >> 16) % UPRV_LENGTHOF(pieces)]);
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> iters[4] = {
+        LocalPointer<BreakIterator>(BreakIterator::createWordInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createLineInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createSentenceInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createCharacterInstance(Locale::getEnglish(), status))
+    };
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d Failure creating break iterators - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    LocalUTextPointer ut(utext_openConstUnicodeString(nullptr, &text, &status));
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    LocalArray<int32_t> expected(new int32_t[text.length()]);
+    LocalArray<int32_t> expectedStatuses(new int32_t[text.length()]);
+    LocalArray<int32_t> boundaries(new int32_t[text.length()]);
+    LocalArray<int32_t> statuses(new int32_t[text.length()]);
+    static const int32_t numThreads[] = { 1, 2, 3, 7, 0 };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(iters); ++i) {
+        RuleBasedBreakIterator *bi = dynamic_cast<RuleBasedBreakIterator *>(iters[i].getAlias());
+        assertTrue(WHERE, bi != nullptr);
+        if (bi == nullptr) {
+            continue;
+        }
+        bi->setText(text);
+        int32_t expectedLength = 0;
+        for (int32_t pos = bi->next(); pos != BreakIterator::DONE; pos = bi->next()) {
+            expected[expectedLength] = pos;
+            expectedStatuses[expectedLength++] = bi->getRuleStatus();
+        }
+        // The iterator's own text and position are not used or changed.
+        UnicodeString other(u"abc");
+        bi->setText(other);
+        int32_t otherPosition = bi->following(0);
+
+        for (int32_t threads : numThreads) {
+            int32_t length = bi->getAllBoundaries(ut.getAlias(), boundaries.getAlias(), statuses.getAlias(),
+                                                  text.length(), threads, status);
+            if (!assertSuccess(WHERE, status) || !assertEquals(WHERE, expectedLength, length)) {
+                return;
+            }
+            for (int32_t j = 0; j < length; ++j) {
+                if (boundaries[j] != expected[j] || statuses[j] != expectedStatuses[j]) {
+                    errln("%s:%d iterator %d threads %d boundary #%d: expected %d status %d, got %d status %d",
+                          __FILE__, __LINE__, i, threads, j,
+                          expected[j], expectedStatuses[j], boundaries[j], statuses[j]);
+                    break;
+                }
+            }
+        }
+        assertEquals(WHERE, otherPosition, bi->current());
+
+        // Preflighting.
+        int32_t length = bi->getAllBoundaries(ut.getAlias(), nullptr, nullptr, 0, 3, status);
+        assertEquals(WHERE, U_BUFFER_OVERFLOW_ERROR, status);
+        assertEquals(WHERE, expectedLength, length);
+        status = U_ZERO_ERROR;
+        length = bi->getAllBoundaries(ut.getAlias(), boundaries.getAlias(), nullptr, 10, 3, status);
+        assertEquals(WHERE, U_BUFFER_OVERFLOW_ERROR, status);
+        assertEquals(WHERE, expectedLength, length);
+        assertEquals(WHERE, expected[9], boundaries[9]);
+        status = U_ZERO_ERROR;
+    }
+}
+
+void RBBIAPITest::TestCloneDictionaryEngines() {
+    // Thai, Khmer and Burmese for the dictionary break engines,
+    //   and Japanese which may or may not have one.
+    UnicodeString text(
+        u"Hello \u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22 "
+        u"\u1797\u17B6\u179F\u17B6\u1781\u17D2\u1798\u17C2\u179A "
+        u"\u1019\u103C\u1014\u103A\u1019\u102C\u1005\u1000\u102C\u1038 "
+        u"\u65E5\u672C\u8A9E\u306E\u6587\u7AE0 end.");
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> bi(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d Failure creating break iterator - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    // A clone made before the original found any engines.
+    LocalPointer<BreakIterator> unusedClone(bi->clone());
+    bi->setText(text);
+    int32_t expected[50];
+    int32_t expectedLength = 0;
+    for (int32_t pos = bi->next(); pos != BreakIterator::DONE; pos = bi->next()) {
+        expected[expectedLength++] = pos;
+    }
+
+    // Clones made after the original found its engines, a clone of a clone,
+    //   and an iterator assigned from the original.
+    LocalPointer<BreakIterator> clone(bi->clone());
+    LocalPointer<BreakIterator> cloneOfClone(clone->clone());
+    LocalPointer<BreakIterator> assigned(BreakIterator::createWordInstance(Locale::getEnglish(), status));
+    if (U_FAILURE(status) || !clone.isValid() || !cloneOfClone.isValid() || !unusedClone.isValid()) {
+        errln("%s:%d Failure creating break iterators - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    // The assignment replaces the engines that this iterator found itself.
+    assigned->setText(text);
+    while (assigned->next() != BreakIterator::DONE) {}
+    *dynamic_cast<RuleBasedBreakIterator *>(assigned.getAlias()) =
+        *dynamic_cast<RuleBasedBreakIterator *>(bi.getAlias());
+
+    BreakIterator *iters[] = {
+        unusedClone.getAlias(), clone.getAlias(), cloneOfClone.getAlias(), assigned.getAlias()
+    };
+    for (int32_t i = 0; i < UPRV_LENGTHOF(iters); ++i) {
+        BreakIterator *iter = iters[i];
+        // Twice, so that the second pass uses the engines found in the first one.
+        for (int32_t pass = 0; pass < 2; ++pass) {
+            iter->setText(text);
+            int32_t length = 0;
+            for (int32_t pos = iter->next(); pos != BreakIterator::DONE; pos = iter->next(), ++length) {
+                if (length >= expectedLength || pos != expected[length]) {
+                    errln("%s:%d iterator %d pass %d boundary #%d: got %d",
+                          __FILE__, __LINE__, i, pass, length, pos);
+                    break;
+                }
+            }
+            assertEquals(WHERE, expectedLength, length);
+        }
+    }
+}
+
+void RBBIAPITest::TestUpdateBoundaries() {
+    static const char16_t *pieces[] = {
+        u"Hello, world! ", u"The quick (\"brown\") fox can't jump 32.3 feet, right? ",
+        u"\u0E01\u0E32\u0E23\u0E17\u0E14\u0E25\u0E2D\u0E07\u0E20\u0E32\u0E29\u0E32\u0E44\u0E17\u0E22",
+        u"\u0E2A\u0E27\u0E31\u0E2A\u0E14\u0E35\u0E04\u0E23\u0E31\u0E1A",
+        u" ", u"Mr. Smith went to Washington. ", u"\r\n", u"e\u0301\U0001F468\u200D\U0001F469 ", u"1,000.5% ",
+        u"\u65E5\u672C\u8A9E\u306E\u6587\u7AE0\u3002"
+    };
+    // Replacement texts are short pieces of these.
+    static const char16_t insertions[] =
+        u"ab c.\u0E01\u0E32\u0E23 \u0E44\u0E17\u0E22? 12\r\n\u0301\u200D\U0001F469\u65E5\u3002\"'";
+    UnicodeString text;
+    uint32_t seed = 1;
+    while (text.length() < 3000) {
+        seed = seed * 1103515245 + 12345;
+        text.append(pieces[(seed >> 16) % UPRV_LENGTHOF(pieces)]);
+    }
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> iters[4] = {
+        LocalPointer<BreakIterator>(BreakIterator::createWordInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createLineInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createSentenceInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createCharacterInstance(Locale::getEnglish(), status))
+    };
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d Failure creating break iterators - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    constexpr int32_t CAPACITY = 5000;
+    LocalArray<int32_t> boundaries(new int32_t[CAPACITY]);
+    LocalArray<int32_t> statuses(new int32_t[CAPACITY]);
+    LocalArray<int32_t> expected(new int32_t[CAPACITY]);
+    LocalArray<int32_t> expectedStatuses(new int32_t[CAPACITY]);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(iters); ++i) {
+        RuleBasedBreakIterator *bi = dynamic_cast<RuleBasedBreakIterator *>(iters[i].getAlias());
+        LocalPointer<BreakIterator> reference(iters[i]->clone());
+        if (bi == nullptr || !reference.isValid()) {
+            errln("%s:%d iterator %d is not a RuleBasedBreakIterator", __FILE__, __LINE__, i);
+            continue;
+        }
+        UnicodeString oldText(text);
+        bi->setText(oldText);
+        bi->first();
+        int32_t length = bi->fillBoundaries(boundaries.getAlias(), statuses.getAlias(), CAPACITY, status);
+        for (int32_t edit = 0; edit < 300; ++edit) {
+            // Replace up to 20 code units with up to 8, sometimes at the start or end.
+            seed = seed * 1103515245 + 12345;
+            int32_t editStart = (seed >> 8) % (oldText.length() + 1);
+            if (edit % 50 == 1) {
+                editStart = 0;
+            } else if (edit % 50 == 2) {
+                editStart = oldText.length();
+            }
+            seed = seed * 1103515245 + 12345;
+            int32_t oldEditLimit = std::min(editStart + (int32_t)((seed >> 16) % 21), oldText.length());
+            seed = seed * 1103515245 + 12345;
+            int32_t insertionStart = (seed >> 8) % UPRV_LENGTHOF(insertions);
+            int32_t insertionLength = std::min((int32_t)((seed >> 20) % 9),
+                                               (int32_t)UPRV_LENGTHOF(insertions) - 1 - insertionStart);
+            UnicodeString newText(oldText);
+            newText.replace(editStart, oldEditLimit - editStart, insertions + insertionStart, insertionLength);
+            int32_t newEditLimit = editStart + insertionLength;
+
+            bi->setText(newText);
+            length = bi->updateBoundaries(editStart, oldEditLimit, newEditLimit,
+                                          boundaries.getAlias(), statuses.getAlias(),
+                                          length, CAPACITY, status);
+            if (!assertSuccess(WHERE, status)) {
+                return;
+            }
+            reference->setText(newText);
+            int32_t expectedLength = 0;
+            for (int32_t pos = reference->next(); pos != BreakIterator::DONE; pos = reference->next()) {
+                expected[expectedLength] = pos;
+                expectedStatuses[expectedLength++] = reference->getRuleStatus();
+            }
+            int32_t j = 0;
+            while (j < length && j < expectedLength &&
+                    boundaries[j] == expected[j] && statuses[j] == expectedStatuses[j]) {
+                ++j;
+            }
+            if (j < length || j < expectedLength) {
+                errln("%s:%d iterator %d edit %d [%d, %d[ -> [%d, %d[: boundary #%d: "
+                      "got %d status %d, expected %d status %d",
+                      __FILE__, __LINE__, i, edit, editStart, oldEditLimit, editStart, newEditLimit, j,
+                      j < length ? boundaries[j] : -1, j < length ? statuses[j] : -1,
+                      j < expectedLength ? expected[j] : -1, j < expectedLength ? expectedStatuses[j] : -1);
+                return;
+            }
+            oldText = newText;
+        }
+
+        // Too short arrays are not modified.
+        int32_t oldLength = length;
+        UnicodeString newText(oldText);
+        newText.insert(0, u"One. Two. ");
+        bi->setText(newText);
+        length = bi->updateBoundaries(0, 0, 10, boundaries.getAlias(), nullptr,
+                                      oldLength, oldLength, status);
+        assertEquals(WHERE, U_BUFFER_OVERFLOW_ERROR, status);
+        status = U_ZERO_ERROR;
+        assertTrue(WHERE, length > oldLength);
+        assertTrue(WHERE, uprv_memcmp(boundaries.getAlias(), expected.getAlias(), oldLength * 4) == 0);
+
+        // Errors.
+        length = bi->updateBoundaries(0, 5, 3, boundaries.getAlias(), nullptr,
+                                      oldLength, CAPACITY, status);
+        assertEquals(WHERE, U_ILLEGAL_ARGUMENT_ERROR, status);
+        status = U_ZERO_ERROR;
+    }
+}
+
+void RBBIAPITest::TestRulesCache() {
+    UnicodeString rules(u"$Letter = [\\p{L}];\n$Letter+ {200};\n[\\p{N}]+ {100};\n");
+    UnicodeString otherRules(rules);
+    otherRules.append(u"[\\p{P}] {300};\n");
+    UParseError parseError;
+    UErrorCode status = U_ZERO_ERROR;
+    RuleBasedBreakIterator bi1(rules, parseError, status);
+    parseError.line = 99;
+    parseError.offset = 99;
+    RuleBasedBreakIterator bi2(rules, parseError, status);
+    RuleBasedBreakIterator bi3(otherRules, parseError, status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    assertEquals(WHERE, 0, parseError.line);
+    assertEquals(WHERE, 0, parseError.offset);
+
+    uint32_t length1, length2, length3;
+    const uint8_t *binary1 = bi1.getBinaryRules(length1);
+    const uint8_t *binary2 = bi2.getBinaryRules(length2);
+    const uint8_t *binary3 = bi3.getBinaryRules(length3);
+    assertTrue(WHERE, binary1 == binary2);
+    assertTrue(WHERE, binary1 != binary3);
+    assertTrue(WHERE, bi1 == bi2);
+    assertTrue(WHERE, bi1 != bi3);
+
+    // The shared data outlives the iterator that compiled it.
+    otherRules.append(u"# not yet cached\n");
+    LocalPointer<RuleBasedBreakIterator> bi4(new RuleBasedBreakIterator(otherRules, parseError, status));
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    bi4.adoptInstead(nullptr);
+    LocalPointer<RuleBasedBreakIterator> bi5(new RuleBasedBreakIterator(otherRules, parseError, status));
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    bi5->setText(u"ab 12, cd");
+    static const int32_t expected[] = { 2, 3, 5, 6, 7, 9 };
+    static const int32_t expectedStatuses[] = { 200, 0, 100, 300, 0, 200 };
+    int32_t i = 0;
+    for (int32_t pos = bi5->next(); pos != BreakIterator::DONE && i < UPRV_LENGTHOF(expected);
+            pos = bi5->next(), ++i) {
+        assertEquals(WHERE, expected[i], pos);
+        assertEquals(WHERE, expectedStatuses[i], bi5->getRuleStatus());
+    }
+    assertEquals(WHERE, UPRV_LENGTHOF(expected), i);
+
+    // Syntax errors are not cached.
+    for (int32_t pass = 0; pass < 2; ++pass) {
+        status = U_ZERO_ERROR;
+        RuleBasedBreakIterator bad(UnicodeString(u"[\\p{L}]+;\nabc);"), parseError, status);
+        assertTrue(WHERE, U_FAILURE(status));
+        assertEquals(WHERE, 2, parseError.line);
+    }
+}
+
 //---------------------------------------------
 // runIndexedTest
 //---------------------------------------------
@@ -1436,6 +1836,13 @@ void RBBIAPITest::runIndexedTest( int32_t index, UBool exec, const char* &name,
     TESTCASE_AUTO(TestGetBinaryRules);
 #endif
     TESTCASE_AUTO(TestRefreshInputText);
+#if !UCONFIG_NO_FILE_IO
+    TESTCASE_AUTO(TestFillBoundaries);
+    TESTCASE_AUTO(TestGetAllBoundaries);
+    TESTCASE_AUTO(TestCloneDictionaryEngines);
+    TESTCASE_AUTO(TestUpdateBoundaries);
+    TESTCASE_AUTO(TestRulesCache);
+#endif
 #if !UCONFIG_NO_BREAK_ITERATION
     TESTCASE_AUTO(TestFilteredBreakIteratorBuilder);
 #endif
@@ -90,6 +90,32 @@ class RBBIAPITest: public IntlTest {
 
     void TestRefreshInputText();
 
+    /**
+     * Tests fillBoundaries() against repeated next() calls.
+     */
+    void TestFillBoundaries();
+
+    /**
+     * Tests getAllBoundaries() with several threads against next().
+     */
+    void TestGetAllBoundaries();
+
+    /**
+     * Tests that clones and assigned iterators, which share the dictionary
+     * break engines of the original, find the same boundaries.
+     */
+    void TestCloneDictionaryEngines();
+
+    /**
+     * Tests updateBoundaries() after random edits against next() on the whole text.
+     */
+    void TestUpdateBoundaries();
+
+    /**
+     * Tests that iterators built from the same rule string share the compiled rules.
+     */
+    void TestRulesCache();
+
     /**
      *Internal subroutines
      **/
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "unicode/brkiter.h"
+#include "unicode/graphemeiter.h"
 #include "unicode/localpointer.h"
 #include "unicode/numfmt.h"
 #include "unicode/rbbi.h"
@@ -32,6 +33,7 @@
 #endif
 #include "unicode/schriter.h"
 #include "unicode/uchar.h"
+#include "unicode/ucharstriebuilder.h"
 #include "unicode/utf16.h"
 #include "unicode/ucnv.h"
 #include "unicode/uniset.h"
@@ -44,6 +46,9 @@
 #include "cmemory.h"
 #include "cstr.h"
 #include "cstring.h"
+#include "dictbe.h"
+#include "dictionarydata.h"
+#include "doublearraybuilder.h"
 #include "intltest.h"
 #include "lstmbe.h"
 #include "rbbitst.h"
@@ -137,11 +142,15 @@ void RBBITest::runIndexedTest( int32_t index, UBool exec, const char* &name, cha
     TESTCASE_AUTO(Test16BitsTrieWith8BitStateTable);
     TESTCASE_AUTO(Test16BitsTrieWith16BitStateTable);
     TESTCASE_AUTO(TestTable_8_16_Bits);
+    TESTCASE_AUTO(TestLatin1Categories);
     TESTCASE_AUTO(TestBug13590);
     TESTCASE_AUTO(TestUnpairedSurrogate);
     TESTCASE_AUTO(TestLSTMThai);
     TESTCASE_AUTO(TestLSTMBurmese);
     TESTCASE_AUTO(TestRandomAccess);
+    TESTCASE_AUTO(TestDoubleArrayDictionary);
+    TESTCASE_AUTO(TestGraphemeClusterIterator);
+    TESTCASE_AUTO(TestBreakEngineScratch);
 
 #if U_ENABLE_TRACING
     TESTCASE_AUTO(TestTraceCreateCharacter);
@@ -1403,6 +1412,9 @@ void RBBITest::runUnicodeTestData(const char *fileName, RuleBasedBreakIterator *
             //   If the line from the file contained test data, run the test now.
             if (testString.length() > 0 && !testCaseIsKnownIssue(testString, fileName)) {
                 checkUnicodeTestCase(fileName, lineNumber, testString, &breakPositions, bi);
+                if (uprv_strcmp(fileName, "GraphemeBreakTest.txt") == 0) {
+                    checkGraphemeTestCase(lineNumber, testString, &breakPositions);
+                }
             }
 
             // Clear out this test case.
@@ -1514,6 +1526,43 @@ void RBBITest::checkUnicodeTestCase(const char *testFileName, int lineNumber,
 }
 
 
+//--------------------------------------------------------------------------------------------
+//
+//   checkGraphemeTestCase()   Check the GraphemeClusterIterator against one test case
+//                             from GraphemeBreakTest.txt, in UTF-16 and in UTF-8.
+//
+//--------------------------------------------------------------------------------------------
+void RBBITest::checkGraphemeTestCase(int lineNumber, const UnicodeString &testString,
+                                     UVector32 *breakPositions) {
+    IcuTestErrorCode status(*this, "checkGraphemeTestCase");
+    GraphemeClusterIterator iter16(testString.getBuffer(), testString.length(), status);
+    std::string s8;
+    testString.toUTF8String(s8);
+    GraphemeClusterIterator iter8(s8, status);
+    for (int32_t i = 0;; ++i) {
+        int32_t pos16 = iter16.next();
+        int32_t pos8 = iter8.next();
+        int32_t expected = i < breakPositions->size() ? breakPositions->elementAti(i) : -1;
+        int32_t expected8 = expected;
+        if (expected > 0) {
+            std::string prefix8;
+            expected8 = (int32_t)testString.tempSubString(0, expected).toUTF8String(prefix8).length();
+        }
+        if (pos16 != expected || pos8 != expected8) {
+            errln("GraphemeBreakTest.txt line %d, boundary %d: GraphemeClusterIterator "
+                  "UTF-16 %d expected %d, UTF-8 %d expected %d",
+                  lineNumber, (int)i, (int)pos16, (int)expected, (int)pos8, (int)expected8);
+            return;
+        }
+        if (expected < 0) {
+            break;
+        }
+    }
+    assertEquals(WHERE, breakPositions->size(),
+                 GraphemeClusterIterator::count(testString.getBuffer(), testString.length(), status));
+}
+
+
 
 #if !UCONFIG_NO_REGULAR_EXPRESSIONS
 //---------------------------------------------------------------------------------------
@@ -5085,6 +5134,42 @@ void RBBITest::Test8BitsTrieWith16BitStateTable() {
 // which allows some margin for changes to the number of values reserved by the rule builder
 // without breaking the test.
 
+// The Latin-1 character categories are copied from the trie when the rules are loaded,
+// for fast lookup in handleNext() and handleSafePrevious().
+void RBBITest::TestLatin1Categories() {
+    UErrorCode status = U_ZERO_ERROR;
+    LocalPointer<BreakIterator> iters[] = {
+        LocalPointer<BreakIterator>(BreakIterator::createCharacterInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createWordInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createLineInstance(Locale::getEnglish(), status)),
+        LocalPointer<BreakIterator>(BreakIterator::createSentenceInstance(Locale::getEnglish(), status)),
+    };
+    if (U_FAILURE(status)) {
+        dataerrln("%s:%d Failure creating break iterators - %s", __FILE__, __LINE__, u_errorName(status));
+        return;
+    }
+    UParseError parseError;
+    RuleBasedBreakIterator fromRules(u"!!quoted_literals_only; [a-z]+; [\\u00E0-\\u00FF]+; [0-9]+; .;",
+                                     parseError, status);
+    if (!assertSuccess(WHERE, status)) {
+        return;
+    }
+    for (int32_t i = 0; i <= UPRV_LENGTHOF(iters); ++i) {
+        const RuleBasedBreakIterator *bi = i < UPRV_LENGTHOF(iters) ?
+            dynamic_cast<const RuleBasedBreakIterator *>(iters[i].getAlias()) : &fromRules;
+        assertTrue(WHERE, bi != nullptr);
+        if (bi == nullptr) {
+            continue;
+        }
+        for (UChar32 c = 0; c < 0x100; ++c) {
+            if (bi->fData->fLatin1Categories[c] != ucptrie_get(bi->fData->fTrie, c)) {
+                errln("%s:%d iterator %d: wrong category for U+%04X", __FILE__, __LINE__, i, c);
+                break;
+            }
+        }
+    }
+}
+
 void RBBITest::TestTable_8_16_Bits() {
 
     // testStr serves as both the source of the rule string (truncated to the desired length)
@@ -5667,4 +5752,253 @@ void RBBITest::TestRandomAccess() {
     }
 }
 
-#endif // #if !UCONFIG_NO_BREAK_ITERATION
\ No newline at end of file
+// The double-array dictionary must find the same words as the UCharsTrie dictionary.
+void RBBITest::TestDoubleArrayDictionary() {
+    static const char16_t *const words[] = {
+        u"\u4e00", u"\u4e00\u4e01", u"\u4e00\u4e01\u4e03", u"\u4e01", u"\u4e01\u4e03\u4e00\u4e01",
+        u"\u4e03\u4e03", u"\u30a2\u30a4", u"\u30a2\u30a4\u30a6\u30a8", u"ab", u"abc", u"b",
+        u"\u00e9t\u00e9", u"\u4e00\u30a2", u"\u30a4\u4e01\u4e01\u4e01\u4e01\u4e01\u4e01"
+    };
+    static const char16_t alphabet[] = u"\u4e00\u4e01\u4e03\u30a2\u30a4\u30a6\u30a8abc\u00e9t";
+
+    IcuTestErrorCode status(*this, "TestDoubleArrayDictionary");
+    UCharsTrieBuilder uctBuilder(status);
+    DoubleArrayBuilder daBuilder;
+    for (int32_t i = 0; i < UPRV_LENGTHOF(words); ++i) {
+        uctBuilder.add(words[i], 100 + i, status);
+        daBuilder.add(words[i], 100 + i, status);
+    }
+    UnicodeString trieUChars;
+    uctBuilder.buildUnicodeString(USTRINGTRIE_BUILD_SMALL, trieUChars, status);
+    int32_t length;
+    const int32_t *units = daBuilder.build(length, status);
+    if (status.errIfFailureAndReset("building the dictionaries")) {
+        return;
+    }
+    UCharsDictionaryMatcher uctMatcher(trieUChars.getBuffer(), nullptr);
+    DoubleArrayDictionaryMatcher daMatcher(units, nullptr);
+    assertEquals(WHERE, DictionaryData::TRIE_TYPE_DOUBLE_ARRAY, daMatcher.getType());
+
+    icu_rand randomGen;
+    UnicodeString text;
+    for (int32_t i = 0; i < 2000; ++i) {
+        text.append(alphabet[randomGen() % (UPRV_LENGTHOF(alphabet) - 1)]);
+    }
+    LocalUTextPointer ut(utext_openUnicodeString(nullptr, &text, status));
+    for (int32_t start = 0; start < text.length(); ++start) {
+        int32_t maxLength = 1 + randomGen() % 8;
+        int32_t limit = 1 + randomGen() % 4;
+        int32_t expected[4][4], actual[4][4];
+        int32_t expectedPrefix, actualPrefix;
+        utext_setNativeIndex(ut.getAlias(), start);
+        int32_t expectedCount = uctMatcher.matches(ut.getAlias(), maxLength, limit,
+                                                   expected[0], expected[1], expected[2], &expectedPrefix);
+        int32_t expectedIndex = (int32_t)utext_getNativeIndex(ut.getAlias());
+        utext_setNativeIndex(ut.getAlias(), start);
+        int32_t actualCount = daMatcher.matches(ut.getAlias(), maxLength, limit,
+                                                actual[0], actual[1], actual[2], &actualPrefix);
+        if (!assertEquals(WHERE, expectedCount, actualCount) ||
+                !assertEquals(WHERE, expectedPrefix, actualPrefix) ||
+                !assertEquals(WHERE, expectedIndex, (int32_t)utext_getNativeIndex(ut.getAlias()))) {
+            errln("at text index %d", (int)start);
+            return;
+        }
+        for (int32_t i = 0; i < actualCount; ++i) {
+            if (expected[0][i] != actual[0][i] || expected[1][i] != actual[1][i] ||
+                    expected[2][i] != actual[2][i]) {
+                errln("%s:%d at text index %d match %d: got length %d cpLength %d value %d, "
+                      "expected %d %d %d", __FILE__, __LINE__, (int)start, (int)i,
+                      (int)actual[0][i], (int)actual[1][i], (int)actual[2][i],
+                      (int)expected[0][i], (int)expected[1][i], (int)expected[2][i]);
+                return;
+            }
+        }
+    }
+
+    // Unlike in the UCharsTrie dictionary, supplementary code points are matched.
+    DoubleArrayBuilder suppBuilder;
+    suppBuilder.add(u"\U00020000\u4e00", 7, status);
+    units = suppBuilder.build(length, status);
+    DoubleArrayDictionaryMatcher suppMatcher(units, nullptr);
+    UnicodeString suppText(u"\U00020000\u4e00\u4e00");
+    utext_openUnicodeString(ut.getAlias(), &suppText, status);
+    int32_t lengths[2], cpLengths[2], values[2];
+    assertEquals(WHERE, 1, suppMatcher.matches(ut.getAlias(), 4, 2, lengths, cpLengths, values, nullptr));
+    assertEquals(WHERE, 3, lengths[0]);
+    assertEquals(WHERE, 2, cpLengths[0]);
+    assertEquals(WHERE, 7, values[0]);
+
+    // Duplicate words are an error, as in the string trie builders.
+    DoubleArrayBuilder dupBuilder;
+    dupBuilder.add(u"ab", 1, status);
+    dupBuilder.add(u"ab", 2, status);
+    dupBuilder.build(length, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, WHERE);
+}
+
+void RBBITest::TestGraphemeClusterIterator() {
+    IcuTestErrorCode status(*this, "TestGraphemeClusterIterator");
+    // The doc comment example.
+    GraphemeClusterIterator iter(u"é\U0001F1E9\U0001F1EA", -1, status);
+    assertEquals(WHERE, 0, iter.current());
+    assertEquals(WHERE, 2, iter.next());
+    assertEquals(WHERE, 6, iter.next());
+    assertEquals(WHERE, GraphemeClusterIterator::DONE, iter.next());
+    assertEquals(WHERE, 6, iter.current());
+    assertEquals(WHERE, 0, iter.first());
+    assertEquals(WHERE, 2, iter.next());
+
+    // Compare with the character break iterator on random strings made from
+    // characters of all the grapheme break property values.
+    static const UChar32 chars[] = {
+        u'a', u'\r', u'\n', 0x85, 0x200b, 0x300, 0x200c, 0x200d, 0x1f1e6, 0x1f1fa, 0x600,
+        0x903, 0x1100, 0x1161, 0x11a8, 0xac00, 0xac01, 0x231a, 0x1f466, 0x1f3fb,
+        0x915, 0x94d, 0x937, 0x93c, 0xe33, 0xd800, 0xdc00, 0xfffd, 0xe9, 0x10000
+    };
+    LocalPointer<BreakIterator> bi(BreakIterator::createCharacterInstance(Locale::getRoot(), status));
+    if (status.errIfFailureAndReset("createCharacterInstance")) {
+        return;
+    }
+    icu_rand randomGen;
+    for (int32_t i = 0; i < 1000; ++i) {
+        UnicodeString s;
+        int32_t length = randomGen() % 12;
+        for (int32_t j = 0; j < length; ++j) {
+            s.append(chars[randomGen() % UPRV_LENGTHOF(chars)]);
+        }
+        bi->setText(s);
+        GraphemeClusterIterator iter16(s.getBuffer(), s.length(), status);
+        int32_t count = 0;
+        for (int32_t expected = bi->next();; expected = bi->next()) {
+            int32_t actual = iter16.next();
+            if (expected != actual) {
+                errln("UTF-16 string %d: GraphemeClusterIterator %d, BreakIterator %d",
+                      (int)i, (int)actual, (int)expected);
+                break;
+            }
+            if (expected == BreakIterator::DONE) {
+                break;
+            }
+            ++count;
+            int32_t limit = GraphemeClusterIterator::truncate(s.getBuffer(), s.length(), count, status);
+            assertEquals(WHERE, expected, limit);
+        }
+        assertEquals(WHERE, count, GraphemeClusterIterator::count(s.getBuffer(), s.length(), status));
+        assertEquals(WHERE, 0, GraphemeClusterIterator::truncate(s.getBuffer(), s.length(), 0, status));
+
+        // UTF-8, where toUTF8String() turns unpaired surrogates into U+FFFD.
+        std::string s8;
+        s.toUTF8String(s8);
+        LocalUTextPointer ut(utext_openUTF8(nullptr, s8.data(), (int64_t)s8.length(), status));
+        bi->setText(ut.getAlias(), status);
+        GraphemeClusterIterator iter8(s8, status);
+        for (int32_t expected = bi->next();; expected = bi->next()) {
+            int32_t actual = iter8.next();
+            if (expected != actual) {
+                errln("UTF-8 string %d: GraphemeClusterIterator %d, BreakIterator %d",
+                      (int)i, (int)actual, (int)expected);
+                break;
+            }
+            if (expected == BreakIterator::DONE) {
+                break;
+            }
+        }
+        assertEquals(WHERE, count, GraphemeClusterIterator::count(s8, status));
+        assertEquals(WHERE, (int32_t)s8.length(), GraphemeClusterIterator::truncate(s8, count, status));
+    }
+
+    // Each ill-formed UTF-8 sequence is one code point that behaves like U+FFFD.
+    static const char illFormed[] = "a\xcc\x80\xe0\x80\x80\xcc\xf0\x9f\x87\xa9\xf0\x9f\x87";
+    assertEquals(WHERE, 7, GraphemeClusterIterator::count(illFormed, status));
+    assertEquals(WHERE, 3, GraphemeClusterIterator::truncate(illFormed, 1, status));
+
+    // Errors.
+    GraphemeClusterIterator::count(nullptr, 1, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, WHERE);
+    GraphemeClusterIterator::truncate(u"ab", -2, 1, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, WHERE);
+    assertEquals(WHERE, 0, GraphemeClusterIterator::truncate(u"ab", -1, -1, status));
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, WHERE);
+    GraphemeClusterIterator failed(nullptr, 3, status);
+    status.expectErrorAndReset(U_ILLEGAL_ARGUMENT_ERROR, WHERE);
+    assertEquals(WHERE, GraphemeClusterIterator::DONE, failed.next());
+}
+
+// The CjkBreakEngine must find the same breaks whether it works on aliased UTF-16 text
+// or on a copy of UTF-8 text, and whether its temporary buffers are fresh or reused
+// from earlier, longer or shorter, texts.
+void RBBITest::TestBreakEngineScratch() {
+    static const char16_t *const words[] = {
+        u"一", u"一丁", u"丁七", u"七一丁", u"あい",
+        u"いう", u"アイ", u"一あ", u"\U00020000一", u"七"
+    };
+    // Includes halfwidth katakana which need NFKC normalization, and a supplementary character.
+    static const UChar32 alphabet[] = {
+        0x4e00, 0x4e01, 0x4e03, 0x3042, 0x3044, 0x3046, 0x30a2, 0x30a4, 0xff71, 0xff72, 0x20000
+    };
+    IcuTestErrorCode status(*this, "TestBreakEngineScratch");
+    UCharsTrieBuilder builder(status);
+    for (int32_t i = 0; i < UPRV_LENGTHOF(words); ++i) {
+        builder.add(words[i], 20 + (i * 37) % 100, status);
+    }
+    UnicodeString trieUChars;
+    builder.buildUnicodeString(USTRINGTRIE_BUILD_SMALL, trieUChars, status);
+    CjkBreakEngine engine(new UCharsDictionaryMatcher(trieUChars.getBuffer(), nullptr),
+                          kChineseJapanese, status);
+    BreakEngineScratch scratch(status);
+    if (status.errDataIfFailureAndReset("creating the CjkBreakEngine")) {
+        return;
+    }
+
+    icu_rand randomGen;
+    int32_t totalBreaks = 0;
+    for (int32_t i = 0; i < 200; ++i) {
+        UnicodeString text;
+        int32_t length = 1 + randomGen() % (i % 3 == 0 ? 150 : 20);
+        for (int32_t j = 0; j < length; ++j) {
+            text.append(alphabet[randomGen() % UPRV_LENGTHOF(alphabet)]);
+        }
+        UBool isPhraseBreaking = (i & 1) != 0;
+
+        UVector32 expected(status);
+        LocalUTextPointer ut16(utext_openUnicodeString(nullptr, &text, status));
+        engine.findBreaks(ut16.getAlias(), 0, text.length(), expected, isPhraseBreaking,
+                          nullptr, status);
+        UVector32 actual16(status);
+        utext_setNativeIndex(ut16.getAlias(), 0);
+        engine.findBreaks(ut16.getAlias(), 0, text.length(), actual16, isPhraseBreaking,
+                          &scratch, status);
+
+        std::string text8;
+        text.toUTF8String(text8);
+        UVector32 actual8(status);
+        LocalUTextPointer ut8(utext_openUTF8(nullptr, text8.data(), (int64_t)text8.length(), status));
+        engine.findBreaks(ut8.getAlias(), 0, (int32_t)text8.length(), actual8, isPhraseBreaking,
+                          &scratch, status);
+        if (status.errIfFailureAndReset("findBreaks() on text %d", (int)i)) {
+            return;
+        }
+
+        if (!assertEquals(WHERE, expected.size(), actual16.size()) ||
+                !assertEquals(WHERE, expected.size(), actual8.size())) {
+            errln("text %d: %s", (int)i, CStr(text)());
+            return;
+        }
+        for (int32_t j = 0; j < expected.size(); ++j) {
+            std::string prefix8;
+            text.tempSubString(0, expected.elementAti(j)).toUTF8String(prefix8);
+            if (expected.elementAti(j) != actual16.elementAti(j) ||
+                    (int32_t)prefix8.length() != actual8.elementAti(j)) {
+                errln("text %d break %d: expected %d (UTF-8 %d), got %d (UTF-8 %d)",
+                      (int)i, (int)j, (int)expected.elementAti(j), (int)prefix8.length(),
+                      (int)actual16.elementAti(j), (int)actual8.elementAti(j));
+                return;
+            }
+        }
+        totalBreaks += expected.size();
+    }
+    // Most texts should have been divided into several words.
+    assertTrue(WHERE, totalBreaks > 1000);
+}
+
+#endif // #if !UCONFIG_NO_BREAK_ITERATION
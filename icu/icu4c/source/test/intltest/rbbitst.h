@@ -92,10 +92,14 @@ class RBBITest: public IntlTest {
     void Test16BitsTrieWith8BitStateTable();
     void Test16BitsTrieWith16BitStateTable();
     void TestTable_8_16_Bits();
+    void TestLatin1Categories();
     void TestBug13590();
     void TestLSTMThai();
     void TestLSTMBurmese();
     void TestRandomAccess();
+    void TestDoubleArrayDictionary();
+    void TestGraphemeClusterIterator();
+    void TestBreakEngineScratch();
 
 #if U_ENABLE_TRACING
     void TestTraceCreateCharacter();
@@ -134,6 +138,10 @@ class RBBITest: public IntlTest {
                          UVector32 *breakPositions,
                          RuleBasedBreakIterator *bi);
 
+    // Check the GraphemeClusterIterator against a test case from GraphemeBreakTest.txt.
+    void checkGraphemeTestCase(int lineNumber, const UnicodeString &testString,
+                               UVector32 *breakPositions);
+
     // Run the actual tests for TestTailoredBreaks()
     void TBTest(BreakIterator* brkitr, int type, const char *locale, const char* escapedText,
                 const int32_t *expectOffsets, int32_t expectOffsetsCount);
@@ -11,6 +11,7 @@
 #if !UCONFIG_NO_NORMALIZATION
 
 #include "unicode/uchar.h"
+#include "unicode/appendable.h"
 #include "unicode/errorcode.h"
 #include "unicode/normlzr.h"
 #include "unicode/stringoptions.h"
@@ -62,6 +63,8 @@ void BasicNormalizerTest::runIndexedTest(int32_t index, UBool exec,
     TESTCASE_AUTO(TestNormalizeIllFormedText);
     TESTCASE_AUTO(TestComposeJamoTBase);
     TESTCASE_AUTO(TestComposeBoundaryAfter);
+    TESTCASE_AUTO(TestLongLowPrefix);
+    TESTCASE_AUTO(TestStreamingNormalizer);
     TESTCASE_AUTO_END;
 }
 
@@ -1873,4 +1876,151 @@ BasicNormalizerTest::TestComposeBoundaryAfter() {
     assertFalse("U+FB2C boundary-after", nfkc->hasBoundaryAfter(0xFB2C));
 }
 
+// The fast paths skip whole blocks of code units below the minimum "no" code point.
+// Put the first relevant character at every offset around the block sizes.
+void
+BasicNormalizerTest::TestLongLowPrefix() {
+    IcuTestErrorCode errorCode(*this, "TestLongLowPrefix");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFC/NFDInstance() call failed")) {
+        return;
+    }
+    UnicodeString prefix;
+    for(int32_t i=0; i<=70; ++i) {
+        // Mostly ASCII with some Latin-1 which is below the NFC minimum.
+        UnicodeString composed=prefix+u"\u00E9z";
+        UnicodeString decomposed=prefix+u"e\u0301z";
+        UnicodeString nfdPrefix=nfd->normalize(prefix, errorCode);
+        UnicodeString decomposedFull=nfdPrefix+u"e\u0301z";
+        UnicodeString msg=UnicodeString(u"prefix length ")+i;
+        int32_t expectedSpan=prefix.indexOf(u'\u00E0');
+        if(expectedSpan<0) {
+            expectedSpan=i;
+        }
+        assertEquals(UnicodeString(u"NFC ")+msg, composed, nfc->normalize(decomposed, errorCode));
+        assertEquals(UnicodeString(u"NFD ")+msg, decomposedFull, nfd->normalize(composed, errorCode));
+        assertFalse(UnicodeString(u"NFC isNormalized ")+msg, nfc->isNormalized(decomposed, errorCode));
+        assertTrue(UnicodeString(u"NFC isNormalized(composed) ")+msg, nfc->isNormalized(composed, errorCode));
+        assertEquals(UnicodeString(u"NFC quickCheck ")+msg,
+                     UNORM_MAYBE, nfc->quickCheck(decomposed, errorCode));
+        assertEquals(UnicodeString(u"NFD spanQuickCheckYes ")+msg,
+                     expectedSpan,
+                     nfd->spanQuickCheckYes(composed, errorCode));
+
+        std::string utf8, result8;
+        decomposed.toUTF8String(utf8);
+        StringByteSink<std::string> sink(&result8);
+        nfc->normalizeUTF8(0, utf8, sink, nullptr, errorCode);
+        std::string expected8;
+        composed.toUTF8String(expected8);
+        assertEquals(UnicodeString(u"NFC UTF-8 ")+msg, expected8.c_str(), result8.c_str());
+        assertFalse(UnicodeString(u"NFC isNormalizedUTF8 ")+msg, nfc->isNormalizedUTF8(utf8, errorCode));
+
+        utf8.clear();
+        result8.clear();
+        expected8.clear();
+        composed.toUTF8String(utf8);
+        nfd->normalizeUTF8(0, utf8, sink, nullptr, errorCode);
+        decomposedFull.toUTF8String(expected8);
+        assertEquals(UnicodeString(u"NFD UTF-8 ")+msg, expected8.c_str(), result8.c_str());
+        assertSuccess(msg, errorCode.get());
+        prefix.append(i%23==22 ? u'\u00E0' : (char16_t)(u'a'+i%26));
+    }
+}
+
+namespace {
+
+// Feeds src to a StreamingNormalizer2 in chunks of chunkLength code units,
+// with the first chunk of length firstLength.
+UnicodeString streamNormalize(StreamingNormalizer2 &stream, const UnicodeString &src,
+                              int32_t firstLength, int32_t chunkLength, UErrorCode &errorCode) {
+    UnicodeString result;
+    UnicodeStringAppendable appendable(result);
+    int32_t start = 0;
+    int32_t length = firstLength;
+    while (start < src.length()) {
+        stream.normalizeChunk(src.tempSubString(start, length), appendable, errorCode);
+        start += length;
+        length = chunkLength;
+    }
+    stream.finish(appendable, errorCode);
+    return result;
+}
+
+std::string streamNormalizeUTF8(StreamingNormalizer2 &stream, const std::string &src,
+                                int32_t firstLength, int32_t chunkLength, UErrorCode &errorCode) {
+    std::string result;
+    StringByteSink<std::string> sink(&result);
+    int32_t start = 0;
+    int32_t length = firstLength;
+    while (start < (int32_t)src.length()) {
+        stream.normalizeChunkUTF8(StringPiece(src).substr(start, length), sink, errorCode);
+        start += length;
+        length = chunkLength;
+    }
+    stream.finishUTF8(sink, errorCode);
+    return result;
+}
+
+}  // namespace
+
+void
+BasicNormalizerTest::TestStreamingNormalizer() {
+    IcuTestErrorCode errorCode(*this, "TestStreamingNormalizer");
+    const Normalizer2 *nfc = Normalizer2::getNFCInstance(errorCode);
+    const Normalizer2 *nfd = Normalizer2::getNFDInstance(errorCode);
+    const Normalizer2 *nfkc_cf = Normalizer2::getNFKCCasefoldInstance(errorCode);
+    if(errorCode.errDataIfFailureAndReset("Normalizer2::getNFC/NFD/NFKC_CFInstance() call failed")) {
+        return;
+    }
+    const Normalizer2 *instances[] = { nfc, nfd, nfkc_cf };
+    const char *names[] = { "nfc", "nfd", "nfkc_cf" };
+    UnicodeString src(
+        u"Ab\u0300\u0327c \u1E0A\u0323\u0307x \uAC00\u11A8\u1100\u1161\u11A8 "
+        u"\U0001D15E\U0001D165 \u0340\u0344\u0345 \uFB2C\u05B6 e\u0301\u0301\u0301\u0301z "
+        u"\u00C5\u212B\u1E9B\u0323.");
+    std::string src8;
+    src.toUTF8String(src8);
+    // Ill-formed UTF-8 is passed through.
+    src8.append("\xE3\x81 \xC3\xA9\xCC");
+
+    for (int32_t n = 0; n < UPRV_LENGTHOF(instances); ++n) {
+        const Normalizer2 &n2 = *instances[n];
+        StreamingNormalizer2 stream(n2);
+        UnicodeString expected = n2.normalize(src, errorCode);
+        std::string expected8;
+        StringByteSink<std::string> sink(&expected8);
+        n2.normalizeUTF8(0, src8, sink, nullptr, errorCode);
+        for (int32_t chunkLength = 1; chunkLength <= 5; ++chunkLength) {
+            for (int32_t first = 0; first <= src.length(); ++first) {
+                UnicodeString msg = UnicodeString(names[n], -1, US_INV) +
+                    u" first=" + first + u" chunk=" + chunkLength;
+                assertEquals(msg, expected,
+                             streamNormalize(stream, src, first, chunkLength, errorCode));
+                assertEquals(msg + u" UTF-8", expected8.c_str(),
+                             streamNormalizeUTF8(stream, src8, first, chunkLength, errorCode).c_str());
+                if (errorCode.errIfFailureAndReset("%s", names[n])) {
+                    return;
+                }
+            }
+        }
+    }
+
+    // UTF-16 and UTF-8 input must not be mixed without finishing the text.
+    StreamingNormalizer2 stream(*nfc);
+    std::string result8;
+    StringByteSink<std::string> sink(&result8);
+    stream.normalizeChunkUTF8("abc", sink, errorCode);
+    UnicodeString result;
+    UnicodeStringAppendable appendable(result);
+    stream.normalizeChunk(u"def", appendable, errorCode);
+    assertEquals("mixed input", U_INVALID_STATE_ERROR, errorCode.reset());
+    stream.reset();
+    stream.normalizeChunk(u"def", appendable, errorCode);
+    stream.finish(appendable, errorCode);
+    assertEquals("after reset", u"def", result);
+    assertEquals("held back", "ab", result8.c_str());
+}
+
 #endif /* #if !UCONFIG_NO_NORMALIZATION */
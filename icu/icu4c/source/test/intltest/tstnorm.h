@@ -54,6 +54,8 @@ class BasicNormalizerTest : public IntlTest {
     void TestNormalizeIllFormedText();
     void TestComposeJamoTBase();
     void TestComposeBoundaryAfter();
+    void TestLongLowPrefix();
+    void TestStreamingNormalizer();
 
 private:
     UnicodeString canonTests[24][3];
@@ -146,6 +146,12 @@
         "TestNames_Russian.txt"
     ],
 
+    "und",
+    [
+        "TestNames_Russian.txt",
+        "TestRandomWordsUDHR_el.txt"
+    ],
+
     "ru-u-ks-level4-ka-shifted",
     [
         "TestRandomWordsUDHR_ru.txt"
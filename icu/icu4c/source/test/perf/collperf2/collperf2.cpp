@@ -276,7 +276,9 @@ long StrcollUTF8_2::getOperationsPerIteration()
 }
 
 //
-// Test case taking a single test data array, calling ucol_getSortKey for each
+// Test case taking a single test data array, calling ucol_getSortKey for each.
+// The number of events is the total length of all sort keys,
+// for comparison with GetCompactSortKey.
 //
 class GetSortKey : public UPerfFunction
 {
@@ -285,26 +287,32 @@ class GetSortKey : public UPerfFunction
     ~GetSortKey();
     virtual void call(UErrorCode* status);
     virtual long getOperationsPerIteration();
+    virtual long getEventsPerIteration();
 
 private:
     const UCollator *coll;
     const CA_uchar *source;
     UBool useLen;
+    long totalKeyLength;
 };
 
+#define KEY_BUF_SIZE 512
+
 GetSortKey::GetSortKey(const UCollator* coll, const CA_uchar* source, UBool useLen)
     :   coll(coll),
         source(source),
-        useLen(useLen)
+        useLen(useLen),
+        totalKeyLength(0)
 {
+    for (int32_t i = 0; source != NULL && i < source->count; i++) {
+        totalKeyLength += ucol_getSortKey(coll, source->dataOf(i), -1, NULL, 0);
+    }
 }
 
 GetSortKey::~GetSortKey()
 {
 }
 
-#define KEY_BUF_SIZE 512
-
 void GetSortKey::call(UErrorCode* status)
 {
     if (U_FAILURE(*status)) return;
@@ -328,6 +336,67 @@ long GetSortKey::getOperationsPerIteration()
     return source->count;
 }
 
+long GetSortKey::getEventsPerIteration()
+{
+    return totalKeyLength;
+}
+
+//
+// Test case taking a single test data array, calling ucol_getCompactSortKey for each.
+// The number of events is the total length of all compact sort keys.
+//
+class GetCompactSortKey : public UPerfFunction
+{
+public:
+    GetCompactSortKey(const UCollator* coll, const CA_uchar* source);
+    ~GetCompactSortKey();
+    virtual void call(UErrorCode* status);
+    virtual long getOperationsPerIteration();
+    virtual long getEventsPerIteration();
+
+private:
+    const UCollator *coll;
+    const CA_uchar *source;
+    long totalKeyLength;
+};
+
+GetCompactSortKey::GetCompactSortKey(const UCollator* coll, const CA_uchar* source)
+    :   coll(coll),
+        source(source),
+        totalKeyLength(0)
+{
+    for (int32_t i = 0; source != NULL && i < source->count; i++) {
+        UErrorCode status = U_ZERO_ERROR;
+        totalKeyLength += ucol_getCompactSortKey(coll, source->dataOf(i), source->lengthOf(i),
+                                                 NULL, 0, &status);
+    }
+}
+
+GetCompactSortKey::~GetCompactSortKey()
+{
+}
+
+void GetCompactSortKey::call(UErrorCode* status)
+{
+    if (U_FAILURE(*status)) return;
+
+    uint8_t key[KEY_BUF_SIZE];
+
+    for (int32_t i = 0; U_SUCCESS(*status) && i < source->count; i++) {
+        ucol_getCompactSortKey(coll, source->dataOf(i), source->lengthOf(i), key, KEY_BUF_SIZE, status);
+    }
+}
+
+long GetCompactSortKey::getOperationsPerIteration()
+{
+    return source->count;
+}
+
+long GetCompactSortKey::getEventsPerIteration()
+{
+    return totalKeyLength;
+}
+
 //
 // Test case taking a single test data array in UTF-16, calling ucol_nextSortKeyPart for each for the
 // given buffer size
@@ -950,6 +1019,85 @@ void StringPieceSortC::call(UErrorCode* status) {
     ops = cc.counter;
 }
 
+//
+// Test case sorting an array of UTF-16 strings with ucol_sortStrings(),
+// which generates each sort key once, on numThreads threads.
+//
+class SortStrings : public CollPerfFunction {
+public:
+    SortStrings(const Collator& coll, const UCollator *ucoll, const CA_uchar* data16,
+                int32_t numThreads)
+            : CollPerfFunction(coll, ucoll), d16(data16), numThreads(numThreads),
+              strings(new const UChar*[d16->count]), lengths(new int32_t[d16->count]),
+              order(new int32_t[d16->count]) {
+        for (int32_t i = 0; i < d16->count; ++i) {
+            strings[i] = d16->dataOf(i);
+            lengths[i] = d16->lengthOf(i);
+        }
+    }
+    virtual ~SortStrings();
+    virtual void call(UErrorCode* status);
+
+private:
+    const CA_uchar* d16;
+    int32_t numThreads;
+    const UChar** strings;
+    int32_t* lengths;
+    int32_t* order;
+};
+
+SortStrings::~SortStrings() {
+    delete[] strings;
+    delete[] lengths;
+    delete[] order;
+}
+
+void SortStrings::call(UErrorCode* status) {
+    if (U_FAILURE(*status)) return;
+
+    ucol_sortStrings(ucoll, strings, lengths, d16->count, order, numThreads, status);
+    ops = d16->count;
+}
+
+//
+// Test case sorting an array of UTF-8 strings with ucol_sortStringsUTF8().
+//
+class SortStringsUTF8 : public CollPerfFunction {
+public:
+    SortStringsUTF8(const Collator& coll, const UCollator *ucoll, const CA_char* data8,
+                    int32_t numThreads)
+            : CollPerfFunction(coll, ucoll), d8(data8), numThreads(numThreads),
+              strings(new const char*[d8->count]), lengths(new int32_t[d8->count]),
+              order(new int32_t[d8->count]) {
+        for (int32_t i = 0; i < d8->count; ++i) {
+            strings[i] = d8->dataOf(i);
+            lengths[i] = d8->lengthOf(i);
+        }
+    }
+    virtual ~SortStringsUTF8();
+    virtual void call(UErrorCode* status);
+
+private:
+    const CA_char* d8;
+    int32_t numThreads;
+    const char** strings;
+    int32_t* lengths;
+    int32_t* order;
+};
+
+SortStringsUTF8::~SortStringsUTF8() {
+    delete[] strings;
+    delete[] lengths;
+    delete[] order;
+}
+
+void SortStringsUTF8::call(UErrorCode* status) {
+    if (U_FAILURE(*status)) return;
+
+    ucol_sortStringsUTF8(ucoll, strings, lengths, d8->count, order, numThreads, status);
+    ops = d8->count;
+}
+
 //
 // Test case performing binary searches in a sorted array of UnicodeString pointers.
 //
@@ -1093,6 +1241,7 @@ class CollPerf2Test : public UPerfTest
 
     UPerfFunction* TestGetSortKey();
     UPerfFunction* TestGetSortKeyNull();
+    UPerfFunction* TestGetCompactSortKey();
 
     UPerfFunction* TestNextSortKeyPart_4All();
     UPerfFunction* TestNextSortKeyPart_4x2();
@@ -1122,6 +1271,9 @@ class CollPerf2Test : public UPerfTest
     UPerfFunction* TestUniStrSort();
     UPerfFunction* TestStringPieceSortCpp();
     UPerfFunction* TestStringPieceSortC();
+    UPerfFunction* TestSortStrings();
+    UPerfFunction* TestSortStringsParallel();
+    UPerfFunction* TestSortStringsUTF8Parallel();
 
     UPerfFunction* TestUniStrBinSearch();
     UPerfFunction* TestStringPieceBinSearchCpp();
@@ -1402,6 +1554,7 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
 
     TESTCASE_AUTO(TestGetSortKey);
     TESTCASE_AUTO(TestGetSortKeyNull);
+    TESTCASE_AUTO(TestGetCompactSortKey);
 
     TESTCASE_AUTO(TestNextSortKeyPart_4All);
     TESTCASE_AUTO(TestNextSortKeyPart_4x4);
@@ -1429,6 +1582,9 @@ CollPerf2Test::runIndexedTest(int32_t index, UBool exec, const char *&name, char
     TESTCASE_AUTO(TestUniStrSort);
     TESTCASE_AUTO(TestStringPieceSortCpp);
     TESTCASE_AUTO(TestStringPieceSortC);
+    TESTCASE_AUTO(TestSortStrings);
+    TESTCASE_AUTO(TestSortStringsParallel);
+    TESTCASE_AUTO(TestSortStringsUTF8Parallel);
 
     TESTCASE_AUTO(TestUniStrBinSearch);
     TESTCASE_AUTO(TestStringPieceBinSearchCpp);
@@ -1528,6 +1684,17 @@ UPerfFunction* CollPerf2Test::TestGetSortKeyNull()
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestGetCompactSortKey()
+{
+    UErrorCode status = U_ZERO_ERROR;
+    GetCompactSortKey *testCase = new GetCompactSortKey(coll, getData16(status));
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 UPerfFunction* CollPerf2Test::TestNextSortKeyPart_4All()
 {
     UErrorCode status = U_ZERO_ERROR;
@@ -1756,6 +1923,36 @@ UPerfFunction* CollPerf2Test::TestStringPieceSortC() {
     return testCase;
 }
 
+UPerfFunction* CollPerf2Test::TestSortStrings() {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *testCase = new SortStrings(*collObj, coll, getRandomData16(status), 1);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestSortStringsParallel() {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *testCase = new SortStrings(*collObj, coll, getRandomData16(status), 0);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
+UPerfFunction* CollPerf2Test::TestSortStringsUTF8Parallel() {
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction *testCase = new SortStringsUTF8(*collObj, coll, getRandomData8(status), 0);
+    if (U_FAILURE(status)) {
+        delete testCase;
+        return NULL;
+    }
+    return testCase;
+}
+
 UPerfFunction* CollPerf2Test::TestUniStrBinSearch() {
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction *testCase = new UniStrBinSearch(*collObj, coll, getSortedData16(status));
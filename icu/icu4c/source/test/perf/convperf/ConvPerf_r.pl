@@ -46,18 +46,23 @@
 my $tests = { 
     "UTF-8 From Unicode",       ["$p1,TestICU_UTF8_FromUnicode",        "$p2,TestICU_UTF8_FromUnicode" ],
     "UTF-8 To Unicode",         ["$p1,TestICU_UTF8_ToUnicode",          "$p2,TestICU_UTF8_ToUnicode" ],
+    "u_strToUTF8",              ["$p1,TestICU_UTF8_StrToUTF8",          "$p2,TestICU_UTF8_StrToUTF8" ],
+    "u_strFromUTF8",            ["$p1,TestICU_UTF8_StrFromUTF8",        "$p2,TestICU_UTF8_StrFromUTF8" ],
     ####
     "ISO-8859-1 From Unicode",  ["$p1,TestICU_Latin1_FromUnicode",      "$p2,TestICU_Latin1_FromUnicode" ],
     "ISO-8859-1 To Unicode",    ["$p1,TestICU_Latin1_ToUnicode",        "$p2,TestICU_Latin1_ToUnicode" ],
     ####
     "Shift-JIS From Unicode",   ["$p1,TestICU_SJIS_FromUnicode",        "$p2,TestICU_SJIS_FromUnicode" ],
     "Shift-JIS To Unicode",     ["$p1,TestICU_SJIS_ToUnicode",          "$p2,TestICU_SJIS_ToUnicode" ],
+    "Shift-JIS To UTF-8",       ["$p1,TestICU_SJIS_ToUTF8",             "$p2,TestICU_SJIS_ToUTF8" ],
     ####
     "EUC-JP From Unicode",      ["$p1,TestICU_EUCJP_FromUnicode",       "$p2,TestICU_EUCJP_FromUnicode" ],
     "EUC-JP To Unicode",        ["$p1,TestICU_EUCJP_ToUnicode",         "$p2,TestICU_EUCJP_ToUnicode" ],
+    "EUC-JP To UTF-8",          ["$p1,TestICU_EUCJP_ToUTF8",            "$p2,TestICU_EUCJP_ToUTF8" ],
     ####
     "GB2312 From Unicode",      ["$p1,TestICU_GB2312_FromUnicode",      "$p2,TestICU_GB2312_FromUnicode" ],
     "GB2312 To Unicode",        ["$p1,TestICU_GB2312_ToUnicode",        "$p2,TestICU_GB2312_ToUnicode" ],
+    "GB2312 To UTF-8",          ["$p1,TestICU_GB2312_ToUTF8",           "$p2,TestICU_GB2312_ToUTF8" ],
     ####
     "ISO2022KR From Unicode",   ["$p1,TestICU_ISO2022KR_FromUnicode",   "$p2,TestICU_ISO2022KR_FromUnicode" ],
     "ISO2022KR To Unicode",     ["$p1,TestICU_ISO2022KR_ToUnicode",     "$p2,TestICU_ISO2022KR_ToUnicode" ],
@@ -116,6 +116,13 @@ UPerfFunction* ConverterPerformanceTest::runIndexedTest(int32_t index, UBool exe
         TESTCASE(52,TestWinANSI_ISO2022JP_ToUnicode);
         TESTCASE(53,TestWinANSI_ISO2022JP_FromUnicode);
 
+        TESTCASE(54,TestICU_UTF8_StrFromUTF8);
+        TESTCASE(55,TestICU_UTF8_StrToUTF8);
+
+        TESTCASE(56,TestICU_SJIS_ToUTF8);
+        TESTCASE(57,TestICU_EUCJP_ToUTF8);
+        TESTCASE(58,TestICU_GB2312_ToUTF8);
+
         default: 
             name = ""; 
             return NULL;
@@ -161,6 +168,24 @@ UPerfFunction*  ConverterPerformanceTest::TestICU_UTF8_ToUnicode(){
 }
 
 
+UPerfFunction* ConverterPerformanceTest::TestICU_UTF8_StrFromUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUStrFromUTF8PerfFunction((char*)utf8_encSource, UPRV_LENGTHOF(utf8_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
+UPerfFunction* ConverterPerformanceTest::TestICU_UTF8_StrToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUStrToUTF8PerfFunction((UChar *)utf8_uniSource, UPRV_LENGTHOF(utf8_uniSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
 UPerfFunction* ConverterPerformanceTest::TestWinIML2_UTF8_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
     UPerfFunction* pf = new WinIMultiLanguage2FromUnicodePerfFunction("utf-8",utf8_uniSource, UPRV_LENGTHOF(utf8_uniSource), status);
@@ -388,6 +413,15 @@ UPerfFunction*  ConverterPerformanceTest::TestICU_SJIS_ToUnicode(){
     return pf;
 }
 
+UPerfFunction*  ConverterPerformanceTest::TestICU_SJIS_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertExToUTF8PerfFunction("sjis",(char*)sjis_encSource, UPRV_LENGTHOF(sjis_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
 
 UPerfFunction* ConverterPerformanceTest::TestWinIML2_SJIS_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
@@ -447,6 +481,15 @@ UPerfFunction*  ConverterPerformanceTest::TestICU_EUCJP_ToUnicode(){
     return pf;
 }
 
+UPerfFunction*  ConverterPerformanceTest::TestICU_EUCJP_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertExToUTF8PerfFunction("euc-jp",(char*)eucjp_encSource, UPRV_LENGTHOF(eucjp_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
 
 UPerfFunction* ConverterPerformanceTest::TestWinIML2_EUCJP_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
@@ -506,6 +549,15 @@ UPerfFunction*  ConverterPerformanceTest::TestICU_GB2312_ToUnicode(){
     return pf;
 }
 
+UPerfFunction*  ConverterPerformanceTest::TestICU_GB2312_ToUTF8(){
+    UErrorCode status = U_ZERO_ERROR;
+    UPerfFunction* pf = new ICUConvertExToUTF8PerfFunction("gb2312",(char*)gb2312_encSource, UPRV_LENGTHOF(gb2312_encSource), status);
+    if(U_FAILURE(status)){
+        return NULL;
+    }
+    return pf;
+}
+
 
 UPerfFunction* ConverterPerformanceTest::TestWinIML2_GB2312_FromUnicode(){
     UErrorCode status = U_ZERO_ERROR;
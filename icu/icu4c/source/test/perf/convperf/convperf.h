@@ -117,6 +117,135 @@ class ICUFromUnicodePerfFunction : public UPerfFunction{
     }
 };
 
+class ICUStrFromUTF8PerfFunction : public UPerfFunction{
+private:
+    const char* src;
+    int32_t srcLen;
+    UChar* target;
+    int32_t targetCapacity;
+
+public:
+    ICUStrFromUTF8PerfFunction(const char* source, int32_t sourceLen, UErrorCode& status){
+        src = source;
+        srcLen = sourceLen;
+        target = NULL;
+        targetCapacity = 0;
+        int32_t reqdLen = 0;
+        u_strFromUTF8(target, 0, &reqdLen, source, srcLen, &status);
+        if(status==U_BUFFER_OVERFLOW_ERROR) {
+            status=U_ZERO_ERROR;
+            target=(UChar*)malloc((reqdLen) * U_SIZEOF_UCHAR);
+            targetCapacity = reqdLen;
+            if(target == NULL){
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+        }
+    }
+    virtual void call(UErrorCode* status){
+        int32_t destLength;
+        u_strFromUTF8(target, targetCapacity, &destLength, src, srcLen, status);
+    }
+    virtual long getOperationsPerIteration(void){
+        return srcLen;
+    }
+    ~ICUStrFromUTF8PerfFunction(){
+        free(target);
+    }
+};
+
+class ICUStrToUTF8PerfFunction : public UPerfFunction{
+private:
+    const UChar* src;
+    int32_t srcLen;
+    char* target;
+    int32_t targetCapacity;
+
+public:
+    ICUStrToUTF8PerfFunction(const UChar* source, int32_t sourceLen, UErrorCode& status){
+        src = source;
+        srcLen = sourceLen;
+        target = NULL;
+        targetCapacity = 0;
+        int32_t reqdLen = 0;
+        u_strToUTF8(target, 0, &reqdLen, source, srcLen, &status);
+        if(status==U_BUFFER_OVERFLOW_ERROR) {
+            status=U_ZERO_ERROR;
+            target=(char*)malloc(reqdLen);
+            targetCapacity = reqdLen;
+            if(target == NULL){
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+        }
+    }
+    virtual void call(UErrorCode* status){
+        int32_t destLength;
+        u_strToUTF8(target, targetCapacity, &destLength, src, srcLen, status);
+    }
+    virtual long getOperationsPerIteration(void){
+        return srcLen;
+    }
+    ~ICUStrToUTF8PerfFunction(){
+        free(target);
+    }
+};
+
+class ICUConvertExToUTF8PerfFunction : public UPerfFunction{
+private:
+    UConverter* conv;
+    UConverter* utf8;
+    const char* src;
+    int32_t srcLen;
+    char* target;
+    char* targetLimit;
+    UChar pivot[MAX_BUF_SIZE];
+
+public:
+    ICUConvertExToUTF8PerfFunction(const char* name, const char* source, int32_t sourceLen, UErrorCode& status){
+        conv = ucnv_open(name,&status);
+        utf8 = ucnv_open("UTF-8",&status);
+        src = source;
+        srcLen = sourceLen;
+        target = NULL;
+        targetLimit = NULL;
+        if(U_FAILURE(status)){
+            return;
+        }
+        int32_t reqdLen = ucnv_convert("UTF-8", name, target, 0,
+                                       source, srcLen, &status);
+        if(status==U_BUFFER_OVERFLOW_ERROR) {
+            status=U_ZERO_ERROR;
+            target=(char*)malloc(reqdLen);
+            targetLimit = target + reqdLen;
+            if(target == NULL){
+                status = U_MEMORY_ALLOCATION_ERROR;
+                return;
+            }
+        }
+    }
+    virtual void call(UErrorCode* status){
+        const char* mySrc = src;
+        char* myTarget = target;
+        UChar* pivotSource = pivot;
+        UChar* pivotTarget = pivot;
+        ucnv_convertEx(utf8, conv, &myTarget, targetLimit, &mySrc, src + srcLen,
+                       pivot, &pivotSource, &pivotTarget, pivot + UPRV_LENGTHOF(pivot),
+                       true, true, status);
+        if(*status==U_STRING_NOT_TERMINATED_WARNING) {
+            *status=U_ZERO_ERROR;
+        }
+    }
+    virtual long getOperationsPerIteration(void){
+        return srcLen;
+    }
+    ~ICUConvertExToUTF8PerfFunction(){
+        free(target);
+        ucnv_close(utf8);
+        ucnv_close(conv);
+    }
+};
+
 class ICUOpenAllConvertersFunction : public UPerfFunction{
 private:
     UBool cleanup;
@@ -507,6 +636,8 @@ class  ConverterPerformanceTest : public UPerfTest{
     UPerfFunction* TestWinANSI_UTF8_FromUnicode();
     UPerfFunction* TestWinIML2_UTF8_ToUnicode();
     UPerfFunction* TestWinIML2_UTF8_FromUnicode();
+    UPerfFunction* TestICU_UTF8_StrFromUTF8();
+    UPerfFunction* TestICU_UTF8_StrToUTF8();
         
     UPerfFunction* TestICU_Latin1_ToUnicode();
     UPerfFunction* TestICU_Latin1_FromUnicode();
@@ -532,6 +663,7 @@ class  ConverterPerformanceTest : public UPerfTest{
     
     UPerfFunction* TestICU_SJIS_ToUnicode();
     UPerfFunction* TestICU_SJIS_FromUnicode();
+    UPerfFunction* TestICU_SJIS_ToUTF8();
     UPerfFunction* TestWinANSI_SJIS_ToUnicode();
     UPerfFunction* TestWinANSI_SJIS_FromUnicode();
     UPerfFunction* TestWinIML2_SJIS_ToUnicode();
@@ -539,6 +671,7 @@ class  ConverterPerformanceTest : public UPerfTest{
 
     UPerfFunction* TestICU_EUCJP_ToUnicode();
     UPerfFunction* TestICU_EUCJP_FromUnicode();
+    UPerfFunction* TestICU_EUCJP_ToUTF8();
     UPerfFunction* TestWinANSI_EUCJP_ToUnicode();
     UPerfFunction* TestWinANSI_EUCJP_FromUnicode();
     UPerfFunction* TestWinIML2_EUCJP_ToUnicode();
@@ -546,6 +679,7 @@ class  ConverterPerformanceTest : public UPerfTest{
 
     UPerfFunction* TestICU_GB2312_ToUnicode();
     UPerfFunction* TestICU_GB2312_FromUnicode();
+    UPerfFunction* TestICU_GB2312_ToUTF8();
     UPerfFunction* TestWinANSI_GB2312_ToUnicode();
     UPerfFunction* TestWinANSI_GB2312_FromUnicode();
     UPerfFunction* TestWinIML2_GB2312_ToUnicode();
@@ -24,6 +24,9 @@
  *  ./dicttrieperf --sourcedir <ICU build tree>/data/out/tmp --passes 3 --iterations 1000
  * or
  *  ./dicttrieperf -f <ICU source tree>/source/data/brkitr/thaidict.txt --passes 3 --iterations 250
+ * or, comparing the UCharsTrie and double-array dictionary formats:
+ *  ./dicttrieperf -f <ICU source tree>/source/data/brkitr/dictionaries/cjdict.txt --passes 3 --iterations 10 \
+ *      ucharsdictmatcher doublearraydictmatcher
  */
 
 #include <stdio.h>
@@ -31,11 +34,14 @@
 #include "unicode/bytestrie.h"
 #include "unicode/bytestriebuilder.h"
 #include "unicode/localpointer.h"
+#include "unicode/uchar.h"
 #include "unicode/ucharstrie.h"
 #include "unicode/ucharstriebuilder.h"
 #include "unicode/uperf.h"
 #include "unicode/utext.h"
 #include "charstr.h"
+#include "dictionarydata.h"
+#include "doublearraybuilder.h"
 #include "package.h"
 #include "toolutil.h"
 #include "ucbuf.h"  // struct ULine
@@ -642,6 +648,120 @@ class BytesTrieDictContains : public BytesTrieDictLookup {
     }
 };
 
+// Splits a dictionary text line into the word and its optional value,
+// as in gendict.
+static int32_t parseDictLine(const ULine &line, int32_t &value) {
+    int32_t wordLength=0;
+    while(wordLength<line.len && !u_isspace(line.name[wordLength])) {
+        ++wordLength;
+    }
+    int32_t i=wordLength;
+    while(i<line.len && u_isspace(line.name[i])) {
+        ++i;
+    }
+    value=0;
+    for(; i<line.len && 0x30<=line.name[i] && line.name[i]<=0x39; ++i) {
+        value=value*10+(line.name[i]-0x30);
+    }
+    return wordLength;
+}
+
+// Performance test function object for the DictionaryMatcher implementations
+// that dictionary-based break iteration uses.
+// Like CjkBreakEngine::divideUpDictionaryRange(), this looks for the words
+// starting at each code point of each dictionary word.
+class DictMatcherMatches : public DictLookup {
+public:
+    DictMatcherMatches(const DictionaryTriePerfTest &perfTest) : DictLookup(perfTest) {}
+    virtual ~DictMatcherMatches() {}
+
+    virtual void call(UErrorCode *pErrorCode) {
+        if(matcher.isNull()) {
+            return;
+        }
+        UText text=UTEXT_INITIALIZER;
+        int32_t lengths[20];
+        int32_t values[20];
+        const ULine *lines=perf.getCachedLines();
+        int32_t numLines=perf.getNumLines();
+        for(int32_t i=0; i<numLines; ++i) {
+            // Skip comment lines (start with a character below 'A').
+            if(lines[i].name[0]<0x41) {
+                continue;
+            }
+            int32_t value;
+            int32_t wordLength=parseDictLine(lines[i], value);
+            utext_openUChars(&text, lines[i].name, wordLength, pErrorCode);
+            for(int32_t start=0; start<wordLength; start=(int32_t)utext_getNativeIndex(&text)) {
+                utext_setNativeIndex(&text, start);
+                int32_t count=matcher->matches(&text, wordLength-start, UPRV_LENGTHOF(lengths),
+                                               lengths, NULL, values, NULL);
+                if(start==0 && (count==0 || lengths[count-1]!=wordLength || values[count-1]!=value)) {
+                    fprintf(stderr, "word %ld (0-based) not found\n", (long)i);
+                }
+                utext_setNativeIndex(&text, start);
+                utext_next32(&text);
+            }
+        }
+        utext_close(&text);
+    }
+
+protected:
+    LocalPointer<DictionaryMatcher> matcher;
+};
+
+class UCharsDictMatcherMatches : public DictMatcherMatches {
+public:
+    UCharsDictMatcherMatches(const DictionaryTriePerfTest &perfTest)
+            : DictMatcherMatches(perfTest) {
+        IcuToolErrorCode errorCode("UCharsDictMatcherMatches()");
+        UCharsTrieBuilder builder(errorCode);
+        const ULine *lines=perf.getCachedLines();
+        int32_t numLines=perf.getNumLines();
+        for(int32_t i=0; i<numLines; ++i) {
+            // Skip comment lines (start with a character below 'A').
+            if(lines[i].name[0]<0x41) {
+                continue;
+            }
+            int32_t value;
+            int32_t wordLength=parseDictLine(lines[i], value);
+            builder.add(UnicodeString(false, lines[i].name, wordLength), value, errorCode);
+        }
+        builder.buildUnicodeString(USTRINGTRIE_BUILD_SMALL, trieUChars, errorCode);
+        printf("size of UCharsTrie:          %6ld bytes\n", (long)trieUChars.length()*2);
+        matcher.adoptInstead(new UCharsDictionaryMatcher(trieUChars.getBuffer(), NULL));
+    }
+
+protected:
+    UnicodeString trieUChars;
+};
+
+class DoubleArrayDictMatcherMatches : public DictMatcherMatches {
+public:
+    DoubleArrayDictMatcherMatches(const DictionaryTriePerfTest &perfTest)
+            : DictMatcherMatches(perfTest) {
+        IcuToolErrorCode errorCode("DoubleArrayDictMatcherMatches()");
+        const ULine *lines=perf.getCachedLines();
+        int32_t numLines=perf.getNumLines();
+        for(int32_t i=0; i<numLines; ++i) {
+            // Skip comment lines (start with a character below 'A').
+            if(lines[i].name[0]<0x41) {
+                continue;
+            }
+            int32_t value;
+            int32_t wordLength=parseDictLine(lines[i], value);
+            builder.add(UnicodeString(false, lines[i].name, wordLength), value, errorCode);
+        }
+        int32_t length;
+        const int32_t *units=builder.build(length, errorCode);
+        printf("size of double array:        %6ld bytes\n", (long)length*4);
+        matcher.adoptInstead(new DoubleArrayDictionaryMatcher(units, NULL));
+    }
+
+protected:
+    DoubleArrayBuilder builder;
+};
+
 UPerfFunction *DictionaryTriePerfTest::runIndexedTest(int32_t index, UBool exec,
                                                       const char *&name, char * /*par*/) {
     if(hasFile()) {
@@ -670,6 +790,18 @@ UPerfFunction *DictionaryTriePerfTest::runIndexedTest(int32_t index, UBool exec,
                 return new BytesTrieDictContains(*this);
             }
             break;
+        case 4:
+            name="ucharsdictmatcher";
+            if(exec) {
+                return new UCharsDictMatcherMatches(*this);
+            }
+            break;
+        case 5:
+            name="doublearraydictmatcher";
+            if(exec) {
+                return new DoubleArrayDictMatcherMatches(*this);
+            }
+            break;
         default:
             name="";
             break;
@@ -20,6 +20,7 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
 :UPerfTest(argc,argv,status){
     int32_t start, end;
     srch = NULL;
+    srchSkipTable = NULL;
     pttrn = NULL;
     if(status== U_ILLEGAL_ARGUMENT_ERROR || line_mode){
        fprintf(stderr,gUsageString, "strsrchperf");
@@ -67,6 +68,10 @@ StringSearchPerformanceTest::StringSearchPerformanceTest(int32_t argc, const cha
     /* Create the StringSearch object to be use in performance test. */
     srch = usearch_open(pttrn, pttrnLen, src, srcLen, locale, NULL, &status);
 
+    /* Same search, with the Boyer-Moore-Horspool skip tables. */
+    srchSkipTable = usearch_open(pttrn, pttrnLen, src, srcLen, locale, NULL, &status);
+    usearch_setAttribute(srchSkipTable, USEARCH_SKIP_TABLE, USEARCH_ON, &status);
+
     if(U_FAILURE(status)){
         fprintf(stderr, "FAILED to create UPerfTest object. Error: %s\n", u_errorName(status));
         return;
@@ -81,12 +86,17 @@ StringSearchPerformanceTest::~StringSearchPerformanceTest() {
     if (srch != NULL) {
         usearch_close(srch);
     }
+    if (srchSkipTable != NULL) {
+        usearch_close(srchSkipTable);
+    }
 }
 
 UPerfFunction* StringSearchPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char *&name, char *par) {
     switch (index) {
         TESTCASE(0,Test_ICU_Forward_Search);
         TESTCASE(1,Test_ICU_Backward_Search);
+        TESTCASE(2,Test_ICU_Forward_Search_Skip_Table);
+        TESTCASE(3,Test_ICU_Backward_Search_Skip_Table);
 
         default: 
             name = ""; 
@@ -105,6 +115,16 @@ UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search(){
     return func;
 }
 
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Forward_Search_Skip_Table(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUForwardSearch, srchSkipTable, src, srcLen, pttrn, pttrnLen);
+    return func;
+}
+
+UPerfFunction* StringSearchPerformanceTest::Test_ICU_Backward_Search_Skip_Table(){
+    StringSearchPerfFunction* func = new StringSearchPerfFunction(ICUBackwardSearch, srchSkipTable, src, srcLen, pttrn, pttrnLen);
+    return func;
+}
+
 int main (int argc, const char* argv[]) {
     UErrorCode status = U_ZERO_ERROR;
     StringSearchPerformanceTest test(argc, argv, status);
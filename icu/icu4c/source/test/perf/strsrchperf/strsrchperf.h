@@ -53,6 +53,7 @@ class StringSearchPerformanceTest : public UPerfTest {
     UChar* pttrn;
     int32_t pttrnLen;
     UStringSearch* srch;
+    UStringSearch* srchSkipTable;
     
 public:
     StringSearchPerformanceTest(int32_t argc, const char *argv[], UErrorCode &status);
@@ -60,6 +61,8 @@ class StringSearchPerformanceTest : public UPerfTest {
     virtual UPerfFunction* runIndexedTest(int32_t index, UBool exec, const char *&name, char *par = NULL);
     UPerfFunction* Test_ICU_Forward_Search();
     UPerfFunction* Test_ICU_Backward_Search();
+    UPerfFunction* Test_ICU_Forward_Search_Skip_Table();
+    UPerfFunction* Test_ICU_Backward_Search_Skip_Table();
 };
 
 
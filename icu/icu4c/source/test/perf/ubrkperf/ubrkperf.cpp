@@ -21,9 +21,13 @@
 */
 
 #include "cmemory.h"
+#include "ubrkimpl.h"
 #include "ubrkperf.h"
 #include "uoptions.h"
+#include "unicode/uclean.h"
 #include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
 
 
 #if 0
@@ -160,6 +164,35 @@ UPerfFunction* BreakIteratorPerformanceTest::TestICUIsBound()
   return new ICUIsBound(locale, m_mode_, m_file_, m_fileLen_);
 }
 
+UPerfFunction* BreakIteratorPerformanceTest::TestICUFillBoundaries()
+{
+  return new ICUFillBoundaries(locale, m_mode_, m_file_, m_fileLen_);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUGetAllBoundaries()
+{
+  return new ICUGetAllBoundaries(locale, m_mode_, m_file_, m_fileLen_);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUClone()
+{
+  return new ICUClone(locale, m_mode_, m_file_, m_fileLen_);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICULSTMFindBreaks()
+{
+  if(m_model_ == NULL) {
+    fprintf(stderr, "TestICULSTMFindBreaks requires --model\n");
+    return NULL;
+  }
+  return new ICULSTMFindBreaks(m_modelDir_, m_model_, m_file_, m_fileLen_);
+}
+
+UPerfFunction* BreakIteratorPerformanceTest::TestICUUpdateBoundaries()
+{
+  return new ICUUpdateBoundaries(locale, m_mode_, m_file_, m_fileLen_);
+}
+
 UPerfFunction* BreakIteratorPerformanceTest::TestDarwinForward()
 {
   return NULL;
@@ -179,6 +212,11 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 		TESTCASE(1, TestICUIsBound);
 		TESTCASE(2, TestDarwinForward);
 		TESTCASE(3, TestDarwinIsBound);
+		TESTCASE(4, TestICUFillBoundaries);
+		TESTCASE(5, TestICUGetAllBoundaries);
+		TESTCASE(6, TestICUClone);
+		TESTCASE(7, TestICULSTMFindBreaks);
+		TESTCASE(8, TestICUUpdateBoundaries);
         default: 
             name = ""; 
             return NULL;
@@ -187,20 +225,21 @@ UPerfFunction* BreakIteratorPerformanceTest::runIndexedTest(int32_t index, UBool
 }
 
 UOption options[]={
-                      UOPTION_DEF( "mode",        'm', UOPT_REQUIRES_ARG)
+                      UOPTION_DEF( "mode",        'm', UOPT_REQUIRES_ARG),
+                      UOPTION_DEF( "model",       'M', UOPT_REQUIRES_ARG),
+                      UOPTION_DEF( "model-dir",   'D', UOPT_REQUIRES_ARG)
                   };
 
 
 BreakIteratorPerformanceTest::BreakIteratorPerformanceTest(int32_t argc, const char* argv[], UErrorCode& status)
-: UPerfTest(argc,argv,status),
+: UPerfTest(argc,argv,options,UPRV_LENGTHOF(options),NULL,status),
 m_mode_(NULL),
+m_model_(NULL),
+m_modelDir_(U_ICUDATA_BRKITR),
 m_file_(NULL),
 m_fileLen_(0)
 {
 
-    _remainingArgc = u_parseArgs(_remainingArgc, (char**)argv, UPRV_LENGTHOF(options), options);
-
-
     if(options[0].doesOccur) {
       m_mode_ = options[0].value;
       switch(options[0].value[0]) {
@@ -217,11 +256,20 @@ m_fileLen_(0)
       status = U_ILLEGAL_ARGUMENT_ERROR;
     }
 
+    if(options[1].doesOccur) {
+      m_model_ = options[1].value;
+    }
+    if(options[2].doesOccur) {
+      m_modelDir_ = options[2].value;
+    }
+
     m_file_ = getBuffer(m_fileLen_, status);
 
     if(status== U_ILLEGAL_ARGUMENT_ERROR){
        fprintf(stderr, gUsageString, "ubrkperf");
        fprintf(stderr, "\t-m or --mode        Required mode for breakiterator: char, word, line or sentence\n");
+       fprintf(stderr, "\t-M or --model       LSTM model for TestICULSTMFindBreaks, e.g. Thai_codepoints_exclusive_model4_heavy\n");
+       fprintf(stderr, "\t-D or --model-dir   Package or directory with the LSTM model, default: the ICU break iterator data\n");
 
        return;
     }
@@ -237,6 +285,54 @@ BreakIteratorPerformanceTest::~BreakIteratorPerformanceTest()
 }
 
 
+//----------------------------------------------------------------------------------------
+//
+//    Memory functions that keep track of the allocated heap memory.
+//    Each block starts with its size.
+//
+//----------------------------------------------------------------------------------------
+// Atomic because ICUGetAllBoundaries allocates on several threads.
+static std::atomic<int64_t> gLiveHeapBytes(0);
+
+static const size_t HEADER_SIZE = 16;  // keeps the alignment of malloc()
+
+int64_t getLiveHeapBytes() {
+    return gLiveHeapBytes;
+}
+
+static void * U_CALLCONV countingAlloc(const void * /*context*/, size_t size) {
+    char *p = (char *)malloc(HEADER_SIZE + size);
+    if (p == NULL) {
+        return NULL;
+    }
+    *(size_t *)p = size;
+    gLiveHeapBytes += size;
+    return p + HEADER_SIZE;
+}
+
+static void U_CALLCONV countingFree(const void * /*context*/, void *mem) {
+    if (mem != NULL) {
+        char *p = (char *)mem - HEADER_SIZE;
+        gLiveHeapBytes -= *(size_t *)p;
+        free(p);
+    }
+}
+
+static void * U_CALLCONV countingRealloc(const void *context, void *mem, size_t size) {
+    if (mem == NULL) {
+        return countingAlloc(context, size);
+    }
+    char *p = (char *)mem - HEADER_SIZE;
+    size_t oldSize = *(size_t *)p;
+    p = (char *)realloc(p, HEADER_SIZE + size);
+    if (p == NULL) {
+        return NULL;
+    }
+    *(size_t *)p = size;
+    gLiveHeapBytes += (int64_t)size - (int64_t)oldSize;
+    return p + HEADER_SIZE;
+}
+
 //----------------------------------------------------------------------------------------
 //
 //    Main   --  process command line, read in and pre-process the test file,
@@ -245,6 +341,8 @@ BreakIteratorPerformanceTest::~BreakIteratorPerformanceTest()
 //----------------------------------------------------------------------------------------
 int main(int argc, const char** argv) {
     UErrorCode status = U_ZERO_ERROR;
+    // Before any other use of ICU, so that every block is counted.
+    u_setMemoryFunctions(NULL, countingAlloc, countingRealloc, countingFree, &status);
     BreakIteratorPerformanceTest test(argc, argv, status);
     if(U_FAILURE(status)){
         return status;
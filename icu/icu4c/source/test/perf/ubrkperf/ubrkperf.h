@@ -12,9 +12,22 @@
 #ifndef _UBRKPERF_H
 #define _UBRKPERF_H
 
+#include <stdio.h>
+
 #include "unicode/uperf.h"
 
 #include <unicode/brkiter.h>
+#include <unicode/rbbi.h>
+#include <unicode/ures.h>
+#include <unicode/uscript.h>
+
+#include "brkeng.h"
+#include "cstring.h"
+#include "lstmbe.h"
+#include "uvectr32.h"
+
+/** Returns the number of bytes currently allocated via ICU's memory functions. */
+int64_t getLiveHeapBytes();
 
 class ICUBreakFunction : public UPerfFunction {
 protected:
@@ -107,6 +120,226 @@ class ICUForward : public ICUBreakFunction {
   }
 };
 
+class ICUFillBoundaries : public ICUBreakFunction {
+private:
+  int32_t m_boundaries_[1024];
+public:
+  ICUFillBoundaries(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUBreakFunction(locale, mode, file, file_len)
+  {
+    m_brkIt_->setText(UnicodeString(m_file_, m_fileLen_));
+    call(&m_status_);
+  }
+
+  virtual void call(UErrorCode *status)
+  {
+    RuleBasedBreakIterator *rbbi = static_cast<RuleBasedBreakIterator *>(m_brkIt_);
+    int32_t length;
+    m_noBreaks_ = 0;
+    rbbi->first();
+    while((length = rbbi->fillBoundaries(m_boundaries_, NULL, UPRV_LENGTHOF(m_boundaries_), *status)) > 0) {
+      m_noBreaks_ += length;
+    }
+  }
+};
+
+class ICUGetAllBoundaries : public ICUBreakFunction {
+private:
+  UnicodeString m_text_;
+  UText *m_ut_;
+  int32_t *m_boundaries_;
+public:
+  ICUGetAllBoundaries(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUBreakFunction(locale, mode, file, file_len),
+      m_text_(false, file, file_len),
+      m_ut_(utext_openConstUnicodeString(NULL, &m_text_, &m_status_)),
+      m_boundaries_(new int32_t[file_len + 1])
+  {
+    call(&m_status_);
+  }
+
+  ~ICUGetAllBoundaries() {
+    utext_close(m_ut_);
+    delete[] m_boundaries_;
+  }
+
+  virtual void call(UErrorCode *status)
+  {
+    // All hardware threads.
+    m_noBreaks_ = static_cast<RuleBasedBreakIterator *>(m_brkIt_)->getAllBoundaries(
+        m_ut_, m_boundaries_, NULL, m_fileLen_ + 1, 0, *status);
+  }
+};
+
+/**
+ * Replaces a character in the middle of the text and back again,
+ * updating the boundaries with updateBoundaries() after each edit.
+ * One operation is one edit.
+ */
+class ICUUpdateBoundaries : public ICUBreakFunction {
+private:
+  UnicodeString m_texts_[2];
+  int32_t *m_boundaries_;
+  int32_t m_capacity_;
+  int32_t m_current_;
+public:
+  ICUUpdateBoundaries(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUBreakFunction(locale, mode, file, file_len),
+      m_capacity_(file_len + 2),
+      m_current_(0)
+  {
+    m_boundaries_ = new int32_t[m_capacity_];
+    m_texts_[0].setTo(file, file_len);
+    m_texts_[1].setTo(file, file_len);
+    if(file_len > 0) {
+      m_texts_[1].setCharAt(file_len / 2, m_texts_[0].charAt(file_len / 2) == u'x' ? u'y' : u'x');
+    }
+    m_brkIt_->setText(m_texts_[0]);
+    m_brkIt_->first();
+    m_noBreaks_ = static_cast<RuleBasedBreakIterator *>(m_brkIt_)->fillBoundaries(
+        m_boundaries_, NULL, m_capacity_, m_status_);
+  }
+
+  ~ICUUpdateBoundaries() { delete[] m_boundaries_; }
+
+  virtual void call(UErrorCode *status)
+  {
+    m_current_ ^= 1;
+    m_brkIt_->setText(m_texts_[m_current_]);
+    int32_t middle = m_fileLen_ / 2;
+    m_noBreaks_ = static_cast<RuleBasedBreakIterator *>(m_brkIt_)->updateBoundaries(
+        middle, middle + 1, middle + 1, m_boundaries_, NULL, m_noBreaks_, m_capacity_, *status);
+  }
+  virtual long getOperationsPerIteration() { return 1; }
+};
+
+/**
+ * Clones the break iterator and segments the start of the text with the clone.
+ * One operation is one clone, for the clone latency.
+ * The constructor also prints the heap memory held by each clone,
+ * as counted by the memory functions that main() sets.
+ */
+class ICUClone : public ICUBreakFunction {
+private:
+  UnicodeString m_text_;
+  int32_t m_prefixLen_;
+  int32_t m_cloneBytes_;
+
+  static const int32_t PREFIX_LENGTH = 100;
+  static const int32_t NUM_CLONES = 1000;
+
+  BreakIterator *cloneAndSegment() {
+    BreakIterator *clone = m_brkIt_->clone();
+    if(clone != NULL) {
+      clone->setText(m_text_);
+      while(clone->next() != BreakIterator::DONE) {
+        m_noBreaks_++;
+      }
+    }
+    return clone;
+  }
+public:
+  ICUClone(const char *locale, const char *mode, const UChar *file, int32_t file_len) :
+      ICUBreakFunction(locale, mode, file, file_len),
+      m_text_(false, file, file_len < PREFIX_LENGTH ? file_len : PREFIX_LENGTH),
+      m_prefixLen_(m_text_.length()),
+      m_cloneBytes_(0)
+  {
+    if(m_brkIt_ == NULL) {
+      return;
+    }
+    // Let the original iterator find its dictionary engines first, as an application would.
+    m_brkIt_->setText(m_text_);
+    while(m_brkIt_->next() != BreakIterator::DONE) {}
+    BreakIterator **clones = new BreakIterator *[NUM_CLONES];
+    int64_t before = getLiveHeapBytes();
+    for(int32_t i = 0; i < NUM_CLONES; i++) {
+      clones[i] = cloneAndSegment();
+    }
+    m_cloneBytes_ = (int32_t)((getLiveHeapBytes() - before) / NUM_CLONES);
+    for(int32_t i = 0; i < NUM_CLONES; i++) {
+      delete clones[i];
+    }
+    delete[] clones;
+    fprintf(stdout, "ICUClone: %d bytes of heap memory per clone, segmenting %d code units\n",
+            (int)m_cloneBytes_, (int)m_prefixLen_);
+  }
+
+  virtual void call(UErrorCode *status)
+  {
+    m_noBreaks_ = 0;
+    delete cloneAndSegment();
+  }
+  virtual long getOperationsPerIteration() { return 1; }
+};
+
+/**
+ * Finds breaks with an LSTMBreakEngine in all of the runs of text that it handles.
+ * For comparison with the dictionary break engines, run TestICUForward
+ * with the same file, the word mode and the language of the text.
+ */
+class ICULSTMFindBreaks : public UPerfFunction {
+private:
+  UErrorCode m_status_;
+  const LanguageBreakEngine *m_engine_;
+  UnicodeString m_text_;
+  UText *m_ut_;
+  UVector32 m_breaks_;
+  int32_t m_noBreaks_;
+public:
+  ICULSTMFindBreaks(const char *modelDir, const char *model, const UChar *file, int32_t file_len) :
+      m_status_(U_ZERO_ERROR),
+      m_engine_(NULL),
+      m_text_(false, file, file_len),
+      m_ut_(NULL),
+      m_breaks_(m_status_),
+      m_noBreaks_(-1)
+  {
+    UScriptCode script = USCRIPT_INVALID_CODE;
+    if(uprv_strncmp(model, "Thai", 4) == 0) {
+      script = USCRIPT_THAI;
+    } else if(uprv_strncmp(model, "Burmese", 7) == 0) {
+      script = USCRIPT_MYANMAR;
+    } else {
+      m_status_ = U_ILLEGAL_ARGUMENT_ERROR;
+      return;
+    }
+    const LSTMData *data = CreateLSTMData(ures_openDirect(modelDir, model, &m_status_), m_status_);
+    m_engine_ = CreateLSTMBreakEngine(script, data, m_status_);
+    m_ut_ = utext_openConstUnicodeString(NULL, &m_text_, &m_status_);
+    if(U_FAILURE(m_status_)) {
+      fprintf(stderr, "Unable to load the LSTM model %s from %s: %s\n",
+              model, modelDir != NULL ? modelDir : "the ICU data", u_errorName(m_status_));
+      return;
+    }
+    call(&m_status_);
+  }
+
+  ~ICULSTMFindBreaks() {
+    utext_close(m_ut_);
+    delete m_engine_;
+  }
+
+  virtual void call(UErrorCode *status)
+  {
+    m_breaks_.removeAllElements();
+    int32_t i = 0;
+    while(i < m_text_.length() && U_SUCCESS(*status)) {
+      if(m_engine_->handles(m_text_.char32At(i))) {
+        utext_setNativeIndex(m_ut_, i);
+        m_engine_->findBreaks(m_ut_, i, m_text_.length(), m_breaks_, false, nullptr, *status);
+        i = (int32_t)utext_getNativeIndex(m_ut_);
+      } else {
+        i = m_text_.moveIndex32(i, 1);
+      }
+    }
+    m_noBreaks_ = m_breaks_.size();
+  }
+  virtual long getOperationsPerIteration() { return m_text_.length(); }
+  virtual long getEventsPerIteration() { return m_noBreaks_; }
+  virtual UErrorCode getStatus() { return m_status_; }
+};
+
 class DarwinBreakFunction : public UPerfFunction {
 public:
   virtual void call(UErrorCode *status) {};
@@ -115,6 +348,8 @@ class DarwinBreakFunction : public UPerfFunction {
 class BreakIteratorPerformanceTest : public UPerfTest {
 private:
   const char* m_mode_;
+  const char* m_model_;
+  const char* m_modelDir_;
   const UChar* m_file_;
   int32_t m_fileLen_;
 
@@ -130,6 +365,11 @@ class BreakIteratorPerformanceTest : public UPerfTest {
 
   UPerfFunction* TestDarwinForward();
   UPerfFunction* TestDarwinIsBound();
+  UPerfFunction* TestICUFillBoundaries();
+  UPerfFunction* TestICUGetAllBoundaries();
+  UPerfFunction* TestICUClone();
+  UPerfFunction* TestICULSTMFindBreaks();
+  UPerfFunction* TestICUUpdateBoundaries();
 
 };
 
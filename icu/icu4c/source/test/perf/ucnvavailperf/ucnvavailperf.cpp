@@ -23,6 +23,9 @@
 *   for a before-and-after comparison of
 *   ticket 6441: make ucnv_countAvailable() not fully load converters
 *
+*   Also measures opening and closing converters on multiple threads,
+*   with ucnv_open()/ucnv_close() and with ucnv_openPooled()/ucnv_recycle().
+*
 *   Run with one optional command-line argument:
 *   You can specify the path to the ICU data directory.
 *
@@ -44,13 +47,16 @@
 
 #include <malloc.h>
 #include <stdio.h>
+#include <atomic>
+#include <thread>
+#include <vector>
 #include "unicode/utypes.h"
 #include "unicode/putil.h"
 #include "unicode/uclean.h"
 #include "unicode/ucnv.h"
 #include "unicode/utimer.h"
 
-static size_t icuMemUsage = 0;
+static std::atomic<size_t> icuMemUsage(0);
 
 U_CDECL_BEGIN
 
@@ -84,6 +90,44 @@ my_realloc(const void *context, void *mem, size_t size) {
 
 U_CDECL_END
 
+static const int32_t OPEN_CLOSE_ITERATIONS = 200000;
+
+// Opens and closes a converter OPEN_CLOSE_ITERATIONS times on each of numThreads threads.
+// Returns the number of open/close pairs per second, summed over all threads.
+static double
+openCloseOnThreads(const char *name, int32_t numThreads, bool pooled) {
+    std::vector<std::thread> threads;
+    std::atomic<int32_t> failures(0);
+    UTimer start_time;
+    utimer_getTime(&start_time);
+    for (int32_t t = 0; t < numThreads; ++t) {
+        threads.emplace_back([name, pooled, &failures]() {
+            for (int32_t i = 0; i < OPEN_CLOSE_ITERATIONS; ++i) {
+                UErrorCode errorCode = U_ZERO_ERROR;
+                UConverter *cnv;
+                if (pooled) {
+                    cnv = ucnv_openPooled(name, &errorCode);
+                    ucnv_recycle(cnv);
+                } else {
+                    cnv = ucnv_open(name, &errorCode);
+                    ucnv_close(cnv);
+                }
+                if (U_FAILURE(errorCode)) {
+                    ++failures;
+                }
+            }
+        });
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    double elapsed = utimer_getElapsedSeconds(&start_time);
+    if (failures > 0) {
+        fprintf(stderr, "%d failures opening %s\n", (int)failures, name);
+    }
+    return ((double)numThreads * OPEN_CLOSE_ITERATIONS) / elapsed;
+}
+
 int main(int argc, const char *argv[]) {
     UErrorCode errorCode = U_ZERO_ERROR;
 
@@ -125,6 +169,19 @@ int main(int argc, const char *argv[]) {
     printf("ucnv_countAvailable() took %g seconds to figure this out.\n", elapsed);
     printf("memory usage after ucnv_countAvailable(): %lu\n", (long)icuMemUsage);
 
+    // Measure opening and closing converters on multiple threads,
+    // with contention on the converter cache mutex vs. using the converter pool.
+    static const char *const names[] = { "UTF-8", "Shift_JIS" };
+    for (const char *name : names) {
+        for (int32_t numThreads = 1; numThreads <= 8; numThreads *= 2) {
+            double plain = openCloseOnThreads(name, numThreads, false);
+            double pooled = openCloseOnThreads(name, numThreads, true);
+            printf("%-9s on %d threads: ucnv_open/close %10.0f/s  ucnv_openPooled/recycle %10.0f/s\n",
+                   name, (int)numThreads, plain, pooled);
+        }
+    }
+    printf("memory usage after opening and closing converters: %lu\n", (long)icuMemUsage);
+
     ucnv_flushCache();
     printf("memory usage after ucnv_flushCache(): %lu\n", (long)icuMemUsage);
 
@@ -38,6 +38,7 @@ static UChar pivot[INTERMEDIATE_CAPACITY];
 
 static UChar output[OUTPUT_CAPACITY];
 static char intermediate[OUTPUT_CAPACITY];
+static char encoded[3*INPUT_CAPACITY];
 
 static int32_t utf8Length, encodedLength, outputLength, countInputCodePoints;
 
@@ -262,6 +263,78 @@ class FromUnicode : public Command {
     }
 };
 
+// Test one-way conversion encoding->UTF-16.
+class ToUnicode : public Command {
+protected:
+    ToUnicode(const UtfPerformanceTest &testcase) : Command(testcase), encodedInputLength(0) {
+        if (U_SUCCESS(errorCode)) {
+            encodedInputLength=ucnv_fromUChars(cnv, encoded, (int32_t)sizeof(encoded),
+                                               input, inputLength, &errorCode);
+        }
+    }
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        ToUnicode * t = new ToUnicode(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        const char *pIn, *pInLimit, *pChunkLimit;
+        UChar *pOut;
+
+        ucnv_resetToUnicode(cnv);
+
+        pIn=encoded;
+        pInLimit=encoded+encodedInputLength;
+        pOut=output;
+
+        /* feed the input in chunks of the charset chunk length */
+        do {
+            pChunkLimit=(pInLimit-pIn)>testcase.chunkLength ? pIn+testcase.chunkLength : pInLimit;
+            ucnv_toUnicode(cnv, &pOut, output+OUTPUT_CAPACITY, &pIn, pChunkLimit,
+                           NULL, pChunkLimit==pInLimit, pErrorCode);
+            if(U_FAILURE(*pErrorCode)) {
+                return;
+            }
+        } while(pIn<pInLimit);
+        outputLength=(int32_t)(pOut-output);
+    }
+protected:
+    int32_t encodedInputLength;
+};
+
+// Test u_strFromUTF8() UTF-8->UTF-16, independent of the charset.
+class StrFromUTF8 : public UPerfFunction {
+public:
+    virtual void call(UErrorCode* pErrorCode){
+        u_strFromUTF8(output, OUTPUT_CAPACITY, &outputLength, utf8, utf8Length, pErrorCode);
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+};
+
+// Test u_strToUTF8() UTF-16->UTF-8, independent of the charset.
+class StrToUTF8 : public UPerfFunction {
+public:
+    StrToUTF8(const UtfPerformanceTest &testcase)
+            : input(testcase.getBuffer()), inputLength(testcase.getBufferLen()) {}
+    virtual void call(UErrorCode* pErrorCode){
+        u_strToUTF8(encoded, (int32_t)sizeof(encoded), &encodedLength,
+                    input, inputLength, pErrorCode);
+    }
+    virtual long getOperationsPerIteration(){
+        return countInputCodePoints;
+    }
+private:
+    const UChar *input;
+    int32_t inputLength;
+};
+
 // Test one-way conversion UTF-8->encoding.
 class FromUTF8 : public Command {
 protected:
@@ -328,11 +401,82 @@ class FromUTF8 : public Command {
     int32_t input8Length;
 };
 
+// Test one-way conversion encoding->UTF-8.
+class ToUTF8 : public Command {
+protected:
+    ToUTF8(const UtfPerformanceTest &testcase)
+            : Command(testcase),
+              utf8Cnv(NULL), encodedInputLength(0) {
+        utf8Cnv=ucnv_open("UTF-8", &errorCode);
+        if (U_SUCCESS(errorCode)) {
+            encodedInputLength=ucnv_fromUChars(cnv, encoded, (int32_t)sizeof(encoded),
+                                               input, inputLength, &errorCode);
+        }
+    }
+public:
+    static UPerfFunction* get(const UtfPerformanceTest &testcase) {
+        ToUTF8 * t = new ToUTF8(testcase);
+        if (U_SUCCESS(t->errorCode)){
+            return t;
+        } else {
+            delete t;
+            return NULL;
+        }
+    }
+    ~ToUTF8() {
+        ucnv_close(utf8Cnv);
+    }
+    virtual void call(UErrorCode* pErrorCode){
+        const char *pIn, *pInLimit;
+        char *pInter, *pInterLimit;
+        UChar *pivotSource, *pivotTarget, *pivotLimit;
+
+        ucnv_resetToUnicode(cnv);
+        ucnv_resetFromUnicode(utf8Cnv);
+
+        pIn=encoded;
+        pInLimit=encoded+encodedInputLength;
+
+        pInterLimit=intermediate+testcase.chunkLength;
+
+        pivotSource=pivotTarget=pivot;
+        pivotLimit=pivot+testcase.pivotLength;
+
+        outputLength=0;
+
+        for(;;) {
+            pInter=intermediate;
+            ucnv_convertEx(utf8Cnv, cnv,
+                           &pInter, pInterLimit,
+                           &pIn, pInLimit,
+                           pivot, &pivotSource, &pivotTarget, pivotLimit,
+                           false, true, pErrorCode);
+            outputLength+=(int32_t)(pInter-intermediate);
+
+            if(*pErrorCode==U_BUFFER_OVERFLOW_ERROR) {
+                /* make sure that we convert once more to really flush */
+                *pErrorCode=U_ZERO_ERROR;
+            } else if(U_FAILURE(*pErrorCode)) {
+                return;
+            } else {
+                break;  // all done
+            }
+        }
+    }
+protected:
+    UConverter *utf8Cnv;
+    int32_t encodedInputLength;
+};
+
 UPerfFunction* UtfPerformanceTest::runIndexedTest(int32_t index, UBool exec, const char* &name, char* par) {
     switch (index) {
         case 0: name = "Roundtrip";     if (exec) return Roundtrip::get(*this); break;
         case 1: name = "FromUnicode";   if (exec) return FromUnicode::get(*this); break;
         case 2: name = "FromUTF8";      if (exec) return FromUTF8::get(*this); break;
+        case 3: name = "ToUnicode";     if (exec) return ToUnicode::get(*this); break;
+        case 4: name = "StrFromUTF8";   if (exec) return new StrFromUTF8(); break;
+        case 5: name = "StrToUTF8";     if (exec) return new StrToUTF8(*this); break;
+        case 6: name = "ToUTF8";        if (exec) return ToUTF8::get(*this); break;
         default: name = ""; break;
     }
     return NULL;
@@ -27,6 +27,7 @@
 
 #include "charstr.h"
 #include "dictionarydata.h"
+#include "doublearraybuilder.h"
 #include "uoptions.h"
 #include "unewdata.h"
 #include "cmemory.h"
@@ -59,6 +60,7 @@ static UOption options[]={
     { "bytes", NULL, NULL, NULL, '\1', UOPT_NO_ARG, 0}, /* 7 */
     { "transform", NULL, NULL, NULL, '\1', UOPT_REQUIRES_ARG, 0}, /* 8 */
     UOPTION_QUIET,              /* 9 */
+    { "double-array", NULL, NULL, NULL, '\1', UOPT_NO_ARG, 0}, /* 10 */
 };
 
 enum arguments {
@@ -70,7 +72,8 @@ enum arguments {
     ARG_UCHARS,
     ARG_BYTES,
     ARG_TRANSFORM,
-    ARG_QUIET
+    ARG_QUIET,
+    ARG_DOUBLE_ARRAY
 };
 
 // prints out the standard usage method describing command line arguments, 
@@ -89,6 +92,8 @@ static void usageAndDie(UErrorCode retCode) {
            "\t                    followed by path, defaults to %s\n"
            "\t--uchars            output a UCharsTrie (mutually exclusive with -b!)\n"
            "\t--bytes             output a BytesTrie (mutually exclusive with -u!)\n"
+           "\t--double-array      output a double-array trie, larger but faster to match\n"
+           "\t                    (mutually exclusive with -u and -b!)\n"
            "\t--transform         the kind of transform to use (eg --transform offset-40A3,\n"
            "\t                    which specifies an offset transform with constant 0x40A3)\n",
             u_getDataDirectory());
@@ -113,32 +118,37 @@ static UDataInfo dataInfo = {
 
 #if !UCONFIG_NO_BREAK_ITERATION
 
-// A wrapper for both BytesTrieBuilder and UCharsTrieBuilder.
+// A wrapper for BytesTrieBuilder, UCharsTrieBuilder and DoubleArrayBuilder.
 // may want to put this somewhere in ICU, as it could be useful outside
 // of this tool?
 class DataDict {
 private:
     BytesTrieBuilder *bt;
     UCharsTrieBuilder *ut;
+    DoubleArrayBuilder *da;
     UChar32 transformConstant;
     int32_t transformType;
 public:
     // constructs a new data dictionary. if there is an error, 
     // it will be returned in status
-    // isBytesTrie != 0 will produce a BytesTrieBuilder,
-    // isBytesTrie == 0 will produce a UCharsTrieBuilder
-    DataDict(UBool isBytesTrie, UErrorCode &status) : bt(NULL), ut(NULL), 
+    // trieType TRIE_TYPE_BYTES will produce a BytesTrieBuilder,
+    // TRIE_TYPE_UCHARS a UCharsTrieBuilder,
+    // and TRIE_TYPE_DOUBLE_ARRAY a DoubleArrayBuilder
+    DataDict(int32_t trieType, UErrorCode &status) : bt(NULL), ut(NULL), da(NULL),
         transformConstant(0), transformType(DictionaryData::TRANSFORM_NONE) {
-        if (isBytesTrie) {
+        if (trieType == DictionaryData::TRIE_TYPE_BYTES) {
             bt = new BytesTrieBuilder(status);
-        } else {
+        } else if (trieType == DictionaryData::TRIE_TYPE_UCHARS) {
             ut = new UCharsTrieBuilder(status);
+        } else {
+            da = new DoubleArrayBuilder();
         }
     }
 
     ~DataDict() {
         delete bt;
         delete ut;
+        delete da;
     }
 
 private:
@@ -199,6 +209,7 @@ class DataDict {
             bt->add(buf.toStringPiece(), value, status);
         }
         if (ut) { ut->add(word, value, status); }
+        if (da) { da->add(word, value, status); }
     }
 
     // if we are a bytestrie, give back the StringPiece representing the serialized version of us
@@ -211,6 +222,11 @@ class DataDict {
         ut->buildUnicodeString(USTRINGTRIE_BUILD_SMALL, s, status);
     }
 
+    // if we are a double array, give back its (base, check) units
+    const int32_t *serializeDoubleArray(int32_t &length, UErrorCode &status) {
+        return da->build(length, status);
+    }
+
     int32_t getTransform() {
         return (int32_t)(transformType | transformConstant); 
     }
@@ -281,11 +297,15 @@ int  main(int argc, char **argv) {
         copyright = U_COPYRIGHT_STRING;
     }
 
-    if (options[ARG_UCHARS].doesOccur == options[ARG_BYTES].doesOccur) {
+    if (options[ARG_UCHARS].doesOccur + options[ARG_BYTES].doesOccur +
+            options[ARG_DOUBLE_ARRAY].doesOccur != 1) {
         fprintf(stderr, "you must specify exactly one type of trie to output!\n");
         usageAndDie(U_ILLEGAL_ARGUMENT_ERROR);
     }
     UBool isBytesTrie = options[ARG_BYTES].doesOccur;
+    int32_t trieType = isBytesTrie ? DictionaryData::TRIE_TYPE_BYTES :
+        options[ARG_UCHARS].doesOccur ? DictionaryData::TRIE_TYPE_UCHARS :
+        DictionaryData::TRIE_TYPE_DOUBLE_ARRAY;
     if (isBytesTrie != options[ARG_TRANSFORM].doesOccur) {
         fprintf(stderr, "you must provide a transformation for a bytes trie, and must not provide one for a uchars trie!\n");
         usageAndDie(U_ILLEGAL_ARGUMENT_ERROR);
@@ -319,8 +339,12 @@ int  main(int argc, char **argv) {
         fprintf(stderr, "error opening input file: ICU Error \"%s\"\n", status.errorName());
         exit(status.reset());
     }
-    if (verbose) { printf("Initializing dictionary builder of type %s...\n", (isBytesTrie ? "BytesTrie" : "UCharsTrie")); }
-    DataDict dict(isBytesTrie, status);
+    if (verbose) {
+        printf("Initializing dictionary builder of type %s...\n",
+               (isBytesTrie ? "BytesTrie" :
+                trieType == DictionaryData::TRIE_TYPE_UCHARS ? "UCharsTrie" : "double array"));
+    }
+    DataDict dict(trieType, status);
     if (status.isFailure()) {
         fprintf(stderr, "new DataDict: ICU Error \"%s\"\n", status.errorName());
         exit(status.reset());
@@ -399,7 +423,7 @@ int  main(int argc, char **argv) {
         fprintf(stderr, "warning: file contained both valued and unvalued strings!\n");
     }
 
-    if (verbose) { printf("Serializing data...isBytesTrie? %d\n", isBytesTrie); }
+    if (verbose) { printf("Serializing data...trie type %d\n", (int)trieType); }
     int32_t outDataSize;
     const void *outData;
     UnicodeString usp;
@@ -407,6 +431,10 @@ int  main(int argc, char **argv) {
         StringPiece sp = dict.serializeBytes(status);
         outDataSize = sp.size();
         outData = sp.data();
+    } else if (trieType == DictionaryData::TRIE_TYPE_DOUBLE_ARRAY) {
+        int32_t length;
+        outData = dict.serializeDoubleArray(length, status);
+        outDataSize = length * 4;
     } else {
         dict.serializeUChars(usp, status);
         outDataSize = usp.length() * U_SIZEOF_UCHAR;
@@ -432,7 +460,7 @@ int  main(int argc, char **argv) {
     indexes[DictionaryData::IX_RESERVED2_OFFSET] = size;
     indexes[DictionaryData::IX_TOTAL_SIZE] = size;
 
-    indexes[DictionaryData::IX_TRIE_TYPE] = isBytesTrie ? DictionaryData::TRIE_TYPE_BYTES : DictionaryData::TRIE_TYPE_UCHARS;
+    indexes[DictionaryData::IX_TRIE_TYPE] = trieType;
     if (hasValues) {
         indexes[DictionaryData::IX_TRIE_TYPE] |= DictionaryData::TRIE_HAS_VALUES;
     }
@@ -462,7 +490,7 @@ int  main(int argc, char **argv) {
             int32_t val = it.getValue();
             printf("%s -> %i\n", s.data(), val);
         }
-    } else {
+    } else if (trieType == DictionaryData::TRIE_TYPE_UCHARS) {
         UCharsTrie::Iterator it((const UChar *)outData, outDataSize, status);
         while (it.hasNext()) {
             it.next(status);
@@ -0,0 +1,200 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  doublearraybuilder.cpp
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2026oct17
+*
+* Builder for the double-array trie dictionaries of dictionary-based break iteration.
+*/
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/utf16.h"
+#include "unicode/utf8.h"
+#include "doublearraybuilder.h"
+#include "uarrsort.h"
+
+U_NAMESPACE_BEGIN
+
+namespace {
+
+// Number of labels: 0 for the end of a word, 1+b for byte b.
+constexpr int32_t LABEL_COUNT = 257;
+
+}  // namespace
+
+int32_t U_CALLCONV
+DoubleArrayBuilder::compareWords(const void *context, const void *left, const void *right) {
+    const char *words = static_cast<const char *>(context);
+    const Word &l = *static_cast<const Word *>(left);
+    const Word &r = *static_cast<const Word *>(right);
+    int32_t minLength = l.length <= r.length ? l.length : r.length;
+    int32_t diff = uprv_memcmp(words + l.offset, words + r.offset, minLength);
+    if (diff != 0) {
+        return diff;
+    }
+    return l.length - r.length;
+}
+
+DoubleArrayBuilder::DoubleArrayBuilder()
+        : wordCount(0), unitsLength(0), unitCount(0), nextCheckPos(0) {}
+
+DoubleArrayBuilder::~DoubleArrayBuilder() {}
+
+void DoubleArrayBuilder::add(const UnicodeString &word, int32_t value, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return; }
+    if (word.isEmpty()) {
+        errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+        return;
+    }
+    if (wordCount == wordList.getCapacity() &&
+            wordList.resize(2 * wordCount, wordCount) == nullptr) {
+        errorCode = U_MEMORY_ALLOCATION_ERROR;
+        return;
+    }
+    Word &w = wordList[wordCount];
+    w.offset = words.length();
+    w.value = value;
+    UChar32 c;
+    for (int32_t i = 0; i < word.length(); i += U16_LENGTH(c)) {
+        c = word.char32At(i);
+        char bytes[U8_MAX_LENGTH];
+        int32_t length = 0;
+        U8_APPEND_UNSAFE(bytes, length, c);
+        words.append(bytes, length, errorCode);
+    }
+    w.length = words.length() - w.offset;
+    if (U_SUCCESS(errorCode)) {
+        ++wordCount;
+    }
+}
+
+const int32_t *DoubleArrayBuilder::build(int32_t &length, UErrorCode &errorCode) {
+    length = 0;
+    if (U_FAILURE(errorCode)) { return nullptr; }
+    uprv_sortArray(wordList.getAlias(), wordCount, (int32_t)sizeof(Word),
+                   compareWords, words.data(), false, &errorCode);
+    unitsLength = 0;
+    if (!ensureUnits(1, errorCode)) { return nullptr; }
+    unitCount = 1;
+    nextCheckPos = 1;
+    buildNode(0, 0, wordCount, 0, errorCode);
+    // Pad the array so that base+1+b is inside it for every node.
+    if (!ensureUnits(unitCount + LABEL_COUNT, errorCode)) { return nullptr; }
+    length = 2 * (unitCount + LABEL_COUNT);
+    return units.getAlias();
+}
+
+UBool DoubleArrayBuilder::ensureUnits(int32_t count, UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode)) { return false; }
+    if (count <= unitsLength) { return true; }
+    int32_t capacity = units.getCapacity() / 2;
+    if (count > capacity) {
+        int32_t newCapacity = 2 * capacity;
+        if (newCapacity < count + LABEL_COUNT) { newCapacity = count + LABEL_COUNT; }
+        if (units.resize(2 * newCapacity, 2 * unitsLength) == nullptr) {
+            errorCode = U_MEMORY_ALLOCATION_ERROR;
+            return false;
+        }
+    }
+    for (; unitsLength < count; ++unitsLength) {
+        units[2 * unitsLength] = 0;
+        units[2 * unitsLength + 1] = -1;
+    }
+    return true;
+}
+
+/**
+ * Returns the lowest base >= 1 where the units for all of the ascending labels are free.
+ * As in other double-array builders, the search starts from the first free unit,
+ * which moves up once the units below a found base are nearly all used.
+ */
+int32_t DoubleArrayBuilder::findBase(const int32_t *labels, int32_t labelCount, UErrorCode &errorCode) {
+    int32_t pos = nextCheckPos > labels[0] ? nextCheckPos : labels[0] + 1;
+    int32_t firstFree = -1;
+    int32_t numUsed = 0;
+    for (;; ++pos) {
+        if (!ensureUnits(pos + 1, errorCode)) { return -1; }
+        if (units[2 * pos + 1] != -1) {
+            ++numUsed;
+            continue;
+        }
+        if (firstFree < 0) {
+            firstFree = pos;
+        }
+        int32_t base = pos - labels[0];
+        if (!ensureUnits(base + labels[labelCount - 1] + 1, errorCode)) { return -1; }
+        int32_t i = 1;
+        while (i < labelCount && units[2 * (base + labels[i]) + 1] == -1) {
+            ++i;
+        }
+        if (i == labelCount) {
+            nextCheckPos = firstFree;
+            if (numUsed * 20 >= (pos - firstFree + 1) * 19) {
+                nextCheckPos = pos;
+            }
+            return base;
+        }
+    }
+}
+
+/**
+ * Places the children of node for the sorted words [start, limit[
+ * which share their first depth bytes.
+ */
+void DoubleArrayBuilder::buildNode(int32_t node, int32_t start, int32_t limit, int32_t depth,
+                                   UErrorCode &errorCode) {
+    if (U_FAILURE(errorCode) || start == limit) { return; }
+    int32_t labels[LABEL_COUNT];
+    int32_t starts[LABEL_COUNT + 1];
+    int32_t labelCount = 0;
+    int32_t i = start;
+    if (wordList[i].length == depth) {
+        labels[labelCount] = 0;
+        starts[labelCount++] = i++;
+        if (i < limit && wordList[i].length == depth) {
+            // duplicate word
+            errorCode = U_ILLEGAL_ARGUMENT_ERROR;
+            return;
+        }
+    }
+    while (i < limit) {
+        int32_t b = getByte(wordList[i], depth);
+        labels[labelCount] = 1 + b;
+        starts[labelCount++] = i;
+        do {
+            ++i;
+        } while (i < limit && getByte(wordList[i], depth) == b);
+    }
+    starts[labelCount] = limit;
+
+    int32_t base = findBase(labels, labelCount, errorCode);
+    if (U_FAILURE(errorCode)) { return; }
+    for (int32_t j = 0; j < labelCount; ++j) {
+        units[2 * (base + labels[j]) + 1] = node;
+    }
+    if (labels[0] == 0) {
+        units[2 * base] = wordList[start].value;
+    }
+    units[2 * node] = (labelCount == 1 && labels[0] == 0) ? ~base : base;
+    int32_t end = base + labels[labelCount - 1] + 1;
+    if (end > unitCount) {
+        unitCount = end;
+    }
+    for (int32_t j = 0; j < labelCount; ++j) {
+        if (labels[j] != 0) {
+            buildNode(base + labels[j], starts[j], starts[j + 1], depth + 1, errorCode);
+        }
+    }
+}
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
@@ -0,0 +1,82 @@
+// © 2026 and later: Unicode, Inc. and others.
+// License & terms of use: http://www.unicode.org/copyright.html
+/*
+*******************************************************************************
+*   file name:  doublearraybuilder.h
+*   encoding:   UTF-8
+*   tab size:   8 (not used)
+*   indentation:4
+*
+*   created on: 2026oct17
+*
+* Builder for the double-array trie dictionaries of dictionary-based break iteration.
+*/
+
+#ifndef __DOUBLEARRAYBUILDER_H__
+#define __DOUBLEARRAYBUILDER_H__
+
+#include "unicode/utypes.h"
+
+#if !UCONFIG_NO_BREAK_ITERATION
+
+#include "unicode/uobject.h"
+#include "unicode/unistr.h"
+#include "charstr.h"
+#include "cmemory.h"
+
+U_NAMESPACE_BEGIN
+
+/**
+ * Builds the double array for a DictionaryData::TRIE_TYPE_DOUBLE_ARRAY dictionary.
+ * See dictionarydata.h for the format.
+ */
+class U_TOOLUTIL_API DoubleArrayBuilder : public UMemory {
+public:
+    DoubleArrayBuilder();
+    ~DoubleArrayBuilder();
+
+    /**
+     * Adds a word and its value.
+     * Sets U_ILLEGAL_ARGUMENT_ERROR for an empty word.
+     */
+    void add(const UnicodeString &word, int32_t value, UErrorCode &errorCode);
+
+    /**
+     * Builds the double array from the words added so far.
+     * Sets U_ILLEGAL_ARGUMENT_ERROR if a word was added more than once.
+     * @param length receives the number of int32_t values, twice the number of units
+     * @return the (base, check) pairs, owned by the builder and valid until the next add() or build()
+     */
+    const int32_t *build(int32_t &length, UErrorCode &errorCode);
+
+private:
+    struct Word {
+        int32_t offset;  // UTF-8 bytes in words
+        int32_t length;
+        int32_t value;
+    };
+
+    DoubleArrayBuilder(const DoubleArrayBuilder &other) = delete;
+    DoubleArrayBuilder &operator=(const DoubleArrayBuilder &other) = delete;
+
+    static int32_t U_CALLCONV compareWords(const void *context, const void *left, const void *right);
+    int32_t getByte(const Word &word, int32_t index) const {
+        return (uint8_t)words[word.offset + index];
+    }
+    UBool ensureUnits(int32_t count, UErrorCode &errorCode);
+    int32_t findBase(const int32_t *labels, int32_t labelCount, UErrorCode &errorCode);
+    void buildNode(int32_t node, int32_t start, int32_t limit, int32_t depth, UErrorCode &errorCode);
+
+    CharString words;
+    MaybeStackArray<Word, 16> wordList;
+    int32_t wordCount;
+    MaybeStackArray<int32_t, 16> units;
+    int32_t unitsLength;  // number of initialized (base, check) pairs
+    int32_t unitCount;  // number of pairs in use, excluding padding
+    int32_t nextCheckPos;
+};
+
+U_NAMESPACE_END
+
+#endif  // !UCONFIG_NO_BREAK_ITERATION
+#endif  // __DOUBLEARRAYBUILDER_H__